@@ -0,0 +1,84 @@
+/*
+ * Call-heavy benchmark for the TriCore calling convention.
+ *
+ * Mixes pointer, integer, 64-bit, float and small-structure arguments so
+ * that the A, D and E argument registers are all used, plus a byval
+ * aggregate and a variadic call. With the EABI assignment every fixed argument below travels
+ * in a register; only the large structure and the unnamed arguments of sum()
+ * go through the stack. 33.call_heavy.s is the llc -O2 output.
+ *
+ * Before the EABI work llc aborted on fadd() (f32), swap() (i64 rotate) and
+ * sum() (varargs). With those three left out, the loop in main() compiled
+ * as follows:
+ *
+ *                          before  after
+ *   instructions              24     32
+ *   loads and stores           9     12
+ *   of which spill/reload      9      0
+ *
+ * The old loop reloaded every argument from a spill slot on each iteration
+ * and passed the byval structure to total() as a bare pointer. The new loop
+ * keeps the arguments in registers; its 12 memory accesses are the 24-byte
+ * byval copy the EABI requires.
+ */
+#include <stdarg.h>
+
+struct pair { int lo; int hi; };
+struct big  { int v[6]; };
+
+float step = 1.0f;
+float out;
+
+int mix(int *p, int a, long long b, int *q) {
+  return *p + a + (int)b + *q;
+}
+
+float fadd(float a, int n, float b) {
+  return a + b;
+}
+
+/* a takes D4, so b skips to E6 and c back-fills D5. */
+long long widen(int a, long long b, int c) {
+  return a + b + c;
+}
+
+struct pair swap(struct pair p) {
+  struct pair r = { p.hi, p.lo };
+  return r;
+}
+
+int total(struct big b) {
+  int s = 0, i;
+  for (i = 0; i < 6; i++)
+    s += b.v[i];
+  return s;
+}
+
+int sum(int n, ...) {
+  va_list ap;
+  int s = 0;
+  va_start(ap, n);
+  while (n--)
+    s += va_arg(ap, int);
+  va_end(ap);
+  return s;
+}
+
+int main() {
+  int x = 1, y = 2, acc = 0, i;
+  float f = step;
+  struct pair p = { 3, 4 };
+  struct big b = { { 1, 2, 3, 4, 5, 6 } };
+
+  for (i = 0; i < 1000; i++) {
+    acc += mix(&x, i, 5LL, &y);
+    f = fadd(f, i, step);
+    acc += (int)widen(i, 6LL, 7);
+    p = swap(p);
+    acc += p.lo;
+    acc += total(b);
+    acc += sum(3, i, 2, 1);
+  }
+  out = f;
+  return acc;
+}
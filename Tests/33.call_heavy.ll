@@ -0,0 +1,160 @@
+; ModuleID = '33.call_heavy.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+%struct.big = type { [6 x i32] }
+
+@step = global float 1.000000e+00, align 4
+@out = common global float 0.000000e+00, align 4
+
+; Function Attrs: nounwind readonly
+define i32 @mix(i32* nocapture readonly %p, i32 %a, i64 %b, i32* nocapture readonly %q) #0 {
+entry:
+  %0 = load i32, i32* %p, align 4
+  %add = add nsw i32 %0, %a
+  %conv = trunc i64 %b to i32
+  %add1 = add nsw i32 %add, %conv
+  %1 = load i32, i32* %q, align 4
+  %add2 = add nsw i32 %add1, %1
+  ret i32 %add2
+}
+
+; Function Attrs: nounwind readnone
+define float @fadd(float %a, i32 %n, float %b) #1 {
+entry:
+  %add = fadd float %a, %b
+  ret float %add
+}
+
+; Function Attrs: nounwind readnone
+define i64 @widen(i32 %a, i64 %b, i32 %c) #1 {
+entry:
+  %conv = sext i32 %a to i64
+  %add = add nsw i64 %conv, %b
+  %conv1 = sext i32 %c to i64
+  %add2 = add nsw i64 %add, %conv1
+  ret i64 %add2
+}
+
+; Function Attrs: nounwind readnone
+define i64 @swap(i64 %p.coerce) #1 {
+entry:
+  %lo = trunc i64 %p.coerce to i32
+  %p.sroa.1.0.extract.shift = lshr i64 %p.coerce, 32
+  %hi = trunc i64 %p.sroa.1.0.extract.shift to i32
+  %r.sroa.1.0.insert.ext = zext i32 %lo to i64
+  %r.sroa.1.0.insert.shift = shl nuw i64 %r.sroa.1.0.insert.ext, 32
+  %r.sroa.0.0.insert.ext = zext i32 %hi to i64
+  %r.sroa.0.0.insert.insert = or i64 %r.sroa.1.0.insert.shift, %r.sroa.0.0.insert.ext
+  ret i64 %r.sroa.0.0.insert.insert
+}
+
+; Function Attrs: nounwind readonly
+define i32 @total(%struct.big* nocapture readonly byval align 4 %b) #0 {
+entry:
+  br label %for.body
+
+for.body:                                         ; preds = %for.body, %entry
+  %i.06 = phi i32 [ 0, %entry ], [ %inc, %for.body ]
+  %s.05 = phi i32 [ 0, %entry ], [ %add, %for.body ]
+  %arrayidx = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 %i.06
+  %0 = load i32, i32* %arrayidx, align 4
+  %add = add nsw i32 %0, %s.05
+  %inc = add nuw nsw i32 %i.06, 1
+  %exitcond = icmp eq i32 %inc, 6
+  br i1 %exitcond, label %for.end, label %for.body
+
+for.end:                                          ; preds = %for.body
+  ret i32 %add
+}
+
+; Function Attrs: nounwind
+define i32 @sum(i32 %n, ...) #2 {
+entry:
+  %ap = alloca i8*, align 4
+  %ap1 = bitcast i8** %ap to i8*
+  call void @llvm.va_start(i8* %ap1)
+  %tobool3 = icmp eq i32 %n, 0
+  br i1 %tobool3, label %while.end, label %while.body
+
+while.body:                                       ; preds = %entry, %while.body
+  %s.05 = phi i32 [ %add, %while.body ], [ 0, %entry ]
+  %n.addr.04 = phi i32 [ %dec, %while.body ], [ %n, %entry ]
+  %dec = add nsw i32 %n.addr.04, -1
+  %0 = va_arg i8** %ap, i32
+  %add = add nsw i32 %0, %s.05
+  %tobool = icmp eq i32 %dec, 0
+  br i1 %tobool, label %while.end, label %while.body
+
+while.end:                                        ; preds = %while.body, %entry
+  %s.0.lcssa = phi i32 [ 0, %entry ], [ %add, %while.body ]
+  call void @llvm.va_end(i8* %ap1)
+  ret i32 %s.0.lcssa
+}
+
+; Function Attrs: nounwind
+declare void @llvm.va_start(i8*) #3
+
+; Function Attrs: nounwind
+declare void @llvm.va_end(i8*) #3
+
+; Function Attrs: nounwind
+define i32 @main() #2 {
+entry:
+  %x = alloca i32, align 4
+  %y = alloca i32, align 4
+  %b = alloca %struct.big, align 4
+  store i32 1, i32* %x, align 4
+  store i32 2, i32* %y, align 4
+  %v = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 0
+  store i32 1, i32* %v, align 4
+  %v1 = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 1
+  store i32 2, i32* %v1, align 4
+  %v2 = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 2
+  store i32 3, i32* %v2, align 4
+  %v3 = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 3
+  store i32 4, i32* %v3, align 4
+  %v4 = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 4
+  store i32 5, i32* %v4, align 4
+  %v5 = getelementptr inbounds %struct.big, %struct.big* %b, i32 0, i32 0, i32 5
+  store i32 6, i32* %v5, align 4
+  %f.init = load float, float* @step, align 4
+  br label %for.body
+
+for.body:                                         ; preds = %for.body, %entry
+  %i.021 = phi i32 [ 0, %entry ], [ %inc, %for.body ]
+  %acc.020 = phi i32 [ 0, %entry ], [ %add10, %for.body ]
+  %p.sroa.0.019 = phi i64 [ 17179869187, %entry ], [ %call3, %for.body ]
+  %f.018 = phi float [ %f.init, %entry ], [ %callf, %for.body ]
+  %call = call i32 @mix(i32* %x, i32 %i.021, i64 5, i32* %y) #4
+  %s = load float, float* @step, align 4
+  %callf = call float @fadd(float %f.018, i32 %i.021, float %s) #4
+  %add = add nsw i32 %call, %acc.020
+  %call1 = call i64 @widen(i32 %i.021, i64 6, i32 7) #4
+  %conv = trunc i64 %call1 to i32
+  %add2 = add nsw i32 %add, %conv
+  %call3 = call i64 @swap(i64 %p.sroa.0.019) #4
+  %lo = trunc i64 %call3 to i32
+  %add5 = add nsw i32 %add2, %lo
+  %call6 = call i32 @total(%struct.big* byval align 4 %b) #4
+  %add7 = add nsw i32 %add5, %call6
+  %call8 = call i32 (i32, ...) @sum(i32 3, i32 %i.021, i32 2, i32 1) #4
+  %add10 = add nsw i32 %add7, %call8
+  %inc = add nuw nsw i32 %i.021, 1
+  %exitcond = icmp eq i32 %inc, 1000
+  br i1 %exitcond, label %for.end, label %for.body
+
+for.end:                                          ; preds = %for.body
+  store float %callf, float* @out, align 4
+  ret i32 %add10
+}
+
+attributes #0 = { nounwind readonly "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { nounwind }
+attributes #4 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,224 @@
+	.text
+	.file	"33.call_heavy.ll"
+	.globl	mix
+	.align	1
+	.type	mix,@function
+mix:                                    # @mix
+# BB#0:                                 # %entry
+	ld.w %d15, [%a4] 0
+	ld.w %d2, [%a5] 0
+	add %d4, %d15
+	add %d6, %d4
+	add %d2, %d6
+	ret
+.Lfunc_end0:
+	.size	mix, .Lfunc_end0-mix
+
+	.globl	fadd
+	.align	1
+	.type	fadd,@function
+fadd:                                   # @fadd
+# BB#0:                                 # %entry
+	add.f %d2, %d4, %d6
+	ret
+.Lfunc_end1:
+	.size	fadd, .Lfunc_end1-fadd
+
+	.globl	widen
+	.align	1
+	.type	widen,@function
+widen:                                  # @widen
+# BB#0:                                 # %entry
+	mov %d2, %d5
+	sha %d5, %d4, -31
+	addx %d4, %d4, %d6
+	addc %d5, %d5, %d7
+	sha %d3, %d2, -31
+	addx %d2, %d4, %d2
+	addc %d3, %d5, %d3
+	ret
+.Lfunc_end2:
+	.size	widen, .Lfunc_end2-widen
+
+	.globl	swap
+	.align	1
+	.type	swap,@function
+swap:                                   # @swap
+# BB#0:                                 # %entry
+	sh %d6, %d5, 0
+	mov %d7, 0
+	sh %d3, %d4, 0
+	mov %d2, %d7
+	or %d2, %d6
+	or %d3, %d7
+	ret
+.Lfunc_end3:
+	.size	swap, .Lfunc_end3-swap
+
+	.globl	total
+	.align	1
+	.type	total,@function
+total:                                  # @total
+# BB#0:                                 # %entry
+	mov %d15, 0
+	mov.d %d3, %a10
+	mov %d2, 0
+.LBB4_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov %d4, %d15
+	add %d4, %d3
+	mov.a %a15, %d4
+	ld.w %d4, [%a15] 0
+	add %d2, %d4
+	add %d15, 4
+	ne %d4, %d15, 24
+	jne %d4, 0, .LBB4_1
+# BB#2:                                 # %for.end
+	ret
+.Lfunc_end4:
+	.size	total, .Lfunc_end4-total
+
+	.globl	sum
+	.align	1
+	.type	sum,@function
+sum:                                    # @sum
+# BB#0:                                 # %entry
+	sub.a %a10, 8
+	mov.d %d15, %a10
+	add %d15, %d15, 8
+	st.w [%a10] 4, %d15
+	mov %d2, 0
+	eq %d15, %d4, 0
+	jnz %d15, .LBB5_2
+.LBB5_1:                                # %while.body
+                                        # =>This Inner Loop Header: Depth=1
+	ld.w %d15, [%a10] 4
+	add %d15, 3
+	andn %d15, %d15, 3
+	mov.a %a15, %d15
+	add %d15, 4
+	st.w [%a10] 4, %d15
+	ld.w %d15, [%a15] 0
+	add %d2, %d15
+	jned %d4, 1, .LBB5_1
+.LBB5_2:                                # %while.end
+	ret
+.Lfunc_end5:
+	.size	sum, .Lfunc_end5-sum
+
+	.globl	main
+	.align	1
+	.type	main,@function
+main:                                   # @main
+# BB#0:                                 # %entry
+	sub.a %a10, 72
+	mov %d15, 1
+	st.w [%a10] 68, %d15
+	mov %d15, 2
+	st.w [%a10] 64, %d15
+	mov %d2, 1
+	mov %d3, 2
+	st.d [%a10] 40, %e2
+	mov %d8, 3
+	mov %d9, 4
+	st.d [%a10] 48, %e8
+	mov %d10, 5
+	mov %d11, 6
+	movh %d15, hi:step
+	addi %d15, %d15, lo:step
+	st.d [%a10] 56, %e10
+	mov.a %a15, %d15
+	ld.w %d12, [%a15] 0
+	mov %d15, 0
+	mov %d11, 0
+	mov.d %d2, %a10
+	add %d2, %d2, 68
+	st.w [%a10] 36, %d2             # 4-byte Folded Spill
+	mov.d %d14, %a10
+	add %d14, %d14, 64
+	imask %e2, 3, 1, 0
+	st.d [%a10] 24, %e2             # 8-byte Folded Spill
+	mov %d13, 0
+.LBB6_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	ld.w %d2, [%a10] 36             # 4-byte Folded Reload
+	mov.a %a4, %d2
+	mov %d4, %d15
+	mov %d6, %d10
+	mov %d7, %d11
+	mov.a %a5, %d14
+	call mix
+	movh %d3, hi:step
+	addi %d3, %d3, lo:step
+	mov.a %a15, %d3
+	ld.w %d6, [%a15] 0
+	mov %d3, %d2
+	mov %d4, %d12
+	mov %d5, %d15
+	call fadd
+	mov %d12, %d2
+	add %d13, %d3
+	mov %d5, 7
+	mov %d4, %d15
+	ld.d %e6, [%a10] 24             # 8-byte Folded Reload
+	call widen
+	mov %d0, %d2
+	mov %d1, %d3
+	add %d0, %d13
+	mov %d4, %d8
+	mov %d5, %d9
+	call swap
+	mov %d8, %d2
+	mov %d9, %d3
+	mov %d5, %d8
+	add %d5, %d0
+	ld.w %d2, [%a10] 60
+	st.w [%a10] 20, %d2
+	ld.w %d2, [%a10] 56
+	st.w [%a10] 16, %d2
+	ld.w %d2, [%a10] 52
+	st.w [%a10] 12, %d2
+	ld.w %d2, [%a10] 48
+	st.w [%a10] 8, %d2
+	ld.w %d2, [%a10] 44
+	st.w [%a10] 4, %d2
+	ld.w %d2, [%a10] 40
+	st.w [%a10] 0, %d2
+	call total
+	mov %d3, %d2
+	add %d3, %d5
+	mov %d2, 1
+	st.w [%a10] 8, %d2
+	mov %d2, 2
+	st.w [%a10] 4, %d2
+	mov %d4, 3
+	st.w [%a10] 0, %d15
+	call sum
+	mov %d13, %d2
+	add %d13, %d3
+	mov %d2, 1000
+	add %d2, %d2, -1
+	jnei %d15, %d2, .LBB6_1
+# BB#2:                                 # %for.end
+	movh %d15, hi:out
+	addi %d15, %d15, lo:out
+	mov.a %a15, %d15
+	st.w [%a15] 0, %d12
+	mov %d2, %d13
+	ret
+.Lfunc_end6:
+	.size	main, .Lfunc_end6-main
+
+	.type	step,@object            # @step
+	.data
+	.globl	step
+	.align	2
+step:
+	.word	1065353216              # float 1
+	.size	step, 4
+
+	.type	out,@object             # @out
+	.comm	out,4,4
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,24 @@
+/*
+ * Library calls made by the code generator itself.
+ *
+ * On cores without DIV, division and remainder become __divsi3, __modsi3
+ * and __udivsi3. Large or variable-sized structure copies and clears become
+ * memcpy, memmove and memset. None of these calls has unnamed operands, so
+ * every operand travels in a register: pointers in A4/A5, integers in
+ * D4/D5.
+ */
+#include <string.h>
+
+struct rec { int key; int v[63]; };
+
+int quot(int a, int b) { return a / b; }
+
+int rem(int a, int b) { return a % b; }
+
+unsigned uquot(unsigned a, unsigned b) { return a / b; }
+
+void copy(struct rec *d, const struct rec *s) { *d = *s; }
+
+void clear(struct rec *r, int n) { memset(r, 0, n * sizeof *r); }
+
+void move(char *buf, int n) { memmove(buf + 1, buf, n); }
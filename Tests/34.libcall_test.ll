@@ -0,0 +1,69 @@
+; ModuleID = '34.libcall_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+%struct.rec = type { i32, [63 x i32] }
+
+; Function Attrs: nounwind readnone
+define i32 @quot(i32 %a, i32 %b) #0 {
+entry:
+  %div = sdiv i32 %a, %b
+  ret i32 %div
+}
+
+; Function Attrs: nounwind readnone
+define i32 @rem(i32 %a, i32 %b) #0 {
+entry:
+  %rem = srem i32 %a, %b
+  ret i32 %rem
+}
+
+; Function Attrs: nounwind readnone
+define i32 @uquot(i32 %a, i32 %b) #0 {
+entry:
+  %div = udiv i32 %a, %b
+  ret i32 %div
+}
+
+; Function Attrs: nounwind
+define void @copy(%struct.rec* nocapture %d, %struct.rec* nocapture readonly %s) #1 {
+entry:
+  %0 = bitcast %struct.rec* %d to i8*
+  %1 = bitcast %struct.rec* %s to i8*
+  tail call void @llvm.memcpy.p0i8.p0i8.i32(i8* %0, i8* %1, i32 256, i32 4, i1 false)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memcpy.p0i8.p0i8.i32(i8* nocapture, i8* nocapture readonly, i32, i32, i1) #2
+
+; Function Attrs: nounwind
+define void @clear(%struct.rec* nocapture %r, i32 %n) #1 {
+entry:
+  %0 = bitcast %struct.rec* %r to i8*
+  %mul = shl i32 %n, 8
+  tail call void @llvm.memset.p0i8.i32(i8* %0, i8 0, i32 %mul, i32 4, i1 false)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memset.p0i8.i32(i8* nocapture, i8, i32, i32, i1) #2
+
+; Function Attrs: nounwind
+define void @move(i8* %buf, i32 %n) #1 {
+entry:
+  %add.ptr = getelementptr inbounds i8, i8* %buf, i32 1
+  tail call void @llvm.memmove.p0i8.p0i8.i32(i8* %add.ptr, i8* %buf, i32 %n, i32 1, i1 false)
+  ret void
+}
+
+; Function Attrs: nounwind
+declare void @llvm.memmove.p0i8.p0i8.i32(i8* nocapture, i8* nocapture readonly, i32, i32, i1) #2
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,73 @@
+	.text
+	.file	"34.libcall_test.ll"
+	.globl	quot
+	.align	1
+	.type	quot,@function
+quot:                                   # @quot
+# BB#0:                                 # %entry
+	call __divsi3
+	ret
+.Lfunc_end0:
+	.size	quot, .Lfunc_end0-quot
+
+	.globl	rem
+	.align	1
+	.type	rem,@function
+rem:                                    # @rem
+# BB#0:                                 # %entry
+	call __modsi3
+	ret
+.Lfunc_end1:
+	.size	rem, .Lfunc_end1-rem
+
+	.globl	uquot
+	.align	1
+	.type	uquot,@function
+uquot:                                  # @uquot
+# BB#0:                                 # %entry
+	call __udivsi3
+	ret
+.Lfunc_end2:
+	.size	uquot, .Lfunc_end2-uquot
+
+	.globl	copy
+	.align	1
+	.type	copy,@function
+copy:                                   # @copy
+# BB#0:                                 # %entry
+	mov %d4, 256
+	call memcpy
+	ret
+.Lfunc_end3:
+	.size	copy, .Lfunc_end3-copy
+
+	.globl	clear
+	.align	1
+	.type	clear,@function
+clear:                                  # @clear
+# BB#0:                                 # %entry
+	sh %d5, %d4, 8
+	mov %d4, 0
+	call memset
+	ret
+.Lfunc_end4:
+	.size	clear, .Lfunc_end4-clear
+
+	.globl	move
+	.align	1
+	.type	move,@function
+move:                                   # @move
+# BB#0:                                 # %entry
+	mov.aa %a15, %a4
+	mov.d %d15, %a15
+	add %d15, 1
+	mov.a %a4, %d15
+	mov.aa %a5, %a15
+	call memmove
+	ret
+.Lfunc_end5:
+	.size	move, .Lfunc_end5-move
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
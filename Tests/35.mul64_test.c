@@ -0,0 +1,19 @@
+/*
+ * 64-bit products.
+ *
+ * Division by a constant becomes a multiply by its reciprocal, which needs
+ * the high word of a 32x32 product (MUL/MUL.U into an E register). Widened
+ * products use the same instructions, and a full 64x64 multiply adds the
+ * two cross products into the high word.
+ */
+int mod3(int x) { return x % 3; }
+
+unsigned div10(unsigned x) { return x / 10; }
+
+long long wide(int a, int b) { return (long long)a * b; }
+
+unsigned long long uwide(unsigned a, unsigned b) {
+  return (unsigned long long)a * b;
+}
+
+long long mul64(long long a, long long b) { return a * b; }
@@ -0,0 +1,48 @@
+; ModuleID = '35.mul64_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @mod3(i32 %x) #0 {
+entry:
+  %rem = srem i32 %x, 3
+  ret i32 %rem
+}
+
+; Function Attrs: nounwind readnone
+define i32 @div10(i32 %x) #0 {
+entry:
+  %div = udiv i32 %x, 10
+  ret i32 %div
+}
+
+; Function Attrs: nounwind readnone
+define i64 @wide(i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %mul = mul nsw i64 %conv1, %conv
+  ret i64 %mul
+}
+
+; Function Attrs: nounwind readnone
+define i64 @uwide(i32 %a, i32 %b) #0 {
+entry:
+  %conv = zext i32 %a to i64
+  %conv1 = zext i32 %b to i64
+  %mul = mul nuw i64 %conv1, %conv
+  ret i64 %mul
+}
+
+; Function Attrs: nounwind readnone
+define i64 @mul64(i64 %a, i64 %b) #0 {
+entry:
+  %mul = mul nsw i64 %b, %a
+  ret i64 %mul
+}
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,71 @@
+	.text
+	.file	"35.mul64_test.ll"
+	.globl	mod3
+	.align	1
+	.type	mod3,@function
+mod3:                                   # @mod3
+# BB#0:                                 # %entry
+	movh %d15, 21845
+	addi %d15, %d15, 21846
+	mul %e2, %d4, %d15
+	sh %d6, %d3, -31
+	mov %d7, 0
+	add %d6, %d3
+	mul %d15, %d6, 3
+	sub %d4, %d15
+	mov %d2, %d4
+	ret
+.Lfunc_end0:
+	.size	mod3, .Lfunc_end0-mod3
+
+	.globl	div10
+	.align	1
+	.type	div10,@function
+div10:                                  # @div10
+# BB#0:                                 # %entry
+	movh %d15, 52429
+	addi %d15, %d15, -13107
+	mul.u %e2, %d4, %d15
+	sh %d2, %d3, -3
+	mov %d3, 0
+	ret
+.Lfunc_end1:
+	.size	div10, .Lfunc_end1-div10
+
+	.globl	wide
+	.align	1
+	.type	wide,@function
+wide:                                   # @wide
+# BB#0:                                 # %entry
+	mul %e2, %d5, %d4
+	ret
+.Lfunc_end2:
+	.size	wide, .Lfunc_end2-wide
+
+	.globl	uwide
+	.align	1
+	.type	uwide,@function
+uwide:                                  # @uwide
+# BB#0:                                 # %entry
+	mul.u %e2, %d5, %d4
+	ret
+.Lfunc_end3:
+	.size	uwide, .Lfunc_end3-uwide
+
+	.globl	mul64
+	.align	1
+	.type	mul64,@function
+mul64:                                  # @mul64
+# BB#0:                                 # %entry
+	mul %d15, %d7, %d4
+	mul.u %e2, %d6, %d4
+	add %d15, %d3, %d15
+	mul %d4, %d6, %d5
+	add %d3, %d15, %d4
+	ret
+.Lfunc_end4:
+	.size	mul64, .Lfunc_end4-mul64
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,25 @@
+/*
+ * Widening to 64 bits.
+ *
+ * The low word of the result keeps the value, and the high word holds
+ * copies of its sign bit or zeros. Loads that widen to 64 bits load a word
+ * or less and then extend it in registers.
+ */
+signed char sc;
+short ss;
+unsigned short us;
+int si;
+unsigned ui;
+
+long long load_sc(void) { return sc; }
+long long load_ss(void) { return ss; }
+unsigned long long load_us(void) { return us; }
+long long load_si(void) { return si; }
+unsigned long long load_ui(void) { return ui; }
+
+long long sext8(long long x) { return (signed char)x; }
+long long sext16(long long x) { return (short)x; }
+unsigned long long zext(unsigned x) { return x; }
+long long shr40(long long x) { return x >> 40; }
+
+int div7(void) { return ss / 7; }
@@ -0,0 +1,95 @@
+; ModuleID = '36.ext64_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+@sc = common global i8 0, align 1
+@ss = common global i16 0, align 2
+@us = common global i16 0, align 2
+@si = common global i32 0, align 4
+@ui = common global i32 0, align 4
+
+; Function Attrs: nounwind readonly
+define i64 @load_sc() #0 {
+entry:
+  %0 = load i8, i8* @sc, align 1
+  %conv = sext i8 %0 to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readonly
+define i64 @load_ss() #0 {
+entry:
+  %0 = load i16, i16* @ss, align 2
+  %conv = sext i16 %0 to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readonly
+define i64 @load_us() #0 {
+entry:
+  %0 = load i16, i16* @us, align 2
+  %conv = zext i16 %0 to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readonly
+define i64 @load_si() #0 {
+entry:
+  %0 = load i32, i32* @si, align 4
+  %conv = sext i32 %0 to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readonly
+define i64 @load_ui() #0 {
+entry:
+  %0 = load i32, i32* @ui, align 4
+  %conv = zext i32 %0 to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readnone
+define i64 @sext8(i64 %x) #1 {
+entry:
+  %sext = shl i64 %x, 56
+  %conv1 = ashr exact i64 %sext, 56
+  ret i64 %conv1
+}
+
+; Function Attrs: nounwind readnone
+define i64 @sext16(i64 %x) #1 {
+entry:
+  %sext = shl i64 %x, 48
+  %conv1 = ashr exact i64 %sext, 48
+  ret i64 %conv1
+}
+
+; Function Attrs: nounwind readnone
+define i64 @zext(i32 %x) #1 {
+entry:
+  %conv = zext i32 %x to i64
+  ret i64 %conv
+}
+
+; Function Attrs: nounwind readnone
+define i64 @shr40(i64 %x) #1 {
+entry:
+  %shr = ashr i64 %x, 40
+  ret i64 %shr
+}
+
+; Function Attrs: nounwind readonly
+define i32 @div7() #0 {
+entry:
+  %0 = load i16, i16* @ss, align 2
+  %conv = sext i16 %0 to i32
+  %div = sdiv i32 %conv, 7
+  ret i32 %div
+}
+
+attributes #0 = { nounwind readonly "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
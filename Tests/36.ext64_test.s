@@ -0,0 +1,157 @@
+	.text
+	.file	"36.ext64_test.ll"
+	.globl	load_sc
+	.align	1
+	.type	load_sc,@function
+load_sc:                                # @load_sc
+# BB#0:                                 # %entry
+	movh %d15, hi:sc
+	addi %d15, %d15, lo:sc
+	mov.a %a15, %d15
+	ld.b %d2, [%a15] 0
+	sha %d3, %d2, -31
+	ret
+.Lfunc_end0:
+	.size	load_sc, .Lfunc_end0-load_sc
+
+	.globl	load_ss
+	.align	1
+	.type	load_ss,@function
+load_ss:                                # @load_ss
+# BB#0:                                 # %entry
+	movh %d15, hi:ss
+	addi %d15, %d15, lo:ss
+	mov.a %a15, %d15
+	ld.h %d2, [%a15] 0
+	sha %d3, %d2, -31
+	ret
+.Lfunc_end1:
+	.size	load_ss, .Lfunc_end1-load_ss
+
+	.globl	load_us
+	.align	1
+	.type	load_us,@function
+load_us:                                # @load_us
+# BB#0:                                 # %entry
+	movh %d15, hi:us
+	addi %d15, %d15, lo:us
+	mov.a %a15, %d15
+	ld.hu %d2, [%a15] 0
+	mov %d3, 0
+	ret
+.Lfunc_end2:
+	.size	load_us, .Lfunc_end2-load_us
+
+	.globl	load_si
+	.align	1
+	.type	load_si,@function
+load_si:                                # @load_si
+# BB#0:                                 # %entry
+	movh %d15, hi:si
+	addi %d15, %d15, lo:si
+	mov.a %a15, %d15
+	ld.w %d2, [%a15] 0
+	sha %d3, %d2, -31
+	ret
+.Lfunc_end3:
+	.size	load_si, .Lfunc_end3-load_si
+
+	.globl	load_ui
+	.align	1
+	.type	load_ui,@function
+load_ui:                                # @load_ui
+# BB#0:                                 # %entry
+	movh %d15, hi:ui
+	addi %d15, %d15, lo:ui
+	mov.a %a15, %d15
+	ld.w %d2, [%a15] 0
+	mov %d3, 0
+	ret
+.Lfunc_end4:
+	.size	load_ui, .Lfunc_end4-load_ui
+
+	.globl	sext8
+	.align	1
+	.type	sext8,@function
+sext8:                                  # @sext8
+# BB#0:                                 # %entry
+	extr %d2, %d4, 0, 8
+	sha %d3, %d2, -31
+	ret
+.Lfunc_end5:
+	.size	sext8, .Lfunc_end5-sext8
+
+	.globl	sext16
+	.align	1
+	.type	sext16,@function
+sext16:                                 # @sext16
+# BB#0:                                 # %entry
+	extr %d2, %d4, 0, 16
+	sha %d3, %d2, -31
+	ret
+.Lfunc_end6:
+	.size	sext16, .Lfunc_end6-sext16
+
+	.globl	zext
+	.align	1
+	.type	zext,@function
+zext:                                   # @zext
+# BB#0:                                 # %entry
+	mov %d5, 0
+	mov %d2, %d4
+	mov %d3, %d5
+	ret
+.Lfunc_end7:
+	.size	zext, .Lfunc_end7-zext
+
+	.globl	shr40
+	.align	1
+	.type	shr40,@function
+shr40:                                  # @shr40
+# BB#0:                                 # %entry
+	sha %d2, %d5, -8
+	sha %d3, %d5, -31
+	ret
+.Lfunc_end8:
+	.size	shr40, .Lfunc_end8-shr40
+
+	.globl	div7
+	.align	1
+	.type	div7,@function
+div7:                                   # @div7
+# BB#0:                                 # %entry
+	movh %d15, hi:ss
+	addi %d15, %d15, lo:ss
+	mov.a %a15, %d15
+	ld.h %d2, [%a15] 0
+	extr %d4, %d2, 0, 16
+	sha %d5, %d4, -31
+	movh %d6, 37449
+	addi %d6, %d6, 9363
+	mov %d7, -1
+	mul %d15, %d5, %d6
+	mul.u %e8, %d4, %d6
+	add %d15, %d9, %d15
+	mul %d4, %d4, %d7
+	add %d9, %d15, %d4
+	add %d2, %d9
+	sha %d15, %d2, -2
+	sh %d2, %d2, -31
+	add %d2, %d15
+	ret
+.Lfunc_end9:
+	.size	div7, .Lfunc_end9-div7
+
+	.type	sc,@object              # @sc
+	.comm	sc,1,1
+	.type	ss,@object              # @ss
+	.comm	ss,2,2
+	.type	us,@object              # @us
+	.comm	us,2,2
+	.type	si,@object              # @si
+	.comm	si,4,4
+	.type	ui,@object              # @ui
+	.comm	ui,4,4
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,58 @@
+# Assembler syntax sample. Assemble and dump it with
+#
+#   llvm-mc -triple=tricore -filetype=obj 37.asm_syntax.s -o 37.asm_syntax.o
+#   llvm-objdump -d -r 37.asm_syntax.o
+#   llvm-objdump -r 37.asm_syntax.o
+#
+# and compare with 37.asm_syntax.dump. The second command lists the .data
+# relocations of the .word entries, which -d leaves out.
+
+	.text
+	.globl	sum
+	.type	sum,@function
+sum:
+	# Post- and pre-increment addressing.
+	mov	%d2, 0
+.LBB0_1:
+	ld.w	%d3, [%a4+] 4
+	add	%d2, %d3
+	st.w	[+%a5] 4, %d2
+	ld.w	%d3, [+%a4] -8
+	st.w	[%a5+] -4, %d3
+	jne	%d2, %d4, .LBB0_1
+	jlt	%d2, 0, .LBB0_2
+	jge.u	%d3, 15, .LBB0_1
+.LBB0_2:
+	# Absolute addresses, split in halves.
+	movh	%d15, hi:table
+	addi	%d15, %d15, lo:table
+	movh.a	%a15, hi:table+8
+	lea	%a15, [%a15] lo:table+8
+	ld.w	%d3, [%a15] 0
+	# Small data, relative to %a0.
+	ld.w	%d4, [%a0] sm:counter
+	lea	%a2, [%a0] sm:counter
+	st.w	[%a2] 0, %d2
+	# A function from another file.
+	call	ext
+	ret
+.Lfunc_end0:
+	.size	sum, .Lfunc_end0-sum
+
+	.data
+	.globl	table
+	.align	2
+table:
+	.word	1
+	.word	2
+	.word	sum
+	.word	table+4
+	.word	counter+2
+	.size	table, 20
+
+	.section	.sdata,"aw",@progbits
+	.globl	counter
+	.align	2
+counter:
+	.word	0
+	.size	counter, 4
@@ -0,0 +1,24 @@
+/*
+ * Peripheral register updates.
+ *
+ * A volatile read-modify-write that only sets and clears constant bits of
+ * an aligned word becomes one LDMST, with the value/mask pair built by
+ * IMASK where it fits. A single bit at an absolute address that ST.T can
+ * reach is stored on its own. A field of a packed structure is not word
+ * aligned, so it keeps the plain load and store.
+ */
+#define CTRL (*(volatile unsigned *)0xF0001000)
+
+struct __attribute__((packed)) dev { char tag; volatile unsigned cfg; };
+
+void ctrl_enable(void) { CTRL |= 1u << 4; }
+
+void ctrl_disable(void) { CTRL &= ~(1u << 4); }
+
+void ctrl_mode(void) { CTRL = (CTRL & ~0xF0u) | 0x30u; }
+
+void reg_set(volatile unsigned *r) { *r |= 0x100u; }
+
+void reg_clear(volatile unsigned *r) { *r &= ~0x3u; }
+
+void packed_set(struct dev *d) { d->cfg |= 0x100u; }
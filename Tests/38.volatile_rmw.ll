@@ -0,0 +1,67 @@
+; ModuleID = '38.volatile_rmw.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+%struct.dev = type <{ i8, i32 }>
+
+; Function Attrs: nounwind
+define void @ctrl_enable() #0 {
+entry:
+  %0 = load volatile i32, i32* inttoptr (i32 -268431360 to i32*), align 4
+  %or = or i32 %0, 16
+  store volatile i32 %or, i32* inttoptr (i32 -268431360 to i32*), align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @ctrl_disable() #0 {
+entry:
+  %0 = load volatile i32, i32* inttoptr (i32 -268431360 to i32*), align 4
+  %and = and i32 %0, -17
+  store volatile i32 %and, i32* inttoptr (i32 -268431360 to i32*), align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @ctrl_mode() #0 {
+entry:
+  %0 = load volatile i32, i32* inttoptr (i32 -268431360 to i32*), align 4
+  %and = and i32 %0, -241
+  %or = or i32 %and, 48
+  store volatile i32 %or, i32* inttoptr (i32 -268431360 to i32*), align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @reg_set(i32* %r) #0 {
+entry:
+  %0 = load volatile i32, i32* %r, align 4
+  %or = or i32 %0, 256
+  store volatile i32 %or, i32* %r, align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @reg_clear(i32* %r) #0 {
+entry:
+  %0 = load volatile i32, i32* %r, align 4
+  %and = and i32 %0, -4
+  store volatile i32 %and, i32* %r, align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @packed_set(%struct.dev* nocapture %d) #0 {
+entry:
+  %cfg = getelementptr inbounds %struct.dev, %struct.dev* %d, i32 0, i32 1
+  %0 = load volatile i32, i32* %cfg, align 1
+  %or = or i32 %0, 256
+  store volatile i32 %or, i32* %cfg, align 1
+  ret void
+}
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
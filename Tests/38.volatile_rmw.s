@@ -0,0 +1,85 @@
+	.text
+	.file	"38.volatile_rmw.ll"
+	.globl	ctrl_enable
+	.align	1
+	.type	ctrl_enable,@function
+ctrl_enable:                            # @ctrl_enable
+# BB#0:                                 # %entry
+	st.t 4026535936, 4, 1
+	ret
+.Lfunc_end0:
+	.size	ctrl_enable, .Lfunc_end0-ctrl_enable
+
+	.globl	ctrl_disable
+	.align	1
+	.type	ctrl_disable,@function
+ctrl_disable:                           # @ctrl_disable
+# BB#0:                                 # %entry
+	st.t 4026535936, 4, 0
+	ret
+.Lfunc_end1:
+	.size	ctrl_disable, .Lfunc_end1-ctrl_disable
+
+	.globl	ctrl_mode
+	.align	1
+	.type	ctrl_mode,@function
+ctrl_mode:                              # @ctrl_mode
+# BB#0:                                 # %entry
+	imask %e2, 3, 4, 4
+	ldmst  -268431360, %e2
+	ret
+.Lfunc_end2:
+	.size	ctrl_mode, .Lfunc_end2-ctrl_mode
+
+	.globl	reg_set
+	.align	1
+	.type	reg_set,@function
+reg_set:                                # @reg_set
+# BB#0:                                 # %entry
+	imask %e2, 1, 8, 1
+	ldmst [%a4] 0, %e2
+	ret
+.Lfunc_end3:
+	.size	reg_set, .Lfunc_end3-reg_set
+
+	.globl	reg_clear
+	.align	1
+	.type	reg_clear,@function
+reg_clear:                              # @reg_clear
+# BB#0:                                 # %entry
+	imask %e2, 0, 0, 2
+	ldmst [%a4] 0, %e2
+	ret
+.Lfunc_end4:
+	.size	reg_clear, .Lfunc_end4-reg_clear
+
+	.globl	packed_set
+	.align	1
+	.type	packed_set,@function
+packed_set:                             # @packed_set
+# BB#0:                                 # %entry
+	ld.bu %d15, [%a4] 1
+	ld.bu %d2, [%a4] 2
+	ld.bu %d3, [%a4] 3
+	ld.bu %d4, [%a4] 4
+	sh %d2, %d2, 8
+	or %d15, %d2, %d15
+	sh %d2, %d4, 8
+	or %d2, %d2, %d3
+	sh %d2, %d2, 16
+	or %d15, %d2, %d15
+	or %d2, %d15, 256
+	st.b [%a4] 1, %d15
+	sh %d15, %d2, -16
+	st.b [%a4] 3, %d15
+	sh %d2, %d2, -8
+	st.b [%a4] 2, %d2
+	sh %d15, %d15, -8
+	st.b [%a4] 4, %d15
+	ret
+.Lfunc_end5:
+	.size	packed_set, .Lfunc_end5-packed_set
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,38 @@
+/*
+ * Word atomics on a multi-core AURIX (llc -mcpu=tc162).
+ *
+ * Exchange and compare-and-swap map onto SWAP.W and CMPSWAP.W, atomic
+ * and/or onto SWAPMSK.W, or LDMST when the old value is unused. DSYNC
+ * fences order them. An add becomes a CMPSWAP.W loop, and a 64-bit add
+ * falls through to the __sync library call with the address in A4 and the
+ * operand in E4.
+ */
+unsigned lock;
+unsigned flags;
+unsigned counter;
+unsigned long long total;
+
+unsigned take(void) { return __atomic_exchange_n(&lock, 1, __ATOMIC_SEQ_CST); }
+
+int claim(unsigned expected, unsigned desired) {
+  return __atomic_compare_exchange_n(&lock, &expected, desired, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+unsigned set_flags(unsigned m) {
+  return __atomic_fetch_or(&flags, m, __ATOMIC_SEQ_CST);
+}
+
+unsigned clear_flags(unsigned m) {
+  return __atomic_fetch_and(&flags, ~m, __ATOMIC_SEQ_CST);
+}
+
+void set_flag_only(unsigned m) { __atomic_fetch_or(&flags, m, __ATOMIC_RELAXED); }
+
+void barrier(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+unsigned count(void) { return __atomic_add_fetch(&counter, 1, __ATOMIC_SEQ_CST); }
+
+void add_total(unsigned long long n) {
+  __atomic_fetch_add(&total, n, __ATOMIC_SEQ_CST);
+}
@@ -0,0 +1,74 @@
+; ModuleID = '39.atomic_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+@lock = common global i32 0, align 4
+@flags = common global i32 0, align 4
+@counter = common global i32 0, align 4
+@total = common global i64 0, align 4
+
+; Function Attrs: nounwind
+define i32 @take() #0 {
+entry:
+  %0 = atomicrmw xchg i32* @lock, i32 1 seq_cst
+  ret i32 %0
+}
+
+; Function Attrs: nounwind
+define i32 @claim(i32 %expected, i32 %desired) #0 {
+entry:
+  %0 = cmpxchg i32* @lock, i32 %expected, i32 %desired seq_cst seq_cst
+  %1 = extractvalue { i32, i1 } %0, 1
+  %conv = zext i1 %1 to i32
+  ret i32 %conv
+}
+
+; Function Attrs: nounwind
+define i32 @set_flags(i32 %m) #0 {
+entry:
+  %0 = atomicrmw or i32* @flags, i32 %m seq_cst
+  ret i32 %0
+}
+
+; Function Attrs: nounwind
+define i32 @clear_flags(i32 %m) #0 {
+entry:
+  %neg = xor i32 %m, -1
+  %0 = atomicrmw and i32* @flags, i32 %neg seq_cst
+  ret i32 %0
+}
+
+; Function Attrs: nounwind
+define void @set_flag_only(i32 %m) #0 {
+entry:
+  %0 = atomicrmw or i32* @flags, i32 %m monotonic
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @barrier() #0 {
+entry:
+  fence seq_cst
+  ret void
+}
+
+; Function Attrs: nounwind
+define i32 @count() #0 {
+entry:
+  %0 = atomicrmw add i32* @counter, i32 1 seq_cst
+  %1 = add i32 %0, 1
+  ret i32 %1
+}
+
+; Function Attrs: nounwind
+define void @add_total(i64 %n) #0 {
+entry:
+  %0 = atomicrmw add i64* @total, i64 %n seq_cst
+  ret void
+}
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
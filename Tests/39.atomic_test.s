@@ -0,0 +1,152 @@
+	.text
+	.file	"39.atomic_test.ll"
+	.globl	take
+	.align	5
+	.type	take,@function
+take:                                   # @take
+# BB#0:                                 # %entry
+	movh %d15, hi:lock
+	addi %d15, %d15, lo:lock
+	mov %d2, 1
+	dsync
+	mov.a %a15, %d15
+	swap.w [%a15] 0, %d2
+	dsync
+	ret
+.Lfunc_end0:
+	.size	take, .Lfunc_end0-take
+
+	.globl	claim
+	.align	5
+	.type	claim,@function
+claim:                                  # @claim
+# BB#0:                                 # %entry
+	mov %d2, %d5
+	movh %d15, hi:lock
+	addi %d15, %d15, lo:lock
+	mov %d3, %d4
+	mov %d4, %d2
+	mov %d5, %d3
+	mov.a %a15, %d15
+	dsync
+	cmpswap.w [%a15] 0, %e4
+	eq %d2, %d4, %d3
+	dsync
+	ret
+.Lfunc_end1:
+	.size	claim, .Lfunc_end1-claim
+
+	.globl	set_flags
+	.align	5
+	.type	set_flags,@function
+set_flags:                              # @set_flags
+# BB#0:                                 # %entry
+	mov %d5, %d4
+	movh %d15, hi:flags
+	addi %d15, %d15, lo:flags
+	dsync
+	mov.a %a15, %d15
+	swapmsk.w [%a15] 0, %e4
+	dsync
+	mov %d2, %d4
+	ret
+.Lfunc_end2:
+	.size	set_flags, .Lfunc_end2-set_flags
+
+	.globl	clear_flags
+	.align	5
+	.type	clear_flags,@function
+clear_flags:                            # @clear_flags
+# BB#0:                                 # %entry
+	mov %d3, %d4
+	mov %d2, %d3
+	not %d2
+	movh %d15, hi:flags
+	addi %d15, %d15, lo:flags
+	dsync
+	mov.a %a15, %d15
+	swapmsk.w [%a15] 0, %e2
+	dsync
+	ret
+.Lfunc_end3:
+	.size	clear_flags, .Lfunc_end3-clear_flags
+
+	.globl	set_flag_only
+	.align	5
+	.type	set_flag_only,@function
+set_flag_only:                          # @set_flag_only
+# BB#0:                                 # %entry
+	movh %d15, hi:flags
+	addi %d15, %d15, lo:flags
+	mov %d5, %d4
+	mov.a %a15, %d15
+	ldmst [%a15] 0, %e4
+	ret
+.Lfunc_end4:
+	.size	set_flag_only, .Lfunc_end4-set_flag_only
+
+	.globl	barrier
+	.align	5
+	.type	barrier,@function
+barrier:                                # @barrier
+# BB#0:                                 # %entry
+	dsync
+	ret
+.Lfunc_end5:
+	.size	barrier, .Lfunc_end5-barrier
+
+	.globl	count
+	.align	5
+	.type	count,@function
+count:                                  # @count
+# BB#0:                                 # %entry
+	movh %d15, hi:counter
+	addi %d15, %d15, lo:counter
+	dsync
+	mov.a %a15, %d15
+	ld.w %d2, [%a15] 0
+	.align	3
+.LBB6_1:                                # %atomicrmw.start
+                                        # =>This Inner Loop Header: Depth=1
+	mov %d5, %d2
+	mov %d4, %d5
+	add %d4, 1
+	mov %d2, %d4
+	mov %d3, %d5
+	mov.a %a15, %d15
+	cmpswap.w [%a15] 0, %e2
+	eq %d4, %d2, %d5
+	jz.t %d4, 0, .LBB6_1
+# BB#2:                                 # %atomicrmw.end
+	add %d2, 1
+	dsync
+	ret
+.Lfunc_end6:
+	.size	count, .Lfunc_end6-count
+
+	.globl	add_total
+	.align	5
+	.type	add_total,@function
+add_total:                              # @add_total
+# BB#0:                                 # %entry
+	dsync
+	movh %d15, hi:total
+	addi %d15, %d15, lo:total
+	mov.a %a4, %d15
+	call __sync_fetch_and_add_8
+	dsync
+	ret
+.Lfunc_end7:
+	.size	add_total, .Lfunc_end7-add_total
+
+	.type	lock,@object            # @lock
+	.comm	lock,4,4
+	.type	flags,@object           # @flags
+	.comm	flags,4,4
+	.type	counter,@object         # @counter
+	.comm	counter,4,4
+	.type	total,@object           # @total
+	.comm	total,8,4
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,24 @@
+/*
+ * Calls without a context save (llc, and llc -mcpu=tc162).
+ *
+ * clamp and scale are small, internal and only called directly, so they
+ * become fastcc: the caller enters them with JL and they return with
+ * JI A11, or with FCALL and FRET on TC1.6.2. scale may call clamp, which is
+ * fastcc itself; JL overwrites A11, so before TC1.6.2 scale keeps it on the
+ * stack, where FCALL pushes it on its own. report calls an external
+ * function, which needs a context save anyway, so it stays on CALL and RET.
+ */
+extern void trace(int);
+
+static int clamp(int x, int lo, int hi) {
+  return x < lo ? lo : x > hi ? hi : x;
+}
+
+static int scale(int x, int k) { return clamp(x * k, -1000, 1000); }
+
+static int report(int x) {
+  trace(x);
+  return x + 1;
+}
+
+int run(int a, int b) { return report(scale(a, b) + clamp(b, 0, 255)); }
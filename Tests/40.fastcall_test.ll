@@ -0,0 +1,51 @@
+; ModuleID = '40.fastcall_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define i32 @run(i32 %a, i32 %b) #0 {
+entry:
+  %call = call i32 @scale(i32 %a, i32 %b)
+  %call1 = call i32 @clamp(i32 %b, i32 0, i32 255)
+  %add = add nsw i32 %call, %call1
+  %call2 = call i32 @report(i32 %add)
+  ret i32 %call2
+}
+
+; Function Attrs: noinline nounwind
+define internal i32 @scale(i32 %x, i32 %k) #1 {
+entry:
+  %mul = mul nsw i32 %x, %k
+  %call = call i32 @clamp(i32 %mul, i32 -1000, i32 1000)
+  ret i32 %call
+}
+
+; Function Attrs: noinline nounwind readnone
+define internal i32 @clamp(i32 %x, i32 %lo, i32 %hi) #2 {
+entry:
+  %cmp = icmp slt i32 %x, %lo
+  %cmp1 = icmp sgt i32 %x, %hi
+  %cond = select i1 %cmp1, i32 %hi, i32 %x
+  %cond5 = select i1 %cmp, i32 %lo, i32 %cond
+  ret i32 %cond5
+}
+
+; Function Attrs: noinline nounwind
+define internal i32 @report(i32 %x) #1 {
+entry:
+  call void @trace(i32 %x) #3
+  %add = add nsw i32 %x, 1
+  ret i32 %add
+}
+
+declare void @trace(i32) #4
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { noinline nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { noinline nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { nounwind }
+attributes #4 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
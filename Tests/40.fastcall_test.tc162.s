@@ -0,0 +1,62 @@
+	.text
+	.file	"40.fastcall_test.ll"
+	.align	5
+	.type	clamp,@function
+clamp:                                  # @clamp
+# BB#0:                                 # %entry
+	lt %d2, %d4, %d5
+	jnz %d2, .LBB0_2
+# BB#1:                                 # %entry
+	min %d5, %d4, %d6
+.LBB0_2:                                # %entry
+	mov %d2, %d5
+	fret
+.Lfunc_end0:
+	.size	clamp, .Lfunc_end0-clamp
+
+	.align	5
+	.type	scale,@function
+scale:                                  # @scale
+# BB#0:                                 # %entry
+	mul %d4, %d5
+	mov %d5, -1000
+	mov %d6, 1000
+	fcall clamp
+	fret
+.Lfunc_end1:
+	.size	scale, .Lfunc_end1-scale
+
+	.align	5
+	.type	report,@function
+report:                                 # @report
+# BB#0:                                 # %entry
+	mov %d15, %d4
+	call trace
+	add %d15, 1
+	mov %d2, %d15
+	ret
+.Lfunc_end2:
+	.size	report, .Lfunc_end2-report
+
+	.globl	run
+	.align	5
+	.type	run,@function
+run:                                    # @run
+# BB#0:                                 # %entry
+	mov %d15, %d5
+	fcall scale
+	mov %d3, %d2
+	mov %d5, 0
+	mov %d6, 255
+	mov %d4, %d15
+	fcall clamp
+	add %d2, %d3
+	mov %d4, %d2
+	call report
+	ret
+.Lfunc_end3:
+	.size	run, .Lfunc_end3-run
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,22 @@
+/*
+ * Interrupt handlers (llc).
+ *
+ * The interrupt has saved the upper context, so a leaf handler works in
+ * those registers, saves nothing and returns with RFE. A handler that makes a
+ * call saves the whole lower context with SVLCX and reloads it with RSLCX.
+ * A nested handler reopens higher priorities with BISR, which saves the
+ * lower context itself. A handler with a priority also gets its entry in
+ * .inttab.intvec.<prio>, a jump to the handler.
+ */
+extern volatile unsigned ticks;
+extern volatile unsigned rx_byte;
+extern void rx_push(unsigned);
+extern void can_dispatch(void);
+
+__attribute__((interrupt(10))) void stm_isr(void) { ticks = ticks + 1; }
+
+__attribute__((interrupt(20))) void asc_rx_isr(void) { rx_push(rx_byte); }
+
+__attribute__((interrupt(30), interrupt_nested)) void can_isr(void) {
+  can_dispatch();
+}
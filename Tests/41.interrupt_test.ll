@@ -0,0 +1,44 @@
+; ModuleID = '41.interrupt_test.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+@ticks = external global i32, align 4
+@rx_byte = external global i32, align 4
+
+; Function Attrs: nounwind
+define void @stm_isr() #0 {
+entry:
+  %0 = load volatile i32, i32* @ticks, align 4
+  %add = add i32 %0, 1
+  store volatile i32 %add, i32* @ticks, align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @asc_rx_isr() #1 {
+entry:
+  %0 = load volatile i32, i32* @rx_byte, align 4
+  call void @rx_push(i32 %0) #4
+  ret void
+}
+
+declare void @rx_push(i32) #3
+
+; Function Attrs: nounwind
+define void @can_isr() #2 {
+entry:
+  call void @can_dispatch() #4
+  ret void
+}
+
+declare void @can_dispatch() #3
+
+attributes #0 = { nounwind "interrupt"="10" "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind "interrupt"="20" "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind "interrupt"="30" "interrupt-nested" "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #4 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,67 @@
+	.text
+	.file	"41.interrupt_test.ll"
+	.globl	stm_isr
+	.align	1
+	.type	stm_isr,@function
+stm_isr:                                # @stm_isr
+# BB#0:                                 # %entry
+	movh %d15, hi:ticks
+	addi %d15, %d15, lo:ticks
+	mov.a %a15, %d15
+	ld.w %d8, [%a15] 0
+	mov.a %a15, %d15
+	add %d8, 1
+	st.w [%a15] 0, %d8
+	rfe
+	.section	.inttab.intvec.10,"ax",@progbits
+	.align	5
+	movh.a %a14, hi:stm_isr
+	lea %a14, [%a14] lo:stm_isr
+	ji %a14
+	.text
+.Lfunc_end0:
+	.size	stm_isr, .Lfunc_end0-stm_isr
+
+	.globl	asc_rx_isr
+	.align	1
+	.type	asc_rx_isr,@function
+asc_rx_isr:                             # @asc_rx_isr
+# BB#0:                                 # %entry
+	svlcx
+	movh %d15, hi:rx_byte
+	addi %d15, %d15, lo:rx_byte
+	mov.a %a15, %d15
+	ld.w %d4, [%a15] 0
+	call rx_push
+	rslcx
+	rfe
+	.section	.inttab.intvec.20,"ax",@progbits
+	.align	5
+	movh.a %a14, hi:asc_rx_isr
+	lea %a14, [%a14] lo:asc_rx_isr
+	ji %a14
+	.text
+.Lfunc_end1:
+	.size	asc_rx_isr, .Lfunc_end1-asc_rx_isr
+
+	.globl	can_isr
+	.align	1
+	.type	can_isr,@function
+can_isr:                                # @can_isr
+# BB#0:                                 # %entry
+	bisr 30
+	call can_dispatch
+	rslcx
+	rfe
+	.section	.inttab.intvec.30,"ax",@progbits
+	.align	5
+	movh.a %a14, hi:can_isr
+	lea %a14, [%a14] lo:can_isr
+	ji %a14
+	.text
+.Lfunc_end2:
+	.size	can_isr, .Lfunc_end2-can_isr
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,47 @@
+/*
+ * Branch reach (llc -show-mc-encoding).
+ *
+ * Each function skips a block of 4-byte stores when x is zero. The block
+ * is sized so the branch over it lands just past the reach of one form:
+ *
+ *   past_disp4    8 stores, a 34-byte jump: JNZ D15 widens from disp4
+ *                 (SBR) to disp8 (SB).
+ *   past_disp8    64 stores, a 258-byte jump: it widens to JNE D15, 0
+ *                 (BRC), disp15.
+ *   past_disp15   8191 stores, a 32768-byte jump: no conditional form
+ *                 reaches, so a disp4 JZ skips a disp24 J instead.
+ */
+#define R2(s) s s
+#define R4(s) R2(R2(s))
+#define R8(s) R2(R4(s))
+#define R16(s) R2(R8(s))
+#define R32(s) R2(R16(s))
+#define R64(s) R2(R32(s))
+#define R128(s) R2(R64(s))
+#define R256(s) R2(R128(s))
+#define R512(s) R2(R256(s))
+#define R1024(s) R2(R512(s))
+#define R2048(s) R2(R1024(s))
+#define R4096(s) R2(R2048(s))
+
+#define STORE p[1000] = x;
+
+void past_disp4(int x, volatile int *p) {
+  if (x) {
+    R8(STORE)
+  }
+}
+
+void past_disp8(int x, volatile int *p) {
+  if (x) {
+    R64(STORE)
+  }
+}
+
+void past_disp15(int x, volatile int *p) {
+  if (x) {
+    R4096(STORE) R2048(STORE) R1024(STORE) R512(STORE) R256(STORE)
+    R128(STORE) R64(STORE) R32(STORE) R16(STORE) R8(STORE) R4(STORE)
+    R2(STORE) STORE
+  }
+}
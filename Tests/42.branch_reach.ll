@@ -0,0 +1,8314 @@
+; ModuleID = '42.branch_reach.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define void @past_disp4(i32 %x, i32* %p) #0 {
+entry:
+  %tobool = icmp eq i32 %x, 0
+  br i1 %tobool, label %if.end, label %if.then
+
+if.then:                                          ; preds = %entry
+  %arrayidx = getelementptr inbounds i32, i32* %p, i32 1000
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  br label %if.end
+
+if.end:                                           ; preds = %if.then, %entry
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @past_disp8(i32 %x, i32* %p) #0 {
+entry:
+  %tobool = icmp eq i32 %x, 0
+  br i1 %tobool, label %if.end, label %if.then
+
+if.then:                                          ; preds = %entry
+  %arrayidx = getelementptr inbounds i32, i32* %p, i32 1000
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  br label %if.end
+
+if.end:                                           ; preds = %if.then, %entry
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @past_disp15(i32 %x, i32* %p) #0 {
+entry:
+  %tobool = icmp eq i32 %x, 0
+  br i1 %tobool, label %if.end, label %if.then
+
+if.then:                                          ; preds = %entry
+  %arrayidx = getelementptr inbounds i32, i32* %p, i32 1000
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  store volatile i32 %x, i32* %arrayidx, align 4
+  br label %if.end
+
+if.end:                                           ; preds = %if.then, %entry
+  ret void
+}
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,8312 @@
+	.text
+	.file	"42.branch_reach.ll"
+	.globl	past_disp4
+	.align	1
+	.type	past_disp4,@function
+past_disp4:                             # @past_disp4
+# BB#0:                                 # %entry
+	eq %d15, %d4, 0                 # encoding: [0x8b,0x04,0x00,0xf2]
+	jnz %d15, .LBB0_2               # encoding: [0xee,A]
+                                        #   fixup A - offset: 0, value: .LBB0_2, kind: fixup_tricore_disp8
+# BB#1:                                 # %if.then
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+.LBB0_2:                                # %if.end
+	ret                             # encoding: [0x00,0x90]
+.Lfunc_end0:
+	.size	past_disp4, .Lfunc_end0-past_disp4
+
+	.globl	past_disp8
+	.align	1
+	.type	past_disp8,@function
+past_disp8:                             # @past_disp8
+# BB#0:                                 # %entry
+	eq %d15, %d4, 0                 # encoding: [0x8b,0x04,0x00,0xf2]
+	jne %d15, 0, .LBB1_2            # encoding: [0xdf,0x0f,A,0b1AAAAAAA]
+                                        #   fixup A - offset: 0, value: .LBB1_2, kind: fixup_tricore_disp15
+# BB#1:                                 # %if.then
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+.LBB1_2:                                # %if.end
+	ret                             # encoding: [0x00,0x90]
+.Lfunc_end1:
+	.size	past_disp8, .Lfunc_end1-past_disp8
+
+	.globl	past_disp15
+	.align	1
+	.type	past_disp15,@function
+past_disp15:                            # @past_disp15
+# BB#0:                                 # %entry
+	eq %d15, %d4, 0                 # encoding: [0x8b,0x04,0x00,0xf2]
+	jz %d15, .LBB2_1                # encoding: [0x76,0b1111AAAA]
+                                        #   fixup A - offset: 0, value: .LBB2_1, kind: fixup_tricore_disp4
+	j .LBB2_2                       # encoding: [0x1d'A',A,A,A]
+                                        #   fixup A - offset: 0, value: .LBB2_2, kind: fixup_tricore_disp24
+.LBB2_1:                                # %if.then
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+	st.w [%a4] 4000, %d4            # encoding: [0x89,0x44,0x20,0xe9]
+.LBB2_2:                                # %if.end
+	ret                             # encoding: [0x00,0x90]
+.Lfunc_end2:
+	.size	past_disp15, .Lfunc_end2-past_disp15
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
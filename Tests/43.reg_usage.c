@@ -0,0 +1,26 @@
+/*
+ * Lower context registers across a call (llc).
+ *
+ * scale is compiled first and only writes D2, so sum_known keeps its
+ * values in D3-D7, its argument in D4 and the pointer w in A5 across the
+ * call, next to the upper context CALL saves anyway. ext_scale is not
+ * compiled here and may clobber the whole lower context: sum_unknown runs
+ * out of upper registers and spills four words around the call.
+ */
+extern int ext_scale(int);
+
+__attribute__((noinline)) int scale(int x) { return x * 3; }
+
+int sum_known(int *v, int *w) {
+  int a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5];
+  int g = v[6], h = v[7], i = v[8], j = v[9], k = v[10], l = v[11];
+  *w = scale(a) + b + c + d + e + f + g + h + i + j + k + l;
+  return a;
+}
+
+int sum_unknown(int *v, int *w) {
+  int a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5];
+  int g = v[6], h = v[7], i = v[8], j = v[9], k = v[10], l = v[11];
+  *w = ext_scale(a) + b + c + d + e + f + g + h + i + j + k + l;
+  return a;
+}
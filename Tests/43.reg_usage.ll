@@ -0,0 +1,107 @@
+; ModuleID = '43.reg_usage.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: noinline nounwind readnone
+define i32 @scale(i32 %x) #1 {
+entry:
+  %mul = mul nsw i32 %x, 3
+  ret i32 %mul
+}
+
+; Function Attrs: nounwind
+define i32 @sum_known(i32* %v, i32* %w) #0 {
+entry:
+  %arrayidx0 = getelementptr inbounds i32, i32* %v, i32 0
+  %0 = load i32, i32* %arrayidx0, align 4
+  %arrayidx1 = getelementptr inbounds i32, i32* %v, i32 1
+  %1 = load i32, i32* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32* %v, i32 2
+  %2 = load i32, i32* %arrayidx2, align 4
+  %arrayidx3 = getelementptr inbounds i32, i32* %v, i32 3
+  %3 = load i32, i32* %arrayidx3, align 4
+  %arrayidx4 = getelementptr inbounds i32, i32* %v, i32 4
+  %4 = load i32, i32* %arrayidx4, align 4
+  %arrayidx5 = getelementptr inbounds i32, i32* %v, i32 5
+  %5 = load i32, i32* %arrayidx5, align 4
+  %arrayidx6 = getelementptr inbounds i32, i32* %v, i32 6
+  %6 = load i32, i32* %arrayidx6, align 4
+  %arrayidx7 = getelementptr inbounds i32, i32* %v, i32 7
+  %7 = load i32, i32* %arrayidx7, align 4
+  %arrayidx8 = getelementptr inbounds i32, i32* %v, i32 8
+  %8 = load i32, i32* %arrayidx8, align 4
+  %arrayidx9 = getelementptr inbounds i32, i32* %v, i32 9
+  %9 = load i32, i32* %arrayidx9, align 4
+  %arrayidx10 = getelementptr inbounds i32, i32* %v, i32 10
+  %10 = load i32, i32* %arrayidx10, align 4
+  %arrayidx11 = getelementptr inbounds i32, i32* %v, i32 11
+  %11 = load i32, i32* %arrayidx11, align 4
+  %call = call i32 @scale(i32 %0) #2
+  %add1 = add nsw i32 %call, %1
+  %add2 = add nsw i32 %add1, %2
+  %add3 = add nsw i32 %add2, %3
+  %add4 = add nsw i32 %add3, %4
+  %add5 = add nsw i32 %add4, %5
+  %add6 = add nsw i32 %add5, %6
+  %add7 = add nsw i32 %add6, %7
+  %add8 = add nsw i32 %add7, %8
+  %add9 = add nsw i32 %add8, %9
+  %add10 = add nsw i32 %add9, %10
+  %add11 = add nsw i32 %add10, %11
+  store i32 %add11, i32* %w, align 4
+  ret i32 %0
+}
+
+; Function Attrs: nounwind
+define i32 @sum_unknown(i32* %v, i32* %w) #0 {
+entry:
+  %arrayidx0 = getelementptr inbounds i32, i32* %v, i32 0
+  %0 = load i32, i32* %arrayidx0, align 4
+  %arrayidx1 = getelementptr inbounds i32, i32* %v, i32 1
+  %1 = load i32, i32* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32* %v, i32 2
+  %2 = load i32, i32* %arrayidx2, align 4
+  %arrayidx3 = getelementptr inbounds i32, i32* %v, i32 3
+  %3 = load i32, i32* %arrayidx3, align 4
+  %arrayidx4 = getelementptr inbounds i32, i32* %v, i32 4
+  %4 = load i32, i32* %arrayidx4, align 4
+  %arrayidx5 = getelementptr inbounds i32, i32* %v, i32 5
+  %5 = load i32, i32* %arrayidx5, align 4
+  %arrayidx6 = getelementptr inbounds i32, i32* %v, i32 6
+  %6 = load i32, i32* %arrayidx6, align 4
+  %arrayidx7 = getelementptr inbounds i32, i32* %v, i32 7
+  %7 = load i32, i32* %arrayidx7, align 4
+  %arrayidx8 = getelementptr inbounds i32, i32* %v, i32 8
+  %8 = load i32, i32* %arrayidx8, align 4
+  %arrayidx9 = getelementptr inbounds i32, i32* %v, i32 9
+  %9 = load i32, i32* %arrayidx9, align 4
+  %arrayidx10 = getelementptr inbounds i32, i32* %v, i32 10
+  %10 = load i32, i32* %arrayidx10, align 4
+  %arrayidx11 = getelementptr inbounds i32, i32* %v, i32 11
+  %11 = load i32, i32* %arrayidx11, align 4
+  %call = call i32 @ext_scale(i32 %0) #2
+  %add1 = add nsw i32 %call, %1
+  %add2 = add nsw i32 %add1, %2
+  %add3 = add nsw i32 %add2, %3
+  %add4 = add nsw i32 %add3, %4
+  %add5 = add nsw i32 %add4, %5
+  %add6 = add nsw i32 %add5, %6
+  %add7 = add nsw i32 %add6, %7
+  %add8 = add nsw i32 %add7, %8
+  %add9 = add nsw i32 %add8, %9
+  %add10 = add nsw i32 %add9, %10
+  %add11 = add nsw i32 %add10, %11
+  store i32 %add11, i32* %w, align 4
+  ret i32 %0
+}
+
+declare i32 @ext_scale(i32) #3
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { noinline nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind }
+attributes #3 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,94 @@
+	.text
+	.file	"43.reg_usage.ll"
+	.globl	scale
+	.align	1
+	.type	scale,@function
+scale:                                  # @scale
+# BB#0:                                 # %entry
+	mul %d2, %d4, 3
+	ret
+.Lfunc_end0:
+	.size	scale, .Lfunc_end0-scale
+
+	.globl	sum_known
+	.align	1
+	.type	sum_known,@function
+sum_known:                              # @sum_known
+# BB#0:                                 # %entry
+	ld.w %d4, [%a4] 0
+	ld.w %d15, [%a4] 4
+	ld.w %d3, [%a4] 8
+	ld.w %d5, [%a4] 12
+	ld.w %d6, [%a4] 16
+	ld.w %d7, [%a4] 20
+	ld.w %d8, [%a4] 24
+	ld.w %d9, [%a4] 28
+	ld.w %d10, [%a4] 32
+	ld.w %d11, [%a4] 36
+	ld.w %d12, [%a4] 40
+	ld.w %d13, [%a4] 44
+	call scale
+	add %d15, %d2
+	add %d3, %d15
+	add %d5, %d3
+	add %d6, %d5
+	add %d7, %d6
+	add %d8, %d7
+	add %d9, %d8
+	add %d10, %d9
+	add %d11, %d10
+	add %d12, %d11
+	add %d13, %d12
+	st.w [%a5] 0, %d13
+	mov %d2, %d4
+	ret
+.Lfunc_end1:
+	.size	sum_known, .Lfunc_end1-sum_known
+
+	.globl	sum_unknown
+	.align	1
+	.type	sum_unknown,@function
+sum_unknown:                            # @sum_unknown
+# BB#0:                                 # %entry
+	sub.a %a10, 16
+	ld.w %d4, [%a4] 0
+	st.w [%a10] 12, %d4             # 4-byte Folded Spill
+	ld.w %d8, [%a4] 4
+	ld.w %d9, [%a4] 8
+	ld.w %d10, [%a4] 12
+	ld.w %d11, [%a4] 16
+	ld.w %d12, [%a4] 20
+	ld.w %d13, [%a4] 24
+	ld.w %d14, [%a4] 28
+	ld.w %d15, [%a4] 32
+	ld.w %d2, [%a4] 36
+	st.w [%a10] 0, %d2              # 4-byte Folded Spill
+	ld.w %d2, [%a4] 40
+	st.w [%a10] 4, %d2              # 4-byte Folded Spill
+	ld.w %d2, [%a4] 44
+	st.w [%a10] 8, %d2              # 4-byte Folded Spill
+	mov.aa %a15, %a5
+	call ext_scale
+	add %d8, %d2
+	add %d9, %d8
+	add %d10, %d9
+	add %d11, %d10
+	add %d12, %d11
+	add %d13, %d12
+	add %d14, %d13
+	add %d15, %d14
+	ld.w %d2, [%a10] 0              # 4-byte Folded Reload
+	add %d2, %d15
+	ld.w %d15, [%a10] 4             # 4-byte Folded Reload
+	add %d15, %d2
+	ld.w %d2, [%a10] 8              # 4-byte Folded Reload
+	add %d2, %d15
+	st.w [%a15] 0, %d2
+	ld.w %d2, [%a10] 12             # 4-byte Folded Reload
+	ret
+.Lfunc_end2:
+	.size	sum_unknown, .Lfunc_end2-sum_unknown
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
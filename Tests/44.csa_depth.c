@@ -0,0 +1,45 @@
+/*
+ * Inlining against the cost of CALL, and CSA use
+ * (opt -O2 | llc -tricore-print-csa-depth -tricore-csa-pool=6).
+ *
+ * A CALL and its RET move the 16-register upper context, so TriCore asks
+ * the inliner to count them as 8 more instructions. That tips the 6x4
+ * motor mixer: it is inlined into control_step here, where a target with
+ * the default call cost keeps both calls to mix.
+ *
+ * The report in 44.csa_depth.report lists the frames each call graph root
+ * may take off the free context list. main holds 3: its own, control_step
+ * and pwm_write. timer_isr takes 2 on entry, as it calls out and saves the
+ * lower context, and 2 more below it. On top of main that makes 7, more
+ * than the pool of 6, hence the warning.
+ */
+extern void pwm_write(int *);
+extern int sensor_read(int);
+
+int mixer[24], failsafe[24];
+int cmd[4], duty[6];
+
+#define ROW(r)                                                                 \
+  d[r] = m[4 * r] * c[0] + m[4 * r + 1] * c[1] + m[4 * r + 2] * c[2] +          \
+         m[4 * r + 3] * c[3];
+
+void mix(const int *m, const int *c, int *d) {
+  ROW(0) ROW(1) ROW(2) ROW(3) ROW(4) ROW(5)
+}
+
+void control_step(void) {
+  mix(mixer, cmd, duty);
+  if (duty[0] > 4000)
+    mix(failsafe, cmd, duty);
+  pwm_write(duty);
+}
+
+int main(void) {
+  for (;;)
+    control_step();
+}
+
+__attribute__((interrupt(3))) void timer_isr(void) {
+  cmd[0] = sensor_read(0);
+  control_step();
+}
@@ -0,0 +1,172 @@
+; ModuleID = '44.csa_depth.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+@mixer = common global [24 x i32] zeroinitializer, align 4
+@failsafe = common global [24 x i32] zeroinitializer, align 4
+@cmd = common global [4 x i32] zeroinitializer, align 4
+@duty = common global [6 x i32] zeroinitializer, align 4
+
+; Function Attrs: nounwind
+define void @mix(i32* nocapture readonly %m, i32* nocapture readonly %c, i32* nocapture %d) #0 {
+entry:
+  %0 = load i32, i32* %c, align 4
+  %arrayidx1 = getelementptr inbounds i32, i32* %c, i32 1
+  %1 = load i32, i32* %arrayidx1, align 4
+  %arrayidx2 = getelementptr inbounds i32, i32* %c, i32 2
+  %2 = load i32, i32* %arrayidx2, align 4
+  %arrayidx3 = getelementptr inbounds i32, i32* %c, i32 3
+  %3 = load i32, i32* %arrayidx3, align 4
+  %4 = load i32, i32* %m, align 4
+  %mul0 = mul nsw i32 %4, %0
+  %m1 = getelementptr inbounds i32, i32* %m, i32 1
+  %5 = load i32, i32* %m1, align 4
+  %mul1 = mul nsw i32 %5, %1
+  %add1 = add nsw i32 %mul0, %mul1
+  %m2 = getelementptr inbounds i32, i32* %m, i32 2
+  %6 = load i32, i32* %m2, align 4
+  %mul2 = mul nsw i32 %6, %2
+  %add2 = add nsw i32 %add1, %mul2
+  %m3 = getelementptr inbounds i32, i32* %m, i32 3
+  %7 = load i32, i32* %m3, align 4
+  %mul3 = mul nsw i32 %7, %3
+  %add3 = add nsw i32 %add2, %mul3
+  store i32 %add3, i32* %d, align 4
+  %m4 = getelementptr inbounds i32, i32* %m, i32 4
+  %8 = load i32, i32* %m4, align 4
+  %mul4 = mul nsw i32 %8, %0
+  %m5 = getelementptr inbounds i32, i32* %m, i32 5
+  %9 = load i32, i32* %m5, align 4
+  %mul5 = mul nsw i32 %9, %1
+  %add5 = add nsw i32 %mul4, %mul5
+  %m6 = getelementptr inbounds i32, i32* %m, i32 6
+  %10 = load i32, i32* %m6, align 4
+  %mul6 = mul nsw i32 %10, %2
+  %add6 = add nsw i32 %add5, %mul6
+  %m7 = getelementptr inbounds i32, i32* %m, i32 7
+  %11 = load i32, i32* %m7, align 4
+  %mul7 = mul nsw i32 %11, %3
+  %add7 = add nsw i32 %add6, %mul7
+  %d1 = getelementptr inbounds i32, i32* %d, i32 1
+  store i32 %add7, i32* %d1, align 4
+  %m8 = getelementptr inbounds i32, i32* %m, i32 8
+  %12 = load i32, i32* %m8, align 4
+  %mul8 = mul nsw i32 %12, %0
+  %m9 = getelementptr inbounds i32, i32* %m, i32 9
+  %13 = load i32, i32* %m9, align 4
+  %mul9 = mul nsw i32 %13, %1
+  %add9 = add nsw i32 %mul8, %mul9
+  %m10 = getelementptr inbounds i32, i32* %m, i32 10
+  %14 = load i32, i32* %m10, align 4
+  %mul10 = mul nsw i32 %14, %2
+  %add10 = add nsw i32 %add9, %mul10
+  %m11 = getelementptr inbounds i32, i32* %m, i32 11
+  %15 = load i32, i32* %m11, align 4
+  %mul11 = mul nsw i32 %15, %3
+  %add11 = add nsw i32 %add10, %mul11
+  %d2 = getelementptr inbounds i32, i32* %d, i32 2
+  store i32 %add11, i32* %d2, align 4
+  %m12 = getelementptr inbounds i32, i32* %m, i32 12
+  %16 = load i32, i32* %m12, align 4
+  %mul12 = mul nsw i32 %16, %0
+  %m13 = getelementptr inbounds i32, i32* %m, i32 13
+  %17 = load i32, i32* %m13, align 4
+  %mul13 = mul nsw i32 %17, %1
+  %add13 = add nsw i32 %mul12, %mul13
+  %m14 = getelementptr inbounds i32, i32* %m, i32 14
+  %18 = load i32, i32* %m14, align 4
+  %mul14 = mul nsw i32 %18, %2
+  %add14 = add nsw i32 %add13, %mul14
+  %m15 = getelementptr inbounds i32, i32* %m, i32 15
+  %19 = load i32, i32* %m15, align 4
+  %mul15 = mul nsw i32 %19, %3
+  %add15 = add nsw i32 %add14, %mul15
+  %d3 = getelementptr inbounds i32, i32* %d, i32 3
+  store i32 %add15, i32* %d3, align 4
+  %m16 = getelementptr inbounds i32, i32* %m, i32 16
+  %20 = load i32, i32* %m16, align 4
+  %mul16 = mul nsw i32 %20, %0
+  %m17 = getelementptr inbounds i32, i32* %m, i32 17
+  %21 = load i32, i32* %m17, align 4
+  %mul17 = mul nsw i32 %21, %1
+  %add17 = add nsw i32 %mul16, %mul17
+  %m18 = getelementptr inbounds i32, i32* %m, i32 18
+  %22 = load i32, i32* %m18, align 4
+  %mul18 = mul nsw i32 %22, %2
+  %add18 = add nsw i32 %add17, %mul18
+  %m19 = getelementptr inbounds i32, i32* %m, i32 19
+  %23 = load i32, i32* %m19, align 4
+  %mul19 = mul nsw i32 %23, %3
+  %add19 = add nsw i32 %add18, %mul19
+  %d4 = getelementptr inbounds i32, i32* %d, i32 4
+  store i32 %add19, i32* %d4, align 4
+  %m20 = getelementptr inbounds i32, i32* %m, i32 20
+  %24 = load i32, i32* %m20, align 4
+  %mul20 = mul nsw i32 %24, %0
+  %m21 = getelementptr inbounds i32, i32* %m, i32 21
+  %25 = load i32, i32* %m21, align 4
+  %mul21 = mul nsw i32 %25, %1
+  %add21 = add nsw i32 %mul20, %mul21
+  %m22 = getelementptr inbounds i32, i32* %m, i32 22
+  %26 = load i32, i32* %m22, align 4
+  %mul22 = mul nsw i32 %26, %2
+  %add22 = add nsw i32 %add21, %mul22
+  %m23 = getelementptr inbounds i32, i32* %m, i32 23
+  %27 = load i32, i32* %m23, align 4
+  %mul23 = mul nsw i32 %27, %3
+  %add23 = add nsw i32 %add22, %mul23
+  %d5 = getelementptr inbounds i32, i32* %d, i32 5
+  store i32 %add23, i32* %d5, align 4
+  ret void
+}
+
+; Function Attrs: nounwind
+define void @control_step() #1 {
+entry:
+  call void @mix(i32* getelementptr inbounds ([24 x i32], [24 x i32]* @mixer, i32 0, i32 0), i32* getelementptr inbounds ([4 x i32], [4 x i32]* @cmd, i32 0, i32 0), i32* getelementptr inbounds ([6 x i32], [6 x i32]* @duty, i32 0, i32 0)) #3
+  %0 = load i32, i32* getelementptr inbounds ([6 x i32], [6 x i32]* @duty, i32 0, i32 0), align 4
+  %cmp = icmp sgt i32 %0, 4000
+  br i1 %cmp, label %if.then, label %if.end
+
+if.then:                                          ; preds = %entry
+  call void @mix(i32* getelementptr inbounds ([24 x i32], [24 x i32]* @failsafe, i32 0, i32 0), i32* getelementptr inbounds ([4 x i32], [4 x i32]* @cmd, i32 0, i32 0), i32* getelementptr inbounds ([6 x i32], [6 x i32]* @duty, i32 0, i32 0)) #3
+  br label %if.end
+
+if.end:                                           ; preds = %if.then, %entry
+  call void @pwm_write(i32* getelementptr inbounds ([6 x i32], [6 x i32]* @duty, i32 0, i32 0)) #3
+  ret void
+}
+
+declare void @pwm_write(i32*) #2
+
+; Function Attrs: noreturn nounwind
+define i32 @main() #4 {
+entry:
+  br label %for.cond
+
+for.cond:                                         ; preds = %for.cond, %entry
+  call void @control_step() #3
+  br label %for.cond
+}
+
+; Function Attrs: nounwind
+define void @timer_isr() #5 {
+entry:
+  %call = call i32 @sensor_read(i32 0) #3
+  store i32 %call, i32* getelementptr inbounds ([4 x i32], [4 x i32]* @cmd, i32 0, i32 0), align 4
+  call void @control_step() #3
+  ret void
+}
+
+declare i32 @sensor_read(i32) #2
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { nounwind }
+attributes #4 = { noreturn nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #5 = { nounwind "interrupt"="3" "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,492 @@
+	.text
+	.file	"<stdin>"
+	.globl	mix
+	.align	1
+	.type	mix,@function
+mix:                                    # @mix
+# BB#0:                                 # %entry
+	ld.w %d4, [%a5] 0
+	ld.w %d3, [%a5] 4
+	ld.w %d5, [%a4] 0
+	ld.w %d15, [%a5] 8
+	ld.w %d6, [%a4] 4
+	ld.w %d2, [%a5] 12
+	mul %d5, %d4
+	ld.w %d7, [%a4] 8
+	mul %d6, %d3
+	ld.w %d8, [%a4] 12
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d2
+	add %d8, %d7
+	st.w [%a6] 0, %d8
+	ld.w %d5, [%a4] 16
+	ld.w %d6, [%a4] 20
+	mul %d5, %d4
+	ld.w %d7, [%a4] 24
+	mul %d6, %d3
+	ld.w %d8, [%a4] 28
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d2
+	add %d8, %d7
+	st.w [%a6] 4, %d8
+	ld.w %d5, [%a4] 32
+	ld.w %d6, [%a4] 36
+	mul %d5, %d4
+	ld.w %d7, [%a4] 40
+	mul %d6, %d3
+	ld.w %d8, [%a4] 44
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d2
+	add %d8, %d7
+	st.w [%a6] 8, %d8
+	ld.w %d5, [%a4] 48
+	ld.w %d6, [%a4] 52
+	mul %d5, %d4
+	ld.w %d7, [%a4] 56
+	mul %d6, %d3
+	ld.w %d8, [%a4] 60
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d2
+	add %d8, %d7
+	st.w [%a6] 12, %d8
+	ld.w %d5, [%a4] 64
+	ld.w %d6, [%a4] 68
+	mul %d5, %d4
+	ld.w %d7, [%a4] 72
+	mul %d6, %d3
+	ld.w %d8, [%a4] 76
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d2
+	add %d8, %d7
+	st.w [%a6] 16, %d8
+	ld.w %d5, [%a4] 80
+	ld.w %d6, [%a4] 84
+	mul %d5, %d4
+	ld.w %d4, [%a4] 88
+	mul %d6, %d3
+	ld.w %d3, [%a4] 92
+	add %d5, %d6
+	mul %d4, %d15
+	add %d4, %d5
+	mul %d3, %d2
+	add %d3, %d4
+	st.w [%a6] 20, %d3
+	ret
+.Lfunc_end0:
+	.size	mix, .Lfunc_end0-mix
+
+	.globl	control_step
+	.align	1
+	.type	control_step,@function
+control_step:                           # @control_step
+# BB#0:                                 # %entry
+	movh %d15, hi:cmd
+	addi %d15, %d15, lo:cmd
+	mov.a %a15, %d15
+	movh %d15, hi:cmd+4
+	addi %d15, %d15, lo:cmd+4
+	ld.w %d3, [%a15] 0
+	mov.a %a15, %d15
+	movh %d15, hi:cmd+8
+	addi %d15, %d15, lo:cmd+8
+	ld.w %d2, [%a15] 0
+	mov.a %a15, %d15
+	ld.w %d15, [%a15] 0
+	movh %d4, hi:mixer
+	addi %d4, %d4, lo:mixer
+	movh %d5, hi:cmd+12
+	addi %d5, %d5, lo:cmd+12
+	mov.a %a15, %d4
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d5
+	movh %d5, hi:mixer+4
+	addi %d5, %d5, lo:mixer+4
+	ld.w %d4, [%a15] 0
+	mov.a %a15, %d5
+	ld.w %d7, [%a15] 0
+	movh %d5, hi:mixer+8
+	addi %d5, %d5, lo:mixer+8
+	mul %d6, %d3
+	mov.a %a15, %d5
+	ld.w %d8, [%a15] 0
+	movh %d5, hi:mixer+12
+	addi %d5, %d5, lo:mixer+12
+	mul %d7, %d2
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d5, %d4
+	add %d5, %d8
+	movh %d6, hi:mixer+16
+	addi %d6, %d6, lo:mixer+16
+	movh %d7, hi:duty
+	addi %d7, %d7, lo:duty
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d7
+	movh %d7, hi:mixer+20
+	addi %d7, %d7, lo:mixer+20
+	st.w [%a15] 0, %d5
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:mixer+24
+	addi %d8, %d8, lo:mixer+24
+	mul %d6, %d3
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	movh %d9, hi:mixer+28
+	addi %d9, %d9, lo:mixer+28
+	mul %d7, %d2
+	mov.a %a15, %d9
+	ld.w %d9, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d9, %d4
+	add %d9, %d8
+	movh %d6, hi:mixer+32
+	addi %d6, %d6, lo:mixer+32
+	movh %d7, hi:duty+4
+	addi %d7, %d7, lo:duty+4
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d7
+	movh %d7, hi:mixer+36
+	addi %d7, %d7, lo:mixer+36
+	st.w [%a15] 0, %d9
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:mixer+40
+	addi %d8, %d8, lo:mixer+40
+	mul %d6, %d3
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	movh %d9, hi:mixer+44
+	addi %d9, %d9, lo:mixer+44
+	mul %d7, %d2
+	mov.a %a15, %d9
+	ld.w %d9, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d9, %d4
+	add %d9, %d8
+	movh %d6, hi:mixer+48
+	addi %d6, %d6, lo:mixer+48
+	movh %d7, hi:duty+8
+	addi %d7, %d7, lo:duty+8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d7
+	movh %d7, hi:mixer+52
+	addi %d7, %d7, lo:mixer+52
+	st.w [%a15] 0, %d9
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:mixer+56
+	addi %d8, %d8, lo:mixer+56
+	mul %d6, %d3
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	movh %d9, hi:mixer+60
+	addi %d9, %d9, lo:mixer+60
+	mul %d7, %d2
+	mov.a %a15, %d9
+	ld.w %d9, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d9, %d4
+	add %d9, %d8
+	movh %d6, hi:mixer+64
+	addi %d6, %d6, lo:mixer+64
+	movh %d7, hi:duty+12
+	addi %d7, %d7, lo:duty+12
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d7
+	movh %d7, hi:mixer+68
+	addi %d7, %d7, lo:mixer+68
+	st.w [%a15] 0, %d9
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:mixer+72
+	addi %d8, %d8, lo:mixer+72
+	mul %d6, %d3
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	movh %d9, hi:mixer+76
+	addi %d9, %d9, lo:mixer+76
+	mul %d7, %d2
+	mov.a %a15, %d9
+	ld.w %d9, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d9, %d4
+	add %d9, %d8
+	movh %d6, hi:mixer+80
+	addi %d6, %d6, lo:mixer+80
+	movh %d7, hi:duty+16
+	addi %d7, %d7, lo:duty+16
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	mov.a %a15, %d7
+	movh %d7, hi:mixer+84
+	addi %d7, %d7, lo:mixer+84
+	st.w [%a15] 0, %d9
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:mixer+88
+	addi %d8, %d8, lo:mixer+88
+	mul %d6, %d3
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	movh %d9, hi:mixer+92
+	addi %d9, %d9, lo:mixer+92
+	mul %d7, %d2
+	mov.a %a15, %d9
+	ld.w %d9, [%a15] 0
+	add %d6, %d7
+	mul %d8, %d15
+	add %d8, %d6
+	mul %d9, %d4
+	movh %d6, hi:duty+20
+	addi %d6, %d6, lo:duty+20
+	add %d9, %d8
+	mov.a %a15, %d6
+	st.w [%a15] 0, %d9
+	mov %d6, 4001
+	lt %d5, %d5, %d6
+	jne %d5, 0, .LBB1_2
+# BB#1:                                 # %if.then
+	movh %d5, hi:failsafe
+	addi %d5, %d5, lo:failsafe
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	movh %d6, hi:failsafe+4
+	addi %d6, %d6, lo:failsafe+4
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+8
+	addi %d7, %d7, lo:failsafe+8
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:failsafe+12
+	addi %d8, %d8, lo:failsafe+12
+	mul %d6, %d2
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d4
+	add %d8, %d7
+	movh %d5, hi:failsafe+16
+	addi %d5, %d5, lo:failsafe+16
+	movh %d6, hi:duty
+	addi %d6, %d6, lo:duty
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d6
+	movh %d6, hi:failsafe+20
+	addi %d6, %d6, lo:failsafe+20
+	st.w [%a15] 0, %d8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+24
+	addi %d7, %d7, lo:failsafe+24
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:failsafe+28
+	addi %d8, %d8, lo:failsafe+28
+	mul %d6, %d2
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d4
+	add %d8, %d7
+	movh %d5, hi:failsafe+32
+	addi %d5, %d5, lo:failsafe+32
+	movh %d6, hi:duty+4
+	addi %d6, %d6, lo:duty+4
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d6
+	movh %d6, hi:failsafe+36
+	addi %d6, %d6, lo:failsafe+36
+	st.w [%a15] 0, %d8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+40
+	addi %d7, %d7, lo:failsafe+40
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:failsafe+44
+	addi %d8, %d8, lo:failsafe+44
+	mul %d6, %d2
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d4
+	add %d8, %d7
+	movh %d5, hi:failsafe+48
+	addi %d5, %d5, lo:failsafe+48
+	movh %d6, hi:duty+8
+	addi %d6, %d6, lo:duty+8
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d6
+	movh %d6, hi:failsafe+52
+	addi %d6, %d6, lo:failsafe+52
+	st.w [%a15] 0, %d8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+56
+	addi %d7, %d7, lo:failsafe+56
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:failsafe+60
+	addi %d8, %d8, lo:failsafe+60
+	mul %d6, %d2
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d4
+	add %d8, %d7
+	movh %d5, hi:failsafe+64
+	addi %d5, %d5, lo:failsafe+64
+	movh %d6, hi:duty+12
+	addi %d6, %d6, lo:duty+12
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d6
+	movh %d6, hi:failsafe+68
+	addi %d6, %d6, lo:failsafe+68
+	st.w [%a15] 0, %d8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+72
+	addi %d7, %d7, lo:failsafe+72
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d7, [%a15] 0
+	movh %d8, hi:failsafe+76
+	addi %d8, %d8, lo:failsafe+76
+	mul %d6, %d2
+	mov.a %a15, %d8
+	ld.w %d8, [%a15] 0
+	add %d5, %d6
+	mul %d7, %d15
+	add %d7, %d5
+	mul %d8, %d4
+	add %d8, %d7
+	movh %d5, hi:failsafe+80
+	addi %d5, %d5, lo:failsafe+80
+	movh %d6, hi:duty+16
+	addi %d6, %d6, lo:duty+16
+	mov.a %a15, %d5
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d6
+	movh %d6, hi:failsafe+84
+	addi %d6, %d6, lo:failsafe+84
+	st.w [%a15] 0, %d8
+	mov.a %a15, %d6
+	ld.w %d6, [%a15] 0
+	movh %d7, hi:failsafe+88
+	addi %d7, %d7, lo:failsafe+88
+	mul %d5, %d3
+	mov.a %a15, %d7
+	ld.w %d3, [%a15] 0
+	movh %d7, hi:failsafe+92
+	addi %d7, %d7, lo:failsafe+92
+	mul %d6, %d2
+	mov.a %a15, %d7
+	ld.w %d2, [%a15] 0
+	add %d5, %d6
+	mul %d3, %d15
+	add %d3, %d5
+	mul %d2, %d4
+	movh %d15, hi:duty+20
+	addi %d15, %d15, lo:duty+20
+	add %d2, %d3
+	mov.a %a15, %d15
+	st.w [%a15] 0, %d2
+.LBB1_2:                                # %if.end
+	movh %d15, hi:duty
+	addi %d15, %d15, lo:duty
+	mov.a %a4, %d15
+	call pwm_write
+	ret
+.Lfunc_end1:
+	.size	control_step, .Lfunc_end1-control_step
+
+	.globl	main
+	.align	1
+	.type	main,@function
+main:                                   # @main
+# BB#0:                                 # %entry
+.LBB2_1:                                # %for.cond
+                                        # =>This Inner Loop Header: Depth=1
+	call control_step
+	j .LBB2_1
+.Lfunc_end2:
+	.size	main, .Lfunc_end2-main
+
+	.globl	timer_isr
+	.align	1
+	.type	timer_isr,@function
+timer_isr:                              # @timer_isr
+# BB#0:                                 # %entry
+	svlcx
+	mov %d4, 0
+	call sensor_read
+	movh %d15, hi:cmd
+	addi %d15, %d15, lo:cmd
+	mov.a %a15, %d15
+	st.w [%a15] 0, %d2
+	call control_step
+	rslcx
+	rfe
+	.section	.inttab.intvec.3,"ax",@progbits
+	.align	5
+	movh.a %a14, hi:timer_isr
+	lea %a14, [%a14] lo:timer_isr
+	ji %a14
+	.text
+.Lfunc_end3:
+	.size	timer_isr, .Lfunc_end3-timer_isr
+
+	.type	mixer,@object           # @mixer
+	.comm	mixer,96,4
+	.type	failsafe,@object        # @failsafe
+	.comm	failsafe,96,4
+	.type	cmd,@object             # @cmd
+	.comm	cmd,16,4
+	.type	duty,@object            # @duty
+	.comm	duty,24,4
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
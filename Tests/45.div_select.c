@@ -0,0 +1,22 @@
+/*
+ * Division by core (llc -mcpu=tc13, llc -mcpu=tc162, and llc).
+ *
+ * TC1.3 has no divide instruction, so 45.div_select.tc13.s calls
+ * __divsi3, __udivsi3 and __umodsi3. From TC1.6 on, DIV and DIV.U leave
+ * the quotient in the even and the remainder in the odd register of a
+ * pair, so split in 45.div_select.tc162.s gets both from one DIV.U.
+ *
+ * Without -mcpu, each function is compiled for the core of its target-cpu
+ * attribute: average_tc162 uses DIV in 45.div_select.s while the rest stay
+ * on the generic core. llc -mcpu replaces the attribute on every function.
+ */
+int average(int sum, int n) { return sum / n; }
+
+unsigned split(unsigned x, unsigned base, unsigned *rem) {
+  *rem = x % base;
+  return x / base;
+}
+
+__attribute__((target("arch=tc162"))) int average_tc162(int sum, int n) {
+  return sum / n;
+}
@@ -0,0 +1,34 @@
+; ModuleID = '45.div_select.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @average(i32 %sum, i32 %n) #0 {
+entry:
+  %div = sdiv i32 %sum, %n
+  ret i32 %div
+}
+
+; Function Attrs: nounwind
+define i32 @split(i32 %x, i32 %base, i32* nocapture %rem) #1 {
+entry:
+  %div = udiv i32 %x, %base
+  %rem1 = urem i32 %x, %base
+  store i32 %rem1, i32* %rem, align 4
+  ret i32 %div
+}
+
+; Function Attrs: nounwind readnone
+define i32 @average_tc162(i32 %sum, i32 %n) #2 {
+entry:
+  %div = sdiv i32 %sum, %n
+  ret i32 %div
+}
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind readnone "target-cpu"="tc162" "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,44 @@
+	.text
+	.file	"45.div_select.ll"
+	.globl	average
+	.align	3
+	.type	average,@function
+average:                                # @average
+# BB#0:                                 # %entry
+	call __divsi3
+	ret
+.Lfunc_end0:
+	.size	average, .Lfunc_end0-average
+
+	.globl	split
+	.align	3
+	.type	split,@function
+split:                                  # @split
+# BB#0:                                 # %entry
+	mov.aa %a15, %a4
+	mov %d15, %d5
+	mov %d8, %d4
+	call __udivsi3
+	mov %d9, %d2
+	mov %d4, %d8
+	mov %d5, %d15
+	call __umodsi3
+	st.w [%a15] 0, %d2
+	mov %d2, %d9
+	ret
+.Lfunc_end1:
+	.size	split, .Lfunc_end1-split
+
+	.globl	average_tc162
+	.align	3
+	.type	average_tc162,@function
+average_tc162:                          # @average_tc162
+# BB#0:                                 # %entry
+	call __divsi3
+	ret
+.Lfunc_end2:
+	.size	average_tc162, .Lfunc_end2-average_tc162
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,36 @@
+	.text
+	.file	"45.div_select.ll"
+	.globl	average
+	.align	5
+	.type	average,@function
+average:                                # @average
+# BB#0:                                 # %entry
+	div %e2, %d4, %d5
+	ret
+.Lfunc_end0:
+	.size	average, .Lfunc_end0-average
+
+	.globl	split
+	.align	5
+	.type	split,@function
+split:                                  # @split
+# BB#0:                                 # %entry
+	div.u %e2, %d4, %d5
+	st.w [%a4] 0, %d3
+	ret
+.Lfunc_end1:
+	.size	split, .Lfunc_end1-split
+
+	.globl	average_tc162
+	.align	5
+	.type	average_tc162,@function
+average_tc162:                          # @average_tc162
+# BB#0:                                 # %entry
+	div %e2, %d4, %d5
+	ret
+.Lfunc_end2:
+	.size	average_tc162, .Lfunc_end2-average_tc162
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,27 @@
+/*
+ * Code alignment on the performance cores (llc -mcpu=tc16p; tc18 gives the
+ * same code).
+ *
+ * Functions start on a 256-bit cache line and loops on a 64-bit fetch
+ * boundary, `.align 5` and `.align 3` in 46.code_align.s, where the
+ * argument is the power of two. 46.code_align.dump is the disassembled
+ * object: the assembler pads with 32-bit NOPs and one 16-bit NOP for an odd
+ * halfword, e.g. the 26 bytes after clamp0.
+ *
+ * With -tricore-align-small-loops, 46.code_align.small_loops.s, only the
+ * loop of sum, which fits in the 32-byte fetch buffer, stays aligned; the
+ * loop of blend is longer and loses its padding.
+ */
+int clamp0(int x) { return x > 0 ? x : 0; }
+
+int sum(const int *p, int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    s += p[i];
+  return s;
+}
+
+void blend(int *d, const int *a, const int *b, int n) {
+  for (int i = 0; i < n; i++)
+    d[i] = ((((a[i] * 3 + b[i] * 5) >> 3) ^ a[i]) - d[i]) & 0xffff;
+}
@@ -0,0 +1,70 @@
+; ModuleID = '46.code_align.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @clamp0(i32 %x) #1 {
+entry:
+  %cmp = icmp sgt i32 %x, 0
+  %cond = select i1 %cmp, i32 %x, i32 0
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readonly
+define i32 @sum(i32* nocapture readonly %p, i32 %n) #0 {
+entry:
+  %cmp4 = icmp sgt i32 %n, 0
+  br i1 %cmp4, label %for.body, label %for.end
+
+for.body:                                         ; preds = %entry, %for.body
+  %i.06 = phi i32 [ %inc, %for.body ], [ 0, %entry ]
+  %s.05 = phi i32 [ %add, %for.body ], [ 0, %entry ]
+  %arrayidx = getelementptr inbounds i32, i32* %p, i32 %i.06
+  %0 = load i32, i32* %arrayidx, align 4
+  %add = add nsw i32 %0, %s.05
+  %inc = add nuw nsw i32 %i.06, 1
+  %exitcond = icmp eq i32 %inc, %n
+  br i1 %exitcond, label %for.end, label %for.body
+
+for.end:                                          ; preds = %for.body, %entry
+  %s.0.lcssa = phi i32 [ 0, %entry ], [ %add, %for.body ]
+  ret i32 %s.0.lcssa
+}
+
+; Function Attrs: nounwind
+define void @blend(i32* nocapture %d, i32* nocapture readonly %a, i32* nocapture readonly %b, i32 %n) #2 {
+entry:
+  %cmp25 = icmp sgt i32 %n, 0
+  br i1 %cmp25, label %for.body, label %for.end
+
+for.body:                                         ; preds = %entry, %for.body
+  %i.026 = phi i32 [ %inc, %for.body ], [ 0, %entry ]
+  %arrayidx = getelementptr inbounds i32, i32* %a, i32 %i.026
+  %0 = load i32, i32* %arrayidx, align 4
+  %arrayidx1 = getelementptr inbounds i32, i32* %b, i32 %i.026
+  %1 = load i32, i32* %arrayidx1, align 4
+  %mul = mul nsw i32 %0, 3
+  %mul2 = mul nsw i32 %1, 5
+  %add = add nsw i32 %mul2, %mul
+  %shr = ashr i32 %add, 3
+  %xor = xor i32 %shr, %0
+  %arrayidx3 = getelementptr inbounds i32, i32* %d, i32 %i.026
+  %2 = load i32, i32* %arrayidx3, align 4
+  %sub = sub nsw i32 %xor, %2
+  %and = and i32 %sub, 65535
+  store i32 %and, i32* %arrayidx3, align 4
+  %inc = add nuw nsw i32 %i.026, 1
+  %exitcond = icmp eq i32 %inc, %n
+  br i1 %exitcond, label %for.end, label %for.body
+
+for.end:                                          ; preds = %for.body, %entry
+  ret void
+}
+
+attributes #0 = { nounwind readonly "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,74 @@
+	.text
+	.file	"46.code_align.ll"
+	.globl	clamp0
+	.align	5
+	.type	clamp0,@function
+clamp0:                                 # @clamp0
+# BB#0:                                 # %entry
+	max %d2, %d4, 0
+	ret
+.Lfunc_end0:
+	.size	clamp0, .Lfunc_end0-clamp0
+
+	.globl	sum
+	.align	5
+	.type	sum,@function
+sum:                                    # @sum
+# BB#0:                                 # %entry
+	mov %d2, 0
+	lt %d3, %d4, 1
+	mov.d %d15, %a4
+	jnz %d3, .LBB1_2
+	.align	3
+.LBB1_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov.a %a15, %d15
+	ld.w %d3, [%a15] 0
+	add %d2, %d3
+	add %d15, 4
+	jned %d4, 1, .LBB1_1
+.LBB1_2:                                # %for.end
+	ret
+.Lfunc_end1:
+	.size	sum, .Lfunc_end1-sum
+
+	.globl	blend
+	.align	5
+	.type	blend,@function
+blend:                                  # @blend
+# BB#0:                                 # %entry
+	lt %d5, %d4, 1
+	mov.d %d15, %a5
+	mov.d %d2, %a6
+	mov.d %d3, %a4
+	jne %d5, 0, .LBB2_2
+.LBB2_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov.a %a15, %d15
+	ld.w %d5, [%a15] 0
+	mov.a %a15, %d2
+	ld.w %d6, [%a15] 0
+	mul %d7, %d5, 3
+	mul %d6, %d6, 5
+	add %d7, %d6
+	sh %d6, %d7, -3
+	mov.a %a15, %d3
+	ld.w %d7, [%a15] 0
+	xor %d5, %d6, %d5
+	sub %d5, %d7
+	mov.u %d6, 65535
+	and %d5, %d6
+	mov.a %a15, %d3
+	st.w [%a15] 0, %d5
+	add %d3, 4
+	add %d2, 4
+	add %d15, 4
+	jned %d4, 1, .LBB2_1
+.LBB2_2:                                # %for.end
+	ret
+.Lfunc_end2:
+	.size	blend, .Lfunc_end2-blend
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,49 @@
+/*
+ * Saturating clamps (llc).
+ *
+ * Clamps to the byte and halfword ranges become SAT.B, SAT.BU, SAT.H and
+ * SAT.HU. A 32-bit add or subtract done in 64 bits and clamped back to 32
+ * bits becomes ADDS, ADDS.U, SUBS or SUBS.U. gain clamps to a range no SAT
+ * covers and keeps MAX and MIN.
+ */
+int sat_s8(int x) {
+  int lo = x > -128 ? x : -128;
+  return lo < 127 ? lo : 127;
+}
+
+unsigned sat_u8(unsigned x) { return x < 255 ? x : 255; }
+
+int sat_s16(int x) {
+  int lo = x > -32768 ? x : -32768;
+  return lo < 32767 ? lo : 32767;
+}
+
+unsigned sat_u16(unsigned x) { return x < 65535 ? x : 65535; }
+
+int add_sat(int a, int b) {
+  long long s = (long long)b + a;
+  long long lo = s > -2147483648LL ? s : -2147483648LL;
+  return lo < 2147483647LL ? lo : 2147483647LL;
+}
+
+unsigned add_sat_u(unsigned a, unsigned b) {
+  unsigned long long s = (unsigned long long)b + a;
+  return s < 0xffffffffULL ? s : 0xffffffffULL;
+}
+
+int sub_sat(int a, int b) {
+  long long s = (long long)a - b;
+  long long lo = s > -2147483648LL ? s : -2147483648LL;
+  return lo < 2147483647LL ? lo : 2147483647LL;
+}
+
+unsigned sub_sat_u(unsigned a, unsigned b) {
+  long long s = (long long)a - b;
+  return s > 0 ? s : 0;
+}
+
+int gain(int x, int k) {
+  int y = x * k;
+  int lo = y > -128 ? y : -128;
+  return lo < 100 ? lo : 100;
+}
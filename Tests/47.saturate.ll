@@ -0,0 +1,108 @@
+; ModuleID = '47.saturate.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @sat_s8(i32 %x) #0 {
+entry:
+  %cmp = icmp sgt i32 %x, -128
+  %cond = select i1 %cmp, i32 %x, i32 -128
+  %cmp1 = icmp slt i32 %cond, 127
+  %cond5 = select i1 %cmp1, i32 %cond, i32 127
+  ret i32 %cond5
+}
+
+; Function Attrs: nounwind readnone
+define i32 @sat_u8(i32 %x) #0 {
+entry:
+  %cmp = icmp ult i32 %x, 255
+  %cond = select i1 %cmp, i32 %x, i32 255
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @sat_s16(i32 %x) #0 {
+entry:
+  %cmp = icmp sgt i32 %x, -32768
+  %cond = select i1 %cmp, i32 %x, i32 -32768
+  %cmp1 = icmp slt i32 %cond, 32767
+  %cond5 = select i1 %cmp1, i32 %cond, i32 32767
+  ret i32 %cond5
+}
+
+; Function Attrs: nounwind readnone
+define i32 @sat_u16(i32 %x) #0 {
+entry:
+  %cmp = icmp ult i32 %x, 65535
+  %cond = select i1 %cmp, i32 %x, i32 65535
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @add_sat(i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %add = add nsw i64 %conv1, %conv
+  %cmp = icmp sgt i64 %add, -2147483648
+  %cond = select i1 %cmp, i64 %add, i64 -2147483648
+  %cmp2 = icmp slt i64 %cond, 2147483647
+  %cond7 = select i1 %cmp2, i64 %cond, i64 2147483647
+  %conv8 = trunc i64 %cond7 to i32
+  ret i32 %conv8
+}
+
+; Function Attrs: nounwind readnone
+define i32 @add_sat_u(i32 %a, i32 %b) #0 {
+entry:
+  %conv = zext i32 %a to i64
+  %conv1 = zext i32 %b to i64
+  %add = add nuw nsw i64 %conv1, %conv
+  %cmp = icmp ult i64 %add, 4294967295
+  %cond = select i1 %cmp, i64 %add, i64 4294967295
+  %conv3 = trunc i64 %cond to i32
+  ret i32 %conv3
+}
+
+; Function Attrs: nounwind readnone
+define i32 @sub_sat(i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %sub = sub nsw i64 %conv, %conv1
+  %cmp = icmp sgt i64 %sub, -2147483648
+  %cond = select i1 %cmp, i64 %sub, i64 -2147483648
+  %cmp2 = icmp slt i64 %cond, 2147483647
+  %cond7 = select i1 %cmp2, i64 %cond, i64 2147483647
+  %conv8 = trunc i64 %cond7 to i32
+  ret i32 %conv8
+}
+
+; Function Attrs: nounwind readnone
+define i32 @sub_sat_u(i32 %a, i32 %b) #0 {
+entry:
+  %conv = zext i32 %a to i64
+  %conv1 = zext i32 %b to i64
+  %sub = sub nsw i64 %conv, %conv1
+  %cmp = icmp sgt i64 %sub, 0
+  %cond = select i1 %cmp, i64 %sub, i64 0
+  %conv3 = trunc i64 %cond to i32
+  ret i32 %conv3
+}
+
+; Function Attrs: nounwind readnone
+define i32 @gain(i32 %x, i32 %k) #0 {
+entry:
+  %mul = mul nsw i32 %x, %k
+  %cmp = icmp sgt i32 %mul, -128
+  %cond = select i1 %cmp, i32 %mul, i32 -128
+  %cmp1 = icmp slt i32 %cond, 100
+  %cond5 = select i1 %cmp1, i32 %cond, i32 100
+  ret i32 %cond5
+}
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
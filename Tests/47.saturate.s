@@ -0,0 +1,97 @@
+	.text
+	.file	"47.saturate.ll"
+	.globl	sat_s8
+	.align	1
+	.type	sat_s8,@function
+sat_s8:                                 # @sat_s8
+# BB#0:                                 # %entry
+	sat.b %d2, %d4
+	ret
+.Lfunc_end0:
+	.size	sat_s8, .Lfunc_end0-sat_s8
+
+	.globl	sat_u8
+	.align	1
+	.type	sat_u8,@function
+sat_u8:                                 # @sat_u8
+# BB#0:                                 # %entry
+	sat.bu %d2, %d4
+	ret
+.Lfunc_end1:
+	.size	sat_u8, .Lfunc_end1-sat_u8
+
+	.globl	sat_s16
+	.align	1
+	.type	sat_s16,@function
+sat_s16:                                # @sat_s16
+# BB#0:                                 # %entry
+	sat.h %d2, %d4
+	ret
+.Lfunc_end2:
+	.size	sat_s16, .Lfunc_end2-sat_s16
+
+	.globl	sat_u16
+	.align	1
+	.type	sat_u16,@function
+sat_u16:                                # @sat_u16
+# BB#0:                                 # %entry
+	sat.hu %d2, %d4
+	ret
+.Lfunc_end3:
+	.size	sat_u16, .Lfunc_end3-sat_u16
+
+	.globl	add_sat
+	.align	1
+	.type	add_sat,@function
+add_sat:                                # @add_sat
+# BB#0:                                 # %entry
+	adds %d2, %d5, %d4
+	ret
+.Lfunc_end4:
+	.size	add_sat, .Lfunc_end4-add_sat
+
+	.globl	add_sat_u
+	.align	1
+	.type	add_sat_u,@function
+add_sat_u:                              # @add_sat_u
+# BB#0:                                 # %entry
+	adds.u %d2, %d5, %d4
+	ret
+.Lfunc_end5:
+	.size	add_sat_u, .Lfunc_end5-add_sat_u
+
+	.globl	sub_sat
+	.align	1
+	.type	sub_sat,@function
+sub_sat:                                # @sub_sat
+# BB#0:                                 # %entry
+	subs %d2, %d4, %d5
+	ret
+.Lfunc_end6:
+	.size	sub_sat, .Lfunc_end6-sub_sat
+
+	.globl	sub_sat_u
+	.align	1
+	.type	sub_sat_u,@function
+sub_sat_u:                              # @sub_sat_u
+# BB#0:                                 # %entry
+	subs.u %d2, %d4, %d5
+	ret
+.Lfunc_end7:
+	.size	sub_sat_u, .Lfunc_end7-sub_sat_u
+
+	.globl	gain
+	.align	1
+	.type	gain,@function
+gain:                                   # @gain
+# BB#0:                                 # %entry
+	mul %d4, %d5
+	max %d15, %d4, -128
+	min %d2, %d15, 100
+	ret
+.Lfunc_end8:
+	.size	gain, .Lfunc_end8-gain
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
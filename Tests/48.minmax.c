@@ -0,0 +1,33 @@
+/*
+ * Minimum, maximum and absolute value (llc).
+ *
+ * min and max select MIN, MAX, MIN.U and MAX.U, with a const9 operand
+ * where it fits, and a clamp to run-time bounds is a MAX and a MIN. abs
+ * becomes ABS. The absolute difference of a signed subtraction, which may
+ * not overflow, becomes ABSDIF; abs_wrap subtracts unsigned values, which
+ * may wrap, and keeps SUB and ABS.
+ */
+int min_s(int a, int b) { return a < b ? a : b; }
+
+int max_s(int a, int b) { return a > b ? a : b; }
+
+unsigned min_u(unsigned a, unsigned b) { return a < b ? a : b; }
+
+unsigned max_u_const(unsigned a) { return a > 100 ? a : 100; }
+
+int clamp(int x, int lo, int hi) {
+  int y = x > lo ? x : lo;
+  return y < hi ? y : hi;
+}
+
+int abs_val(int x) { return x < 0 ? -x : x; }
+
+int abs_diff(int a, int b) {
+  int d = a - b;
+  return d < 0 ? -d : d;
+}
+
+int abs_wrap(unsigned a, unsigned b) {
+  int d = a - b;
+  return d < 0 ? -d : d;
+}
@@ -0,0 +1,80 @@
+; ModuleID = '48.minmax.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @min_s(i32 %a, i32 %b) #0 {
+entry:
+  %cmp = icmp slt i32 %a, %b
+  %cond = select i1 %cmp, i32 %a, i32 %b
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @max_s(i32 %a, i32 %b) #0 {
+entry:
+  %cmp = icmp sgt i32 %a, %b
+  %cond = select i1 %cmp, i32 %a, i32 %b
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @min_u(i32 %a, i32 %b) #0 {
+entry:
+  %cmp = icmp ult i32 %a, %b
+  %cond = select i1 %cmp, i32 %a, i32 %b
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @max_u_const(i32 %a) #0 {
+entry:
+  %cmp = icmp ugt i32 %a, 100
+  %cond = select i1 %cmp, i32 %a, i32 100
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @clamp(i32 %x, i32 %lo, i32 %hi) #0 {
+entry:
+  %cmp = icmp sgt i32 %x, %lo
+  %cond = select i1 %cmp, i32 %x, i32 %lo
+  %cmp1 = icmp slt i32 %cond, %hi
+  %cond5 = select i1 %cmp1, i32 %cond, i32 %hi
+  ret i32 %cond5
+}
+
+; Function Attrs: nounwind readnone
+define i32 @abs_val(i32 %x) #0 {
+entry:
+  %ispos = icmp sgt i32 %x, -1
+  %neg = sub i32 0, %x
+  %cond = select i1 %ispos, i32 %x, i32 %neg
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @abs_diff(i32 %a, i32 %b) #0 {
+entry:
+  %sub = sub nsw i32 %a, %b
+  %ispos = icmp sgt i32 %sub, -1
+  %neg = sub i32 0, %sub
+  %cond = select i1 %ispos, i32 %sub, i32 %neg
+  ret i32 %cond
+}
+
+; Function Attrs: nounwind readnone
+define i32 @abs_wrap(i32 %a, i32 %b) #0 {
+entry:
+  %sub = sub i32 %a, %b
+  %ispos = icmp sgt i32 %sub, -1
+  %neg = sub i32 0, %sub
+  %cond = select i1 %ispos, i32 %sub, i32 %neg
+  ret i32 %cond
+}
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,87 @@
+	.text
+	.file	"48.minmax.ll"
+	.globl	min_s
+	.align	1
+	.type	min_s,@function
+min_s:                                  # @min_s
+# BB#0:                                 # %entry
+	min %d2, %d4, %d5
+	ret
+.Lfunc_end0:
+	.size	min_s, .Lfunc_end0-min_s
+
+	.globl	max_s
+	.align	1
+	.type	max_s,@function
+max_s:                                  # @max_s
+# BB#0:                                 # %entry
+	max %d2, %d4, %d5
+	ret
+.Lfunc_end1:
+	.size	max_s, .Lfunc_end1-max_s
+
+	.globl	min_u
+	.align	1
+	.type	min_u,@function
+min_u:                                  # @min_u
+# BB#0:                                 # %entry
+	min.u %d2, %d4, %d5
+	ret
+.Lfunc_end2:
+	.size	min_u, .Lfunc_end2-min_u
+
+	.globl	max_u_const
+	.align	1
+	.type	max_u_const,@function
+max_u_const:                            # @max_u_const
+# BB#0:                                 # %entry
+	max.u %d2, %d4, 100
+	ret
+.Lfunc_end3:
+	.size	max_u_const, .Lfunc_end3-max_u_const
+
+	.globl	clamp
+	.align	1
+	.type	clamp,@function
+clamp:                                  # @clamp
+# BB#0:                                 # %entry
+	max %d15, %d4, %d5
+	min %d2, %d15, %d6
+	ret
+.Lfunc_end4:
+	.size	clamp, .Lfunc_end4-clamp
+
+	.globl	abs_val
+	.align	1
+	.type	abs_val,@function
+abs_val:                                # @abs_val
+# BB#0:                                 # %entry
+	abs %d2, %d4
+	ret
+.Lfunc_end5:
+	.size	abs_val, .Lfunc_end5-abs_val
+
+	.globl	abs_diff
+	.align	1
+	.type	abs_diff,@function
+abs_diff:                               # @abs_diff
+# BB#0:                                 # %entry
+	absdif %d2, %d4, %d5
+	ret
+.Lfunc_end6:
+	.size	abs_diff, .Lfunc_end6-abs_diff
+
+	.globl	abs_wrap
+	.align	1
+	.type	abs_wrap,@function
+abs_wrap:                               # @abs_wrap
+# BB#0:                                 # %entry
+	sub %d4, %d5
+	abs %d2, %d4
+	ret
+.Lfunc_end7:
+	.size	abs_wrap, .Lfunc_end7-abs_wrap
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
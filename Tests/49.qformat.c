@@ -0,0 +1,31 @@
+/*
+ * Q31 fractional multiplies (llc).
+ *
+ * The upper word of the doubled 64-bit product is MUL.Q, and adding it to
+ * or subtracting it from an accumulator is MADD.Q or MSUB.Q. A saturating
+ * accumulate folds into MADDS.Q only when a multiplicand cannot be INT_MIN:
+ * the C expression wraps INT_MIN * INT_MIN to -1.0 before the add, while
+ * MADDS.Q adds +1.0. q31_mac_sat_odd forces b odd and folds; q31_mac_sat
+ * keeps MUL.Q and ADDS. The builtin always selects MADDS.Q.
+ */
+#define Q31(a, b) ((int)(((long long)(a) * (b)) >> 31))
+
+static int adds(int a, int b) {
+  long long s = (long long)b + a;
+  long long lo = s > -2147483648LL ? s : -2147483648LL;
+  return lo < 2147483647LL ? lo : 2147483647LL;
+}
+
+int q31_mul(int a, int b) { return Q31(a, b); }
+
+int q31_mac(int acc, int a, int b) { return acc + Q31(a, b); }
+
+int q31_msub(int acc, int a, int b) { return acc - Q31(a, b); }
+
+int q31_mac_sat_odd(int acc, int a, int b) { return adds(acc, Q31(a, b | 1)); }
+
+int q31_mac_sat(int acc, int a, int b) { return adds(acc, Q31(a, b)); }
+
+int q31_mac_sat_builtin(int acc, int a, int b) {
+  return __builtin_tricore_madds_q(acc, a, b);
+}
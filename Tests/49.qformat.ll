@@ -0,0 +1,94 @@
+; ModuleID = '49.qformat.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @q31_mul(i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %mul = mul nsw i64 %conv1, %conv
+  %shr = ashr i64 %mul, 31
+  %conv2 = trunc i64 %shr to i32
+  ret i32 %conv2
+}
+
+; Function Attrs: nounwind readnone
+define i32 @q31_mac(i32 %acc, i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %mul = mul nsw i64 %conv1, %conv
+  %shr = ashr i64 %mul, 31
+  %conv2 = trunc i64 %shr to i32
+  %add = add nsw i32 %conv2, %acc
+  ret i32 %add
+}
+
+; Function Attrs: nounwind readnone
+define i32 @q31_msub(i32 %acc, i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %mul = mul nsw i64 %conv1, %conv
+  %shr = ashr i64 %mul, 31
+  %conv2 = trunc i64 %shr to i32
+  %sub = sub nsw i32 %acc, %conv2
+  ret i32 %sub
+}
+
+; Function Attrs: nounwind readnone
+define i32 @q31_mac_sat_odd(i32 %acc, i32 %a, i32 %b) #0 {
+entry:
+  %or = or i32 %b, 1
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %or to i64
+  %mul = mul nsw i64 %conv1, %conv
+  %shr = ashr i64 %mul, 31
+  %conv2 = trunc i64 %shr to i32
+  %conv3 = sext i32 %acc to i64
+  %conv4 = sext i32 %conv2 to i64
+  %add = add nsw i64 %conv4, %conv3
+  %cmp = icmp sgt i64 %add, -2147483648
+  %cond = select i1 %cmp, i64 %add, i64 -2147483648
+  %cmp5 = icmp slt i64 %cond, 2147483647
+  %cond10 = select i1 %cmp5, i64 %cond, i64 2147483647
+  %conv11 = trunc i64 %cond10 to i32
+  ret i32 %conv11
+}
+
+; Function Attrs: nounwind readnone
+define i32 @q31_mac_sat(i32 %acc, i32 %a, i32 %b) #0 {
+entry:
+  %conv = sext i32 %a to i64
+  %conv1 = sext i32 %b to i64
+  %mul = mul nsw i64 %conv1, %conv
+  %shr = ashr i64 %mul, 31
+  %conv2 = trunc i64 %shr to i32
+  %conv3 = sext i32 %acc to i64
+  %conv4 = sext i32 %conv2 to i64
+  %add = add nsw i64 %conv4, %conv3
+  %cmp = icmp sgt i64 %add, -2147483648
+  %cond = select i1 %cmp, i64 %add, i64 -2147483648
+  %cmp5 = icmp slt i64 %cond, 2147483647
+  %cond10 = select i1 %cmp5, i64 %cond, i64 2147483647
+  %conv11 = trunc i64 %cond10 to i32
+  ret i32 %conv11
+}
+
+; Function Attrs: nounwind readnone
+define i32 @q31_mac_sat_builtin(i32 %acc, i32 %a, i32 %b) #0 {
+entry:
+  %0 = tail call i32 @llvm.tricore.madds.q(i32 %acc, i32 %a, i32 %b)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+declare i32 @llvm.tricore.madds.q(i32, i32, i32) #1
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind readnone }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
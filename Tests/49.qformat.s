@@ -0,0 +1,67 @@
+	.text
+	.file	"49.qformat.ll"
+	.globl	q31_mul
+	.align	1
+	.type	q31_mul,@function
+q31_mul:                                # @q31_mul
+# BB#0:                                 # %entry
+	mul.q %d2, %d5, %d4, 1
+	ret
+.Lfunc_end0:
+	.size	q31_mul, .Lfunc_end0-q31_mul
+
+	.globl	q31_mac
+	.align	1
+	.type	q31_mac,@function
+q31_mac:                                # @q31_mac
+# BB#0:                                 # %entry
+	madd.q %d2, %d4, %d6, %d5, 1
+	ret
+.Lfunc_end1:
+	.size	q31_mac, .Lfunc_end1-q31_mac
+
+	.globl	q31_msub
+	.align	1
+	.type	q31_msub,@function
+q31_msub:                               # @q31_msub
+# BB#0:                                 # %entry
+	msub.q %d2, %d4, %d6, %d5, 1
+	ret
+.Lfunc_end2:
+	.size	q31_msub, .Lfunc_end2-q31_msub
+
+	.globl	q31_mac_sat_odd
+	.align	1
+	.type	q31_mac_sat_odd,@function
+q31_mac_sat_odd:                        # @q31_mac_sat_odd
+# BB#0:                                 # %entry
+	or %d15, %d6, 1
+	madds.q %d2, %d4, %d15, %d5, 1
+	ret
+.Lfunc_end3:
+	.size	q31_mac_sat_odd, .Lfunc_end3-q31_mac_sat_odd
+
+	.globl	q31_mac_sat
+	.align	1
+	.type	q31_mac_sat,@function
+q31_mac_sat:                            # @q31_mac_sat
+# BB#0:                                 # %entry
+	mul.q %d15, %d6, %d5, 1
+	adds %d2, %d15, %d4
+	ret
+.Lfunc_end4:
+	.size	q31_mac_sat, .Lfunc_end4-q31_mac_sat
+
+	.globl	q31_mac_sat_builtin
+	.align	1
+	.type	q31_mac_sat_builtin,@function
+q31_mac_sat_builtin:                    # @q31_mac_sat_builtin
+# BB#0:                                 # %entry
+	madds.q %d2, %d4, %d5, %d6, 1
+	ret
+.Lfunc_end5:
+	.size	q31_mac_sat_builtin, .Lfunc_end5-q31_mac_sat_builtin
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,25 @@
+/*
+ * Bit counting, byte swaps and rotates (llc, and llc -mcpu=tc162).
+ *
+ * CLZ and CLO count leading bits on every core. Trailing zeros go through
+ * CLZ, and a population count is the generic shift-and-mask sequence,
+ * unless the core has POPCNT.W. A byte swap is two DEXTR rotates and two
+ * masks, or one SHUFFLE on TC1.6.2. Rotates are DEXTR of a register with
+ * itself, by a constant or by a register; a right rotate negates the
+ * amount first.
+ */
+int leading_zeros(unsigned x) { return __builtin_clz(x); }
+
+int leading_ones(unsigned x) { return __builtin_clz(~x); }
+
+int trailing_zeros(unsigned x) { return __builtin_ctz(x); }
+
+int ones(unsigned x) { return __builtin_popcount(x); }
+
+unsigned byte_swap(unsigned x) { return __builtin_bswap32(x); }
+
+unsigned rotl_8(unsigned x) { return x << 8 | x >> 24; }
+
+unsigned rotl_var(unsigned x, unsigned n) { return x << n | x >> (32 - n); }
+
+unsigned rotr_var(unsigned x, unsigned n) { return x >> n | x << (32 - n); }
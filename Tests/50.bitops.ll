@@ -0,0 +1,87 @@
+; ModuleID = '50.bitops.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @leading_zeros(i32 %x) #0 {
+entry:
+  %0 = tail call i32 @llvm.ctlz.i32(i32 %x, i1 true)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+define i32 @leading_ones(i32 %x) #0 {
+entry:
+  %neg = xor i32 %x, -1
+  %0 = tail call i32 @llvm.ctlz.i32(i32 %neg, i1 true)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+define i32 @trailing_zeros(i32 %x) #0 {
+entry:
+  %0 = tail call i32 @llvm.cttz.i32(i32 %x, i1 true)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+define i32 @ones(i32 %x) #0 {
+entry:
+  %0 = tail call i32 @llvm.ctpop.i32(i32 %x)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+define i32 @byte_swap(i32 %x) #0 {
+entry:
+  %0 = tail call i32 @llvm.bswap.i32(i32 %x)
+  ret i32 %0
+}
+
+; Function Attrs: nounwind readnone
+define i32 @rotl_8(i32 %x) #0 {
+entry:
+  %shl = shl i32 %x, 8
+  %shr = lshr i32 %x, 24
+  %or = or i32 %shl, %shr
+  ret i32 %or
+}
+
+; Function Attrs: nounwind readnone
+define i32 @rotl_var(i32 %x, i32 %n) #0 {
+entry:
+  %shl = shl i32 %x, %n
+  %sub = sub i32 32, %n
+  %shr = lshr i32 %x, %sub
+  %or = or i32 %shl, %shr
+  ret i32 %or
+}
+
+; Function Attrs: nounwind readnone
+define i32 @rotr_var(i32 %x, i32 %n) #0 {
+entry:
+  %shr = lshr i32 %x, %n
+  %sub = sub i32 32, %n
+  %shl = shl i32 %x, %sub
+  %or = or i32 %shr, %shl
+  ret i32 %or
+}
+
+; Function Attrs: nounwind readnone
+declare i32 @llvm.ctlz.i32(i32, i1) #1
+
+; Function Attrs: nounwind readnone
+declare i32 @llvm.cttz.i32(i32, i1) #1
+
+; Function Attrs: nounwind readnone
+declare i32 @llvm.ctpop.i32(i32) #1
+
+; Function Attrs: nounwind readnone
+declare i32 @llvm.bswap.i32(i32) #1
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind readnone }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
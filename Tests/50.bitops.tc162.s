@@ -0,0 +1,90 @@
+	.text
+	.file	"50.bitops.ll"
+	.globl	leading_zeros
+	.align	5
+	.type	leading_zeros,@function
+leading_zeros:                          # @leading_zeros
+# BB#0:                                 # %entry
+	clz %d2, %d4
+	ret
+.Lfunc_end0:
+	.size	leading_zeros, .Lfunc_end0-leading_zeros
+
+	.globl	leading_ones
+	.align	5
+	.type	leading_ones,@function
+leading_ones:                           # @leading_ones
+# BB#0:                                 # %entry
+	clo %d2, %d4
+	ret
+.Lfunc_end1:
+	.size	leading_ones, .Lfunc_end1-leading_ones
+
+	.globl	trailing_zeros
+	.align	5
+	.type	trailing_zeros,@function
+trailing_zeros:                         # @trailing_zeros
+# BB#0:                                 # %entry
+	mov %d15, %d4
+	add %d15, -1
+	not %d4
+	and %d4, %d15
+	popcnt.w %d2, %d4
+	ret
+.Lfunc_end2:
+	.size	trailing_zeros, .Lfunc_end2-trailing_zeros
+
+	.globl	ones
+	.align	5
+	.type	ones,@function
+ones:                                   # @ones
+# BB#0:                                 # %entry
+	popcnt.w %d2, %d4
+	ret
+.Lfunc_end3:
+	.size	ones, .Lfunc_end3-ones
+
+	.globl	byte_swap
+	.align	5
+	.type	byte_swap,@function
+byte_swap:                              # @byte_swap
+# BB#0:                                 # %entry
+	shuffle %d2, %d4, 27
+	ret
+.Lfunc_end4:
+	.size	byte_swap, .Lfunc_end4-byte_swap
+
+	.globl	rotl_8
+	.align	5
+	.type	rotl_8,@function
+rotl_8:                                 # @rotl_8
+# BB#0:                                 # %entry
+	dextr %d2, %d4, %d4, 8
+	ret
+.Lfunc_end5:
+	.size	rotl_8, .Lfunc_end5-rotl_8
+
+	.globl	rotl_var
+	.align	5
+	.type	rotl_var,@function
+rotl_var:                               # @rotl_var
+# BB#0:                                 # %entry
+	dextr %d2, %d4, %d4, %d5
+	ret
+.Lfunc_end6:
+	.size	rotl_var, .Lfunc_end6-rotl_var
+
+	.globl	rotr_var
+	.align	5
+	.type	rotr_var,@function
+rotr_var:                               # @rotr_var
+# BB#0:                                 # %entry
+	rsub %d5
+	dextr %d2, %d4, %d4, %d5
+	ret
+.Lfunc_end7:
+	.size	rotr_var, .Lfunc_end7-rotr_var
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
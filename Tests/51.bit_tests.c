@@ -0,0 +1,40 @@
+/*
+ * Single-bit branches and bit combines (llc).
+ *
+ * A test of one bit against zero branches with JZ.T or JNZ.T and needs no
+ * compare. A bit index in a register shifts the word right first and tests
+ * bit 0. Logic on two single bits is one AND.T, OR.T or XOR.T, and moving
+ * a bit from one word into another is one INS.T, or INSN.T for the
+ * complemented bit.
+ */
+extern void on(void);
+extern void off(void);
+
+void bit_set(unsigned x) {
+  if (x & 0x20)
+    on();
+}
+
+void bit_clear(unsigned x) {
+  if (!(x & 0x80000000))
+    off();
+}
+
+void bit_var(unsigned mask, int idx) {
+  if (mask & (1u << idx))
+    on();
+}
+
+int both(unsigned a, unsigned b) { return (a >> 3) & (b >> 7) & 1; }
+
+int either(unsigned a, unsigned b) { return ((a >> 3) | (b >> 7)) & 1; }
+
+int differ(unsigned a, unsigned b) { return ((a >> 3) ^ (b >> 7)) & 1; }
+
+unsigned copy_bit(unsigned x, unsigned y) {
+  return (x & ~0x10u) | ((y >> 9) & 1) << 4;
+}
+
+unsigned copy_not_bit(unsigned x, unsigned y) {
+  return (x & ~0x10u) | ((~y >> 9) & 1) << 4;
+}
@@ -0,0 +1,113 @@
+; ModuleID = '51.bit_tests.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define void @bit_set(i32 %x) #0 {
+entry:
+  %and = and i32 %x, 32
+  %tobool = icmp eq i32 %and, 0
+  br i1 %tobool, label %if.end, label %if.then
+
+if.then:                                          ; preds = %entry
+  tail call void @on() #2
+  br label %if.end
+
+if.end:                                           ; preds = %entry, %if.then
+  ret void
+}
+
+declare void @on() #1
+
+; Function Attrs: nounwind
+define void @bit_clear(i32 %x) #0 {
+entry:
+  %and = and i32 %x, -2147483648
+  %tobool = icmp eq i32 %and, 0
+  br i1 %tobool, label %if.then, label %if.end
+
+if.then:                                          ; preds = %entry
+  tail call void @off() #2
+  br label %if.end
+
+if.end:                                           ; preds = %entry, %if.then
+  ret void
+}
+
+declare void @off() #1
+
+; Function Attrs: nounwind
+define void @bit_var(i32 %mask, i32 %idx) #0 {
+entry:
+  %shl = shl i32 1, %idx
+  %and = and i32 %shl, %mask
+  %tobool = icmp eq i32 %and, 0
+  br i1 %tobool, label %if.end, label %if.then
+
+if.then:                                          ; preds = %entry
+  tail call void @on() #2
+  br label %if.end
+
+if.end:                                           ; preds = %entry, %if.then
+  ret void
+}
+
+; Function Attrs: nounwind readnone
+define i32 @both(i32 %a, i32 %b) #3 {
+entry:
+  %shr = lshr i32 %a, 3
+  %shr1 = lshr i32 %b, 7
+  %and = and i32 %shr, %shr1
+  %and2 = and i32 %and, 1
+  ret i32 %and2
+}
+
+; Function Attrs: nounwind readnone
+define i32 @either(i32 %a, i32 %b) #3 {
+entry:
+  %shr = lshr i32 %a, 3
+  %shr1 = lshr i32 %b, 7
+  %or = or i32 %shr, %shr1
+  %and = and i32 %or, 1
+  ret i32 %and
+}
+
+; Function Attrs: nounwind readnone
+define i32 @differ(i32 %a, i32 %b) #3 {
+entry:
+  %shr = lshr i32 %a, 3
+  %shr1 = lshr i32 %b, 7
+  %xor = xor i32 %shr, %shr1
+  %and = and i32 %xor, 1
+  ret i32 %and
+}
+
+; Function Attrs: nounwind readnone
+define i32 @copy_bit(i32 %x, i32 %y) #3 {
+entry:
+  %and = and i32 %x, -17
+  %shr = lshr i32 %y, 5
+  %and1 = and i32 %shr, 16
+  %or = or i32 %and1, %and
+  ret i32 %or
+}
+
+; Function Attrs: nounwind readnone
+define i32 @copy_not_bit(i32 %x, i32 %y) #3 {
+entry:
+  %and = and i32 %x, -17
+  %shr = lshr i32 %y, 5
+  %and1 = and i32 %shr, 16
+  %shl = xor i32 %and1, 16
+  %or = or i32 %shl, %and
+  ret i32 %or
+}
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind }
+attributes #3 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
@@ -0,0 +1,96 @@
+	.text
+	.file	"51.bit_tests.ll"
+	.globl	bit_set
+	.align	1
+	.type	bit_set,@function
+bit_set:                                # @bit_set
+# BB#0:                                 # %entry
+	jz.t %d4, 5, .LBB0_2
+# BB#1:                                 # %if.then
+	call on
+.LBB0_2:                                # %if.end
+	ret
+.Lfunc_end0:
+	.size	bit_set, .Lfunc_end0-bit_set
+
+	.globl	bit_clear
+	.align	1
+	.type	bit_clear,@function
+bit_clear:                              # @bit_clear
+# BB#0:                                 # %entry
+	jnz.t %d4, 31, .LBB1_2
+# BB#1:                                 # %if.then
+	call off
+.LBB1_2:                                # %if.end
+	ret
+.Lfunc_end1:
+	.size	bit_clear, .Lfunc_end1-bit_clear
+
+	.globl	bit_var
+	.align	1
+	.type	bit_var,@function
+bit_var:                                # @bit_var
+# BB#0:                                 # %entry
+	rsub %d5
+	sh %d15, %d4, %d5
+	jz.t %d15, 0, .LBB2_2
+# BB#1:                                 # %if.then
+	call on
+.LBB2_2:                                # %if.end
+	ret
+.Lfunc_end2:
+	.size	bit_var, .Lfunc_end2-bit_var
+
+	.globl	both
+	.align	1
+	.type	both,@function
+both:                                   # @both
+# BB#0:                                 # %entry
+	and.t %d2, %d4, 3, %d5, 7
+	ret
+.Lfunc_end3:
+	.size	both, .Lfunc_end3-both
+
+	.globl	either
+	.align	1
+	.type	either,@function
+either:                                 # @either
+# BB#0:                                 # %entry
+	or.t %d2, %d4, 3, %d5, 7
+	ret
+.Lfunc_end4:
+	.size	either, .Lfunc_end4-either
+
+	.globl	differ
+	.align	1
+	.type	differ,@function
+differ:                                 # @differ
+# BB#0:                                 # %entry
+	xor.t %d2, %d4, 3, %d5, 7
+	ret
+.Lfunc_end5:
+	.size	differ, .Lfunc_end5-differ
+
+	.globl	copy_bit
+	.align	1
+	.type	copy_bit,@function
+copy_bit:                               # @copy_bit
+# BB#0:                                 # %entry
+	ins.t %d2, %d4, 4, %d5, 9
+	ret
+.Lfunc_end6:
+	.size	copy_bit, .Lfunc_end6-copy_bit
+
+	.globl	copy_not_bit
+	.align	1
+	.type	copy_not_bit,@function
+copy_not_bit:                           # @copy_not_bit
+# BB#0:                                 # %entry
+	insn.t %d2, %d4, 4, %d5, 9
+	ret
+.Lfunc_end7:
+	.size	copy_not_bit, .Lfunc_end7-copy_not_bit
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,31 @@
+/*
+ * Counted loop latches (llc).
+ *
+ * The step of a loop counter, its compare against the bound and the branch
+ * back fold into one JNEI when the counter goes up, or one JNED when it
+ * goes down. The bound may be a small constant or a register; a register
+ * bound is compared as n - 1, which takes an ADD in the loop.
+ */
+extern void tick(int);
+
+void tick7(void) {
+  for (int i = 0; i < 7; i++)
+    tick(i);
+}
+
+void tick_n(int n) {
+  for (int i = 0; i < n; i++)
+    tick(i);
+}
+
+int sum(const int *a, int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    s += a[i];
+  return s;
+}
+
+void fill_down(int *p, int n) {
+  for (int i = n; i != 0; i--)
+    p[i] = i;
+}
@@ -0,0 +1,84 @@
+	.text
+	.file	"52.loop_latch.ll"
+	.globl	tick7
+	.align	1
+	.type	tick7,@function
+tick7:                                  # @tick7
+# BB#0:                                 # %entry
+	mov %d15, 0
+.LBB0_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov %d4, %d15
+	call tick
+	jnei %d15, 6, .LBB0_1
+# BB#2:                                 # %for.end
+	ret
+.Lfunc_end0:
+	.size	tick7, .Lfunc_end0-tick7
+
+	.globl	tick_n
+	.align	1
+	.type	tick_n,@function
+tick_n:                                 # @tick_n
+# BB#0:                                 # %entry
+	mov %d15, %d4
+	mov %d8, 0
+	lt %d2, %d15, 1
+	jnz %d2, .LBB1_2
+.LBB1_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov %d4, %d8
+	call tick
+	add %d2, %d15, -1
+	jnei %d8, %d2, .LBB1_1
+.LBB1_2:                                # %for.end
+	ret
+.Lfunc_end1:
+	.size	tick_n, .Lfunc_end1-tick_n
+
+	.globl	sum
+	.align	1
+	.type	sum,@function
+sum:                                    # @sum
+# BB#0:                                 # %entry
+	mov %d2, 0
+	lt %d3, %d4, 1
+	mov.d %d15, %a4
+	jnz %d3, .LBB2_2
+.LBB2_1:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov.a %a15, %d15
+	ld.w %d3, [%a15] 0
+	add %d2, %d3
+	add %d15, 4
+	jned %d4, 1, .LBB2_1
+.LBB2_2:                                # %for.end
+	ret
+.Lfunc_end2:
+	.size	sum, .Lfunc_end2-sum
+
+	.globl	fill_down
+	.align	1
+	.type	fill_down,@function
+fill_down:                              # @fill_down
+# BB#0:                                 # %entry
+	eq %d15, %d4, 0
+	jnz %d15, .LBB3_3
+# BB#1:                                 # %for.body.preheader
+	sh %d15, %d4, 2
+	mov.d %d2, %a4
+	add %d15, %d2
+.LBB3_2:                                # %for.body
+                                        # =>This Inner Loop Header: Depth=1
+	mov.a %a15, %d15
+	st.w [%a15] 0, %d4
+	add %d15, -4
+	jned %d4, 1, .LBB3_2
+.LBB3_3:                                # %for.end
+	ret
+.Lfunc_end3:
+	.size	fill_down, .Lfunc_end3-fill_down
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,30 @@
+/*
+ * Accumulating compare chains (llc).
+ *
+ * The first compare of a chain is a plain EQ, NE, LT or GE. Each further
+ * compare combines its result with bit 0 of the previous one in the same
+ * instruction: AND.cc for &&, OR.cc for ||, XOR.cc for ^, and SH.cc to
+ * pack compare results into a bit mask. A branch on the whole chain tests
+ * the final bit with JZ or JNZ.
+ */
+extern void hit(void);
+
+int in_range(int x, int lo, int hi) { return x >= lo && x < hi; }
+
+int any_zero(int a, int b, int c) { return a == 0 || b == 0 || c == 0; }
+
+int one_below(unsigned a, unsigned b, unsigned c, unsigned d) {
+  return (a < b) ^ (c < d);
+}
+
+unsigned flags(int a, int b, int c) {
+  unsigned m = a < b;
+  m = m << 1 | (b < c);
+  m = m << 1 | (a == c);
+  return m;
+}
+
+void both(int a, int b, int c, int d) {
+  if (a < b && c != d)
+    hit();
+}
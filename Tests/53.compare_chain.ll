@@ -0,0 +1,78 @@
+; ModuleID = '53.compare_chain.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind readnone
+define i32 @in_range(i32 %x, i32 %lo, i32 %hi) #0 {
+entry:
+  %cmp = icmp sge i32 %x, %lo
+  %cmp1 = icmp slt i32 %x, %hi
+  %0 = and i1 %cmp, %cmp1
+  %land.ext = zext i1 %0 to i32
+  ret i32 %land.ext
+}
+
+; Function Attrs: nounwind readnone
+define i32 @any_zero(i32 %a, i32 %b, i32 %c) #0 {
+entry:
+  %cmp = icmp eq i32 %a, 0
+  %cmp1 = icmp eq i32 %b, 0
+  %or.cond = or i1 %cmp, %cmp1
+  %cmp2 = icmp eq i32 %c, 0
+  %0 = or i1 %or.cond, %cmp2
+  %lor.ext = zext i1 %0 to i32
+  ret i32 %lor.ext
+}
+
+; Function Attrs: nounwind readnone
+define i32 @one_below(i32 %a, i32 %b, i32 %c, i32 %d) #0 {
+entry:
+  %cmp = icmp ult i32 %a, %b
+  %cmp1 = icmp ult i32 %c, %d
+  %xor3 = xor i1 %cmp, %cmp1
+  %xor = zext i1 %xor3 to i32
+  ret i32 %xor
+}
+
+; Function Attrs: nounwind readnone
+define i32 @flags(i32 %a, i32 %b, i32 %c) #0 {
+entry:
+  %cmp = icmp slt i32 %a, %b
+  %conv = zext i1 %cmp to i32
+  %shl = shl nuw nsw i32 %conv, 1
+  %cmp1 = icmp slt i32 %b, %c
+  %conv2 = zext i1 %cmp1 to i32
+  %or = or i32 %shl, %conv2
+  %shl3 = shl nuw nsw i32 %or, 1
+  %cmp4 = icmp eq i32 %a, %c
+  %conv5 = zext i1 %cmp4 to i32
+  %or6 = or i32 %shl3, %conv5
+  ret i32 %or6
+}
+
+; Function Attrs: nounwind
+define void @both(i32 %a, i32 %b, i32 %c, i32 %d) #1 {
+entry:
+  %cmp = icmp slt i32 %a, %b
+  %cmp1 = icmp ne i32 %c, %d
+  %or.cond = and i1 %cmp, %cmp1
+  br i1 %or.cond, label %if.then, label %if.end
+
+if.then:                                          ; preds = %entry
+  tail call void @hit() #3
+  br label %if.end
+
+if.end:                                           ; preds = %if.then, %entry
+  ret void
+}
+
+declare void @hit() #2
+
+attributes #0 = { nounwind readnone "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
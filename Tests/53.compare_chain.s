@@ -0,0 +1,66 @@
+	.text
+	.file	"53.compare_chain.ll"
+	.globl	in_range
+	.align	1
+	.type	in_range,@function
+in_range:                               # @in_range
+# BB#0:                                 # %entry
+	ge %d2, %d4, %d5
+	and.lt %d2, %d4, %d6
+	ret
+.Lfunc_end0:
+	.size	in_range, .Lfunc_end0-in_range
+
+	.globl	any_zero
+	.align	1
+	.type	any_zero,@function
+any_zero:                               # @any_zero
+# BB#0:                                 # %entry
+	eq %d2, %d4, 0
+	or.eq %d2, %d5, 0
+	or.eq %d2, %d6, 0
+	ret
+.Lfunc_end1:
+	.size	any_zero, .Lfunc_end1-any_zero
+
+	.globl	one_below
+	.align	1
+	.type	one_below,@function
+one_below:                              # @one_below
+# BB#0:                                 # %entry
+	lt.u %d2, %d4, %d5
+	xor.lt.u %d2, %d6, %d7
+	ret
+.Lfunc_end2:
+	.size	one_below, .Lfunc_end2-one_below
+
+	.globl	flags
+	.align	1
+	.type	flags,@function
+flags:                                  # @flags
+# BB#0:                                 # %entry
+	lt %d2, %d4, %d5
+	sh.lt %d2, %d5, %d6
+	sh.eq %d2, %d4, %d6
+	ret
+.Lfunc_end3:
+	.size	flags, .Lfunc_end3-flags
+
+	.globl	both
+	.align	1
+	.type	both,@function
+both:                                   # @both
+# BB#0:                                 # %entry
+	lt %d15, %d4, %d5
+	and.ne %d15, %d6, %d7
+	jz %d15, .LBB4_2
+# BB#1:                                 # %if.then
+	call hit
+.LBB4_2:                                # %if.end
+	ret
+.Lfunc_end4:
+	.size	both, .Lfunc_end4-both
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,17 @@
+/*
+ * Argument registers chosen per call (llc).
+ *
+ * Each call site assigns its own argument registers from the callee's
+ * prototype, whether or not the callee is defined in the module or was
+ * lowered first. Integers take D4-D7, pointers A4-A7, and a 64-bit value
+ * the next free even/odd pair (E4 or E6). A pointer return comes back in
+ * A2, anything else in D2.
+ */
+extern int *lookup(int key, const char *name, long long stamp, int flags);
+extern long long mix(int *p, long long seed, int *q, int n);
+
+int use(int key, const char *name, int *buf, long long stamp) {
+  int *hit = lookup(key, name, stamp, 3);
+  long long m = mix(buf, stamp, hit, key);
+  return *hit + (int)m;
+}
@@ -0,0 +1,30 @@
+; ModuleID = '54.call_args.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define i32 @use(i32 %key, i8* %name, i32* %buf, i64 %stamp) #0 {
+entry:
+  %call = tail call i32* @lookup(i32 %key, i8* %name, i64 %stamp, i32 3) #2
+  %call1 = tail call i64 @mix(i32* %buf, i64 %stamp, i32* %call, i32 %key) #2
+  %0 = load i32, i32* %call, align 4, !tbaa !1
+  %conv = trunc i64 %call1 to i32
+  %add = add nsw i32 %conv, %0
+  ret i32 %add
+}
+
+declare i32* @lookup(i32, i8*, i64, i32) #1
+
+declare i64 @mix(i32*, i64, i32*, i32) #1
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #2 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
+!1 = !{!2, !2, i64 0}
+!2 = !{!"int", !3, i64 0}
+!3 = !{!"omnipotent char", !4, i64 0}
+!4 = !{!"Simple C/C++ TBAA"}
@@ -0,0 +1,31 @@
+	.text
+	.file	"54.call_args.ll"
+	.globl	use
+	.align	1
+	.type	use,@function
+use:                                    # @use
+# BB#0:                                 # %entry
+	mov %d8, %d6
+	mov %d9, %d7
+	mov.aa %a15, %a5
+	mov %d15, %d4
+	mov %d5, 3
+	call lookup
+	mov.d %d10, %a2
+	mov.aa %a4, %a15
+	mov %d4, %d8
+	mov %d5, %d9
+	mov.a %a5, %d10
+	mov %d6, %d15
+	call mix
+	mov.a %a15, %d10
+	ld.w %d15, [%a15] 0
+	add %d15, %d2
+	mov %d2, %d15
+	ret
+.Lfunc_end0:
+	.size	use, .Lfunc_end0-use
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
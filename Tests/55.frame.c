@@ -0,0 +1,32 @@
+/*
+ * Frame lowering (llc).
+ *
+ * A frame larger than SUB.A's 8-bit decrement is allocated with LEA or
+ * ADDIH.A, and slots beyond the 16-bit BOL displacement are addressed
+ * through a scavenged address register. A variable-length array moves A10
+ * at run time, so the function keeps A14 as its frame pointer. A function
+ * that needs its frame on one path only allocates it on that path: the
+ * early return in lookup() runs before any stack adjustment.
+ */
+extern void fill(char *p, int n);
+extern void fill_ints(int *p, int n);
+
+int big(void) {
+  char buf[100000];
+  fill(buf, sizeof buf);
+  return buf[0] + buf[99999];
+}
+
+int vla(int n) {
+  char buf[n];
+  fill(buf, n);
+  return buf[n - 1];
+}
+
+int lookup(int key) {
+  int table[32];
+  if (key < 0 || key >= 32)
+    return -1;
+  fill_ints(table, 32);
+  return table[key];
+}
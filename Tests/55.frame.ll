@@ -0,0 +1,85 @@
+; ModuleID = '55.frame.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define i32 @big() #0 {
+entry:
+  %buf = alloca [100000 x i8], align 1
+  %0 = getelementptr inbounds [100000 x i8], [100000 x i8]* %buf, i32 0, i32 0
+  call void @llvm.lifetime.start(i64 100000, i8* %0) #3
+  call void @fill(i8* %0, i32 100000) #3
+  %1 = load i8, i8* %0, align 1, !tbaa !1
+  %conv = sext i8 %1 to i32
+  %arrayidx1 = getelementptr inbounds [100000 x i8], [100000 x i8]* %buf, i32 0, i32 99999
+  %2 = load i8, i8* %arrayidx1, align 1, !tbaa !1
+  %conv2 = sext i8 %2 to i32
+  %add = add nsw i32 %conv2, %conv
+  call void @llvm.lifetime.end(i64 100000, i8* %0) #3
+  ret i32 %add
+}
+
+; Function Attrs: nounwind
+declare void @llvm.lifetime.start(i64, i8* nocapture) #3
+
+declare void @fill(i8*, i32) #1
+
+; Function Attrs: nounwind
+declare void @llvm.lifetime.end(i64, i8* nocapture) #3
+
+; Function Attrs: nounwind
+define i32 @vla(i32 %n) #0 {
+entry:
+  %0 = call i8* @llvm.stacksave()
+  %vla = alloca i8, i32 %n, align 1
+  call void @fill(i8* %vla, i32 %n) #3
+  %sub = add nsw i32 %n, -1
+  %arrayidx = getelementptr inbounds i8, i8* %vla, i32 %sub
+  %1 = load i8, i8* %arrayidx, align 1, !tbaa !1
+  %conv = sext i8 %1 to i32
+  call void @llvm.stackrestore(i8* %0)
+  ret i32 %conv
+}
+
+; Function Attrs: nounwind
+declare i8* @llvm.stacksave() #3
+
+; Function Attrs: nounwind
+declare void @llvm.stackrestore(i8*) #3
+
+; Function Attrs: nounwind
+define i32 @lookup(i32 %key) #0 {
+entry:
+  %table = alloca [32 x i32], align 4
+  %0 = bitcast [32 x i32]* %table to i8*
+  call void @llvm.lifetime.start(i64 128, i8* %0) #3
+  %1 = icmp ugt i32 %key, 31
+  br i1 %1, label %cleanup, label %if.end
+
+if.end:                                           ; preds = %entry
+  %arraydecay = getelementptr inbounds [32 x i32], [32 x i32]* %table, i32 0, i32 0
+  call void @fill_ints(i32* %arraydecay, i32 32) #3
+  %arrayidx = getelementptr inbounds [32 x i32], [32 x i32]* %table, i32 0, i32 %key
+  %2 = load i32, i32* %arrayidx, align 4, !tbaa !4
+  br label %cleanup
+
+cleanup:                                          ; preds = %entry, %if.end
+  %retval.0 = phi i32 [ %2, %if.end ], [ -1, %entry ]
+  call void @llvm.lifetime.end(i64 128, i8* %0) #3
+  ret i32 %retval.0
+}
+
+declare void @fill_ints(i32*, i32) #1
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #3 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
+!1 = !{!2, !2, i64 0}
+!2 = !{!"omnipotent char", !3, i64 0}
+!3 = !{!"Simple C/C++ TBAA"}
+!4 = !{!5, !5, i64 0}
+!5 = !{!"int", !2, i64 0}
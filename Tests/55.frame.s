@@ -0,0 +1,75 @@
+	.text
+	.file	"55.frame.ll"
+	.globl	big
+	.align	1
+	.type	big,@function
+big:                                    # @big
+# BB#0:                                 # %entry
+	addih.a %a10, %a10, 65534
+	lea %a10, [%a10] 31064
+	movh %d15, 2
+	addi %d4, %d15, -31072
+	mov.d %d15, %a10
+	add %d15, %d15, 8
+	mov.a %a4, %d15
+	call fill
+	ld.b %d2, [%a10] 8
+	addih.a %a2, %a10, 2
+	lea %a2, [%a2] -31065
+	ld.b %d15, [%a2] 0
+	add %d2, %d15
+	ret
+.Lfunc_end0:
+	.size	big, .Lfunc_end0-big
+
+	.globl	vla
+	.align	1
+	.type	vla,@function
+vla:                                    # @vla
+# BB#0:                                 # %entry
+	mov.aa %a14, %a10
+	mov.d %d15, %a10
+	mov.d %d2, %a10
+	mov %d3, %d4
+	add %d3, 7
+	andn %d3, %d3, 7
+	sub %d2, %d3
+	mov %d8, %d2
+	add %d8, %d4
+	mov.a %a10, %d2
+	mov.a %a4, %d2
+	call fill
+	mov.a %a15, %d8
+	ld.b %d2, [%a15] -1
+	mov.a %a10, %d15
+	ret
+.Lfunc_end1:
+	.size	vla, .Lfunc_end1-vla
+
+	.globl	lookup
+	.align	1
+	.type	lookup,@function
+lookup:                                 # @lookup
+# BB#0:                                 # %entry
+	mov %d15, %d4
+	mov %d2, -1
+	ge.u %d3, %d15, 32
+	jne %d3, 0, .LBB2_2
+# BB#1:                                 # %if.end
+	sub.a %a10, 128
+	mov.d %d8, %a10
+	mov %d4, 32
+	mov.a %a4, %d8
+	call fill_ints
+	sh %d15, %d15, 2
+	add %d15, %d8
+	mov.a %a15, %d15
+	ld.w %d2, [%a15] 0
+.LBB2_2:                                # %cleanup
+	ret
+.Lfunc_end2:
+	.size	lookup, .Lfunc_end2-lookup
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
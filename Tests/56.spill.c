@@ -0,0 +1,35 @@
+/*
+ * Spills and reloads by register class (llc -mcpu=tc162).
+ *
+ * Each function clobbers a whole register bank with an empty asm statement,
+ * so its arguments must go through the stack. Data registers spill with
+ * ST.W/LD.W, address registers with ST.A/LD.A, extended registers with
+ * ST.D/LD.D into an 8-byte aligned slot, and FPU floats, which live in data
+ * registers, with ST.W/LD.W.
+ */
+#define CLOBBER_D                                                            \
+  __asm__ volatile("" ::: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7",    \
+                   "d8", "d9", "d10", "d11", "d12", "d13", "d14", "d15")
+#define CLOBBER_A                                                            \
+  __asm__ volatile("" ::: "a2", "a3", "a4", "a5", "a6", "a7", "a12", "a13",  \
+                   "a14", "a15")
+
+int data(int a, int b) {
+  CLOBBER_D;
+  return a + b;
+}
+
+int addr(int *p) {
+  CLOBBER_A;
+  return *p;
+}
+
+long long ext(long long x) {
+  CLOBBER_D;
+  return x + 1;
+}
+
+float fp(float x, float y) {
+  CLOBBER_D;
+  return x + y;
+}
@@ -0,0 +1,50 @@
+; ModuleID = '56.spill.bc'
+target datalayout = "e-m:e-p:32:32-i64:32-a:0:32-n32"
+target triple = "tricore-unknown-linux-gnu"
+
+; Function Attrs: nounwind
+define i32 @data(i32 %a, i32 %b) #0 {
+entry:
+  tail call void asm sideeffect "", "~{d0},~{d1},~{d2},~{d3},~{d4},~{d5},~{d6},~{d7},~{d8},~{d9},~{d10},~{d11},~{d12},~{d13},~{d14},~{d15}"() #1, !srcloc !1
+  %add = add nsw i32 %b, %a
+  ret i32 %add
+}
+
+; Function Attrs: nounwind
+define i32 @addr(i32* nocapture readonly %p) #0 {
+entry:
+  tail call void asm sideeffect "", "~{a2},~{a3},~{a4},~{a5},~{a6},~{a7},~{a12},~{a13},~{a14},~{a15}"() #1, !srcloc !2
+  %0 = load i32, i32* %p, align 4, !tbaa !3
+  ret i32 %0
+}
+
+; Function Attrs: nounwind
+define i64 @ext(i64 %x) #0 {
+entry:
+  tail call void asm sideeffect "", "~{d0},~{d1},~{d2},~{d3},~{d4},~{d5},~{d6},~{d7},~{d8},~{d9},~{d10},~{d11},~{d12},~{d13},~{d14},~{d15}"() #1, !srcloc !7
+  %add = add nsw i64 %x, 1
+  ret i64 %add
+}
+
+; Function Attrs: nounwind
+define float @fp(float %x, float %y) #0 {
+entry:
+  tail call void asm sideeffect "", "~{d0},~{d1},~{d2},~{d3},~{d4},~{d5},~{d6},~{d7},~{d8},~{d9},~{d10},~{d11},~{d12},~{d13},~{d14},~{d15}"() #1, !srcloc !8
+  %add = fadd float %x, %y
+  ret float %add
+}
+
+attributes #0 = { nounwind "disable-tail-calls"="false" "less-precise-fpmad"="false" "no-frame-pointer-elim"="false" "no-infs-fp-math"="false" "no-nans-fp-math"="false" "stack-protector-buffer-size"="8" "target-cpu"="tc162" "unsafe-fp-math"="false" "use-soft-float"="false" }
+attributes #1 = { nounwind }
+
+!llvm.ident = !{!0}
+
+!0 = !{!"clang version 3.7.0 (tags/RELEASE_370/final)"}
+!1 = !{i32 1022}
+!2 = !{i32 1094}
+!3 = !{!4, !4, i64 0}
+!4 = !{!"int", !5, i64 0}
+!5 = !{!"omnipotent char", !6, i64 0}
+!6 = !{!"Simple C/C++ TBAA"}
+!7 = !{i32 1162}
+!8 = !{i32 1230}
@@ -0,0 +1,70 @@
+	.text
+	.file	"56.spill.ll"
+	.globl	data
+	.align	5
+	.type	data,@function
+data:                                   # @data
+# BB#0:                                 # %entry
+	sub.a %a10, 8
+	st.w [%a10] 0, %d4              # 4-byte Folded Spill
+	st.w [%a10] 4, %d5              # 4-byte Folded Spill
+	#APP
+	#NO_APP
+	ld.w %d2, [%a10] 0              # 4-byte Folded Reload
+	ld.w %d15, [%a10] 4             # 4-byte Folded Reload
+	add %d2, %d15
+	ret
+.Lfunc_end0:
+	.size	data, .Lfunc_end0-data
+
+	.globl	addr
+	.align	5
+	.type	addr,@function
+addr:                                   # @addr
+# BB#0:                                 # %entry
+	sub.a %a10, 8
+	st.a [%a10] 4, %a4              # 4-byte Folded Spill
+	#APP
+	#NO_APP
+	ld.a %a15, [%a10] 4             # 4-byte Folded Reload
+	ld.w %d2, [%a15] 0
+	ret
+.Lfunc_end1:
+	.size	addr, .Lfunc_end1-addr
+
+	.globl	ext
+	.align	5
+	.type	ext,@function
+ext:                                    # @ext
+# BB#0:                                 # %entry
+	sub.a %a10, 8
+	st.d [%a10] 0, %e4              # 8-byte Folded Spill
+	#APP
+	#NO_APP
+	ld.d %e2, [%a10] 0              # 8-byte Folded Reload
+	addx %d2, %d2, 1
+	addc %d3, %d3, 0
+	ret
+.Lfunc_end2:
+	.size	ext, .Lfunc_end2-ext
+
+	.globl	fp
+	.align	5
+	.type	fp,@function
+fp:                                     # @fp
+# BB#0:                                 # %entry
+	sub.a %a10, 8
+	st.w [%a10] 4, %d5              # 4-byte Folded Spill
+	st.w [%a10] 0, %d4              # 4-byte Folded Spill
+	#APP
+	#NO_APP
+	ld.w %d15, [%a10] 4             # 4-byte Folded Reload
+	ld.w %d2, [%a10] 0              # 4-byte Folded Reload
+	add.f %d2, %d2, %d15
+	ret
+.Lfunc_end3:
+	.size	fp, .Lfunc_end3-fp
+
+
+	.ident	"clang version 3.7.0 (tags/RELEASE_370/final)"
+	.section	".note.GNU-stack","",@progbits
@@ -219,6 +219,13 @@ public:
   /// incurs significant execution cost.
   bool isLoweredToCall(const Function *F) const;
 
+  /// \brief Estimate the execution cost of the call and return sequence
+  /// itself, which inlining a call site saves on top of the argument setup.
+  ///
+  /// The cost is in instructions, for targets where a call does considerably
+  /// more work than a jump and link, e.g. saving a register context.
+  unsigned getInlineCallOverhead() const;
+
   /// Parameters that control the generic loop unrolling transformation.
   struct UnrollingPreferences {
     /// The cost threshold for the unrolled loop. Should be relative to the
@@ -557,6 +564,7 @@ public:
   virtual bool hasBranchDivergence() = 0;
   virtual bool isSourceOfDivergence(const Value *V) = 0;
   virtual bool isLoweredToCall(const Function *F) = 0;
+  virtual unsigned getInlineCallOverhead() = 0;
   virtual void getUnrollingPreferences(Loop *L, UnrollingPreferences &UP) = 0;
   virtual bool isLegalAddImmediate(int64_t Imm) = 0;
   virtual bool isLegalICmpImmediate(int64_t Imm) = 0;
@@ -673,6 +681,9 @@ public:
   bool isLoweredToCall(const Function *F) override {
     return Impl.isLoweredToCall(F);
   }
+  unsigned getInlineCallOverhead() override {
+    return Impl.getInlineCallOverhead();
+  }
   void getUnrollingPreferences(Loop *L, UnrollingPreferences &UP) override {
     return Impl.getUnrollingPreferences(L, UP);
   }
@@ -185,6 +185,8 @@ public:
     return true;
   }
 
+  unsigned getInlineCallOverhead() { return 0; }
+
   void getUnrollingPreferences(Loop *, TTI::UnrollingPreferences &) {}
 
   bool isLegalAddImmediate(int64_t Imm) { return false; }
@@ -311,6 +311,7 @@ public:
     VK_TRICORE_HI,
 		VK_TRICORE_HI_OFFSET,
 		VK_TRICORE_LO_OFFSET,
+		VK_TRICORE_SM,    // sm:sym, offset from the small data base
 ///////////////////////////////////////////////////////////////////////////////
 
     VK_COFF_IMGREL32, // symbol@imgrel (image-relative)
@@ -623,6 +623,11 @@ enum {
 #include "ELFRelocs/Sparc.def"
 };
 
+// ELF Relocation types for TriCore
+enum {
+#include "ELFRelocs/TriCore.def"
+};
+
 #undef ELF_RELOC
 
 // Section header.
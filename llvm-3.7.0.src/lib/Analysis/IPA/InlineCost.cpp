@@ -1107,6 +1107,9 @@ bool CallAnalyzer::analyzeCall(CallSite CS) {
     }
   }
 
+  // The call and return themselves go away as well.
+  Cost -= TTI.getInlineCallOverhead() * InlineConstants::InstrCost;
+
   // If there is only one call of the function, and it has internal linkage,
   // the cost of inlining it drops dramatically.
   bool OnlyOneCallAndLocalLinkage = F.hasLocalLinkage() && F.hasOneUse() &&
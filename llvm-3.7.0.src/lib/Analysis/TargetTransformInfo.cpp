@@ -84,6 +84,10 @@ bool TargetTransformInfo::isLoweredToCall(const Function *F) const {
   return TTIImpl->isLoweredToCall(F);
 }
 
+unsigned TargetTransformInfo::getInlineCallOverhead() const {
+  return TTIImpl->getInlineCallOverhead();
+}
+
 void TargetTransformInfo::getUnrollingPreferences(
     Loop *L, UnrollingPreferences &UP) const {
   return TTIImpl->getUnrollingPreferences(L, UP);
@@ -325,6 +325,7 @@ StringRef MCSymbolRefExpr::getVariantKindName(VariantKind Kind) {
   case VK_TRICORE_HI: return "TRICORE_HI";
   case VK_TRICORE_LO_OFFSET: return "TRICORE_LO_OFFSET";
   case VK_TRICORE_HI_OFFSET: return "TRICORE_HI_OFFSET";
+  case VK_TRICORE_SM: return "TRICORE_SM";
 
 ////////////////////////////////////////////////////////////////////////////////
   case VK_COFF_IMGREL32: return "IMGREL";
@@ -99,6 +99,13 @@ StringRef getELFRelocationTypeName(uint32_t Machine, uint32_t Type) {
       break;
     }
     break;
+  case ELF::EM_TRICORE:
+    switch (Type) {
+#include "llvm/Support/ELFRelocs/TriCore.def"
+    default:
+      break;
+    }
+    break;
   default:
     break;
   }
@@ -0,0 +1,648 @@
+//===-- TriCoreAsmParser.cpp - Parse TriCore assembly to MCInst -----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file reads the syntax the TriCore instruction printer writes: "%d2",
+// "%a10" or "%sp" and "%e2" for registers, "[%a2] 4", "[%a2+] 4" and
+// "[+%a2] 4" for the base + offset, post-increment and pre-increment memory
+// operands, and hi:, lo: and sm: in front of a symbol for the absolute and
+// small data relocations.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MCTargetDesc/TriCoreMCTargetDesc.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/MC/MCContext.h"
+#include "llvm/MC/MCExpr.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCInstrInfo.h"
+#include "llvm/MC/MCParser/MCAsmLexer.h"
+#include "llvm/MC/MCParser/MCParsedAsmOperand.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/MCStreamer.h"
+#include "llvm/MC/MCSubtargetInfo.h"
+#include "llvm/MC/MCTargetAsmParser.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/TargetRegistry.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-asm-parser"
+
+namespace {
+class TriCoreOperand;
+
+class TriCoreAsmParser : public MCTargetAsmParser {
+  MCSubtargetInfo &STI;
+  const MCInstrInfo &MII;
+
+#define GET_ASSEMBLER_HEADER
+#include "TriCoreGenAsmMatcher.inc"
+
+  bool MatchAndEmitInstruction(SMLoc IDLoc, unsigned &Opcode,
+                               OperandVector &Operands, MCStreamer &Out,
+                               uint64_t &ErrorInfo,
+                               bool MatchingInlineAsm) override;
+
+  bool ParseRegister(unsigned &RegNo, SMLoc &StartLoc, SMLoc &EndLoc) override;
+
+  bool ParseInstruction(ParseInstructionInfo &Info, StringRef Name,
+                        SMLoc NameLoc, OperandVector &Operands) override;
+
+  bool ParseDirective(AsmToken DirectiveID) override;
+
+  unsigned validateTargetOperandClass(MCParsedAsmOperand &Op,
+                                      unsigned Kind) override;
+
+  bool parseOperand(OperandVector &Operands);
+  bool parseRegister(unsigned &RegNo, StringRef &Suffix, SMLoc &EndLoc);
+  bool parseMemOperand(OperandVector &Operands);
+  bool parseImmediate(const MCExpr *&Res, SMLoc &EndLoc);
+  bool parseDirectiveWord(unsigned Size, SMLoc L);
+
+public:
+  TriCoreAsmParser(MCSubtargetInfo &sti, MCAsmParser &Parser,
+                   const MCInstrInfo &MII, const MCTargetOptions &Options)
+      : MCTargetAsmParser(), STI(sti), MII(MII) {
+    setAvailableFeatures(ComputeAvailableFeatures(STI.getFeatureBits()));
+  }
+};
+
+/// TriCoreOperand - An instruction operand as the matcher sees it.
+class TriCoreOperand : public MCParsedAsmOperand {
+public:
+  enum KindTy { k_Token, k_Register, k_Immediate, k_Memory };
+  enum AddrMode { BaseOffset, PostIncrement, PreIncrement };
+
+private:
+  KindTy Kind;
+
+  SMLoc StartLoc, EndLoc;
+
+  struct MemOp {
+    unsigned Base;
+    const MCExpr *Off;
+    AddrMode Mode;
+  };
+
+  union {
+    StringRef Tok;
+    unsigned Reg;
+    const MCExpr *Imm;
+    MemOp Mem;
+  };
+
+  /// getConstant - Whether E is a constant, and its value.
+  static bool getConstant(const MCExpr *E, int64_t &Value) {
+    if (const MCConstantExpr *CE = dyn_cast<MCConstantExpr>(E)) {
+      Value = CE->getValue();
+      return true;
+    }
+    return false;
+  }
+
+  /// getVariantKind - The modifier of a sym or sym+off expression,
+  /// VK_Invalid for anything else.
+  static MCSymbolRefExpr::VariantKind getVariantKind(const MCExpr *E) {
+    if (const MCBinaryExpr *BE = dyn_cast<MCBinaryExpr>(E))
+      E = BE->getLHS();
+    if (const MCSymbolRefExpr *SRE = dyn_cast<MCSymbolRefExpr>(E))
+      return SRE->getKind();
+    return MCSymbolRefExpr::VK_Invalid;
+  }
+
+public:
+  TriCoreOperand(KindTy K) : MCParsedAsmOperand(), Kind(K) {}
+
+  bool isToken() const override { return Kind == k_Token; }
+  bool isReg() const override { return Kind == k_Register; }
+  bool isImm() const override {
+    int64_t Value;
+    return Kind == k_Immediate && getConstant(Imm, Value);
+  }
+  bool isMem() const override { return Kind == k_Memory; }
+
+  template <unsigned Bits> bool isSImm() const {
+    int64_t Value;
+    return Kind == k_Immediate && getConstant(Imm, Value) &&
+           isInt<Bits>(Value);
+  }
+
+  template <unsigned Bits> bool isUImm() const {
+    int64_t Value;
+    return Kind == k_Immediate && getConstant(Imm, Value) &&
+           isUInt<Bits>(Value);
+  }
+
+  bool isSImm16() const {
+    return isSImm<16>() || (Kind == k_Immediate &&
+        getVariantKind(Imm) == MCSymbolRefExpr::VK_TRICORE_LO_OFFSET);
+  }
+
+  bool isHi16() const {
+    return isUImm<16>() || (Kind == k_Immediate &&
+        getVariantKind(Imm) == MCSymbolRefExpr::VK_TRICORE_HI_OFFSET);
+  }
+
+  /// isBrTarget - A label, or an even byte displacement the field reaches.
+  /// disp4 is the only one that is zero extended.
+  template <unsigned Bits> bool isBrTarget() const {
+    if (Kind != k_Immediate)
+      return false;
+    int64_t Value;
+    if (!getConstant(Imm, Value))
+      return getVariantKind(Imm) == MCSymbolRefExpr::VK_None;
+    if (Value % 2)
+      return false;
+    return Bits == 4 ? isUInt<Bits + 1>(Value) : isInt<Bits + 1>(Value);
+  }
+
+  bool isMem10() const {
+    int64_t Value;
+    return Kind == k_Memory && Mem.Mode == BaseOffset &&
+           getConstant(Mem.Off, Value) && isInt<10>(Value);
+  }
+
+  bool isMem16() const {
+    if (Kind != k_Memory || Mem.Mode != BaseOffset)
+      return false;
+    int64_t Value;
+    if (getConstant(Mem.Off, Value))
+      return isInt<16>(Value);
+    MCSymbolRefExpr::VariantKind VK = getVariantKind(Mem.Off);
+    return VK == MCSymbolRefExpr::VK_TRICORE_LO_OFFSET ||
+           VK == MCSymbolRefExpr::VK_TRICORE_SM;
+  }
+
+  bool isMemPostInc() const {
+    int64_t Value;
+    return Kind == k_Memory && Mem.Mode == PostIncrement &&
+           getConstant(Mem.Off, Value) && isInt<10>(Value);
+  }
+
+  bool isMemPreInc() const {
+    int64_t Value;
+    return Kind == k_Memory && Mem.Mode == PreIncrement &&
+           getConstant(Mem.Off, Value) && isInt<10>(Value);
+  }
+
+  /// isConstantImm - Whether this is the literal V, such as the 1 of
+  /// "mul.q %d2, %d3, %d4, 1".
+  bool isConstantImm(int64_t V) const {
+    int64_t Value;
+    return Kind == k_Immediate && getConstant(Imm, Value) && Value == V;
+  }
+
+  StringRef getToken() const {
+    assert(Kind == k_Token && "Invalid access!");
+    return Tok;
+  }
+
+  unsigned getReg() const override {
+    assert(Kind == k_Register && "Invalid access!");
+    return Reg;
+  }
+
+  SMLoc getStartLoc() const override { return StartLoc; }
+  SMLoc getEndLoc() const override { return EndLoc; }
+
+  void addExpr(MCInst &Inst, const MCExpr *Expr) const {
+    int64_t Value;
+    if (getConstant(Expr, Value))
+      Inst.addOperand(MCOperand::createImm(Value));
+    else
+      Inst.addOperand(MCOperand::createExpr(Expr));
+  }
+
+  void addRegOperands(MCInst &Inst, unsigned N) const {
+    assert(N == 1 && "Invalid number of operands!");
+    Inst.addOperand(MCOperand::createReg(getReg()));
+  }
+
+  void addImmOperands(MCInst &Inst, unsigned N) const {
+    assert(N == 1 && "Invalid number of operands!");
+    addExpr(Inst, Imm);
+  }
+
+  void addMemOperands(MCInst &Inst, unsigned N) const {
+    assert(N == 2 && "Invalid number of operands!");
+    Inst.addOperand(MCOperand::createReg(Mem.Base));
+    addExpr(Inst, Mem.Off);
+  }
+
+  void print(raw_ostream &OS) const override {
+    switch (Kind) {
+    case k_Token:
+      OS << "Token: " << Tok;
+      break;
+    case k_Register:
+      OS << "Reg: " << Reg;
+      break;
+    case k_Immediate:
+      OS << "Imm: " << *Imm;
+      break;
+    case k_Memory:
+      OS << "Mem: " << Mem.Base << ", " << *Mem.Off << " (" << Mem.Mode
+         << ')';
+      break;
+    }
+  }
+
+  static std::unique_ptr<TriCoreOperand> createToken(StringRef Str, SMLoc S) {
+    auto Op = make_unique<TriCoreOperand>(k_Token);
+    Op->Tok = Str;
+    Op->StartLoc = S;
+    Op->EndLoc = S;
+    return Op;
+  }
+
+  static std::unique_ptr<TriCoreOperand> createReg(unsigned RegNo, SMLoc S,
+                                                   SMLoc E) {
+    auto Op = make_unique<TriCoreOperand>(k_Register);
+    Op->Reg = RegNo;
+    Op->StartLoc = S;
+    Op->EndLoc = E;
+    return Op;
+  }
+
+  static std::unique_ptr<TriCoreOperand> createImm(const MCExpr *Val, SMLoc S,
+                                                   SMLoc E) {
+    auto Op = make_unique<TriCoreOperand>(k_Immediate);
+    Op->Imm = Val;
+    Op->StartLoc = S;
+    Op->EndLoc = E;
+    return Op;
+  }
+
+  static std::unique_ptr<TriCoreOperand>
+  createMem(unsigned Base, const MCExpr *Off, AddrMode Mode, SMLoc S,
+            SMLoc E) {
+    auto Op = make_unique<TriCoreOperand>(k_Memory);
+    Op->Mem.Base = Base;
+    Op->Mem.Off = Off;
+    Op->Mem.Mode = Mode;
+    Op->StartLoc = S;
+    Op->EndLoc = E;
+    return Op;
+  }
+};
+} // end anonymous namespace
+
+static const unsigned DataRegs[] = {
+  TriCore::D0,  TriCore::D1,  TriCore::D2,  TriCore::D3,
+  TriCore::D4,  TriCore::D5,  TriCore::D6,  TriCore::D7,
+  TriCore::D8,  TriCore::D9,  TriCore::D10, TriCore::D11,
+  TriCore::D12, TriCore::D13, TriCore::D14, TriCore::D15 };
+
+static const unsigned AddrRegs[] = {
+  TriCore::A0,  TriCore::A1,  TriCore::A2,  TriCore::A3,
+  TriCore::A4,  TriCore::A5,  TriCore::A6,  TriCore::A7,
+  TriCore::A8,  TriCore::A9,  TriCore::A10, TriCore::A11,
+  TriCore::A12, TriCore::A13, TriCore::A14, TriCore::A15 };
+
+static const unsigned ExtRegs[] = {
+  TriCore::E0,  TriCore::E2,  TriCore::E4,  TriCore::E6,
+  TriCore::E8,  TriCore::E10, TriCore::E12, TriCore::E14 };
+
+/// matchRegisterName - The register with the given name, without the "%".
+/// A data register may be followed by the "l" or "u" of a halfword operand,
+/// which is returned in Suffix. Returns 0 if Name is not a register.
+static unsigned matchRegisterName(StringRef Name, StringRef &Suffix) {
+  Suffix = StringRef();
+  if (Name == "sp")
+    return TriCore::A10;
+  if (Name.size() < 2)
+    return 0;
+
+  StringRef Num = Name.substr(1);
+  if (Name[0] == 'd' && (Num.endswith("l") || Num.endswith("u"))) {
+    Suffix = Num.substr(Num.size() - 1);
+    Num = Num.drop_back();
+  }
+
+  unsigned N;
+  if (Num.getAsInteger(10, N) || N > 15)
+    return 0;
+
+  switch (Name[0]) {
+  case 'd':
+    return DataRegs[N];
+  case 'a':
+    return AddrRegs[N];
+  case 'e':
+    return N % 2 ? 0 : ExtRegs[N / 2];
+  default:
+    return 0;
+  }
+}
+
+/// applyModifier - Put a hi:, lo: or sm: modifier on a sym or sym+off
+/// expression. Returns null for anything else.
+static const MCExpr *applyModifier(const MCExpr *E,
+                                   MCSymbolRefExpr::VariantKind VK,
+                                   MCContext &Ctx) {
+  if (const MCSymbolRefExpr *SRE = dyn_cast<MCSymbolRefExpr>(E)) {
+    if (SRE->getKind() != MCSymbolRefExpr::VK_None)
+      return nullptr;
+    return MCSymbolRefExpr::create(&SRE->getSymbol(), VK, Ctx);
+  }
+
+  // The printer and the code emitter take the offset as a constant on the
+  // right.
+  const MCBinaryExpr *BE = dyn_cast<MCBinaryExpr>(E);
+  int64_t Off;
+  if (!BE || (BE->getOpcode() != MCBinaryExpr::Add &&
+              BE->getOpcode() != MCBinaryExpr::Sub) ||
+      !BE->getRHS()->evaluateAsAbsolute(Off))
+    return nullptr;
+  const MCExpr *Sym = applyModifier(BE->getLHS(), VK, Ctx);
+  if (!Sym)
+    return nullptr;
+  if (BE->getOpcode() == MCBinaryExpr::Sub)
+    Off = -Off;
+  return MCBinaryExpr::createAdd(Sym, MCConstantExpr::create(Off, Ctx), Ctx);
+}
+
+bool TriCoreAsmParser::parseRegister(unsigned &RegNo, StringRef &Suffix,
+                                     SMLoc &EndLoc) {
+  SMLoc S = getLexer().getLoc();
+  if (getLexer().isNot(AsmToken::Percent))
+    return Error(S, "expected register");
+  Lex();
+
+  const AsmToken &Tok = getLexer().getTok();
+  if (Tok.isNot(AsmToken::Identifier) ||
+      !(RegNo = matchRegisterName(Tok.getIdentifier().lower(), Suffix)))
+    return Error(S, "invalid register name");
+  EndLoc = Tok.getEndLoc();
+  Lex();
+  return false;
+}
+
+bool TriCoreAsmParser::ParseRegister(unsigned &RegNo, SMLoc &StartLoc,
+                                     SMLoc &EndLoc) {
+  StringRef Suffix;
+  StartLoc = getLexer().getLoc();
+  if (parseRegister(RegNo, Suffix, EndLoc))
+    return true;
+  if (!Suffix.empty())
+    return Error(StartLoc, "invalid register name");
+  return false;
+}
+
+/// parseImmediate - An expression, optionally with a hi:, lo: or sm:
+/// modifier. Constants are folded, so the range checks see them.
+bool TriCoreAsmParser::parseImmediate(const MCExpr *&Res, SMLoc &EndLoc) {
+  MCSymbolRefExpr::VariantKind VK = MCSymbolRefExpr::VK_None;
+  SMLoc S = getLexer().getLoc();
+  if (getLexer().is(AsmToken::Identifier) &&
+      getLexer().peekTok().is(AsmToken::Colon)) {
+    VK = StringSwitch<MCSymbolRefExpr::VariantKind>(
+             getLexer().getTok().getIdentifier())
+             .Case("hi", MCSymbolRefExpr::VK_TRICORE_HI_OFFSET)
+             .Case("lo", MCSymbolRefExpr::VK_TRICORE_LO_OFFSET)
+             .Case("sm", MCSymbolRefExpr::VK_TRICORE_SM)
+             .Default(MCSymbolRefExpr::VK_Invalid);
+    if (VK == MCSymbolRefExpr::VK_Invalid)
+      return Error(S, "unknown relocation modifier");
+    Lex();
+    Lex();
+  }
+
+  if (getParser().parseExpression(Res, EndLoc))
+    return true;
+
+  int64_t Value;
+  if (Res->evaluateAsAbsolute(Value)) {
+    // The halves of a constant address, as the linker would fill them in.
+    switch (VK) {
+    default:
+      break;
+    case MCSymbolRefExpr::VK_TRICORE_HI_OFFSET:
+      Value = ((Value + 0x8000) >> 16) & 0xffff;
+      break;
+    case MCSymbolRefExpr::VK_TRICORE_LO_OFFSET:
+      Value = SignExtend64<16>(Value);
+      break;
+    case MCSymbolRefExpr::VK_TRICORE_SM:
+      return Error(S, "sm: needs a symbol");
+    }
+    Res = MCConstantExpr::create(Value, getContext());
+    return false;
+  }
+
+  if (VK != MCSymbolRefExpr::VK_None &&
+      !(Res = applyModifier(Res, VK, getContext())))
+    return Error(S, "expected a symbol, optionally plus an offset");
+  return false;
+}
+
+/// parseMemOperand - "[%a] off", "[%a+] off" or "[+%a] off". The offset may
+/// be left out when it is 0.
+bool TriCoreAsmParser::parseMemOperand(OperandVector &Operands) {
+  SMLoc S = getLexer().getLoc();
+  Lex(); // Eat '['.
+
+  TriCoreOperand::AddrMode Mode = TriCoreOperand::BaseOffset;
+  if (getLexer().is(AsmToken::Plus)) {
+    Mode = TriCoreOperand::PreIncrement;
+    Lex();
+  }
+
+  unsigned Base;
+  StringRef Suffix;
+  SMLoc BaseLoc = getLexer().getLoc(), E;
+  if (parseRegister(Base, Suffix, E))
+    return true;
+  if (!Suffix.empty() ||
+      !getContext().getRegisterInfo()->getRegClass(
+          TriCore::AddrRegsRegClassID).contains(Base))
+    return Error(BaseLoc, "expected an address register");
+
+  if (Mode == TriCoreOperand::BaseOffset && getLexer().is(AsmToken::Plus)) {
+    Mode = TriCoreOperand::PostIncrement;
+    Lex();
+  }
+
+  if (getLexer().isNot(AsmToken::RBrac))
+    return Error(getLexer().getLoc(), "expected ']'");
+  E = getLexer().getTok().getEndLoc();
+  Lex();
+
+  const MCExpr *Off;
+  if (getLexer().is(AsmToken::Comma) ||
+      getLexer().is(AsmToken::EndOfStatement))
+    Off = MCConstantExpr::create(0, getContext());
+  else if (parseImmediate(Off, E))
+    return true;
+
+  Operands.push_back(TriCoreOperand::createMem(Base, Off, Mode, S, E));
+  return false;
+}
+
+bool TriCoreAsmParser::parseOperand(OperandVector &Operands) {
+  SMLoc S = getLexer().getLoc(), E;
+
+  switch (getLexer().getKind()) {
+  case AsmToken::Percent: {
+    unsigned RegNo;
+    StringRef Suffix;
+    if (parseRegister(RegNo, Suffix, E))
+      return true;
+    Operands.push_back(TriCoreOperand::createReg(RegNo, S, E));
+    if (!Suffix.empty())
+      Operands.push_back(TriCoreOperand::createToken(Suffix, E));
+    return false;
+  }
+  case AsmToken::LBrac:
+    return parseMemOperand(Operands);
+  default: {
+    const MCExpr *Expr;
+    if (parseImmediate(Expr, E))
+      return true;
+    Operands.push_back(TriCoreOperand::createImm(Expr, S, E));
+    return false;
+  }
+  }
+}
+
+bool TriCoreAsmParser::ParseInstruction(ParseInstructionInfo &Info,
+                                        StringRef Name, SMLoc NameLoc,
+                                        OperandVector &Operands) {
+  Operands.push_back(TriCoreOperand::createToken(Name, NameLoc));
+
+  if (getLexer().isNot(AsmToken::EndOfStatement)) {
+    if (parseOperand(Operands)) {
+      getParser().eatToEndOfStatement();
+      return true;
+    }
+
+    while (getLexer().is(AsmToken::Comma)) {
+      Lex();
+      if (parseOperand(Operands)) {
+        getParser().eatToEndOfStatement();
+        return true;
+      }
+    }
+
+    if (getLexer().isNot(AsmToken::EndOfStatement)) {
+      SMLoc Loc = getLexer().getLoc();
+      getParser().eatToEndOfStatement();
+      return Error(Loc, "unexpected token in argument list");
+    }
+  }
+
+  Lex(); // Consume the EndOfStatement.
+  return false;
+}
+
+/// ParseDirective - The data directives the generic parser does not know.
+bool TriCoreAsmParser::ParseDirective(AsmToken DirectiveID) {
+  StringRef IDVal = DirectiveID.getIdentifier();
+  if (IDVal == ".word")
+    return parseDirectiveWord(4, DirectiveID.getLoc());
+  if (IDVal == ".half")
+    return parseDirectiveWord(2, DirectiveID.getLoc());
+  return true;
+}
+
+bool TriCoreAsmParser::parseDirectiveWord(unsigned Size, SMLoc L) {
+  if (getLexer().isNot(AsmToken::EndOfStatement)) {
+    for (;;) {
+      const MCExpr *Value;
+      if (getParser().parseExpression(Value))
+        return true;
+
+      getParser().getStreamer().EmitValue(Value, Size, L);
+
+      if (getLexer().is(AsmToken::EndOfStatement))
+        break;
+
+      if (getLexer().isNot(AsmToken::Comma))
+        return Error(getLexer().getLoc(), "unexpected token in directive");
+      Lex();
+    }
+  }
+  Lex();
+  return false;
+}
+
+bool TriCoreAsmParser::MatchAndEmitInstruction(SMLoc IDLoc, unsigned &Opcode,
+                                               OperandVector &Operands,
+                                               MCStreamer &Out,
+                                               uint64_t &ErrorInfo,
+                                               bool MatchingInlineAsm) {
+  MCInst Inst;
+  switch (MatchInstructionImpl(Operands, Inst, ErrorInfo, MatchingInlineAsm)) {
+  case Match_Success: {
+    // The written back base of an increment form is not an assembly
+    // operand, the matcher leaves a placeholder for it.
+    const MCInstrDesc &Desc = MII.get(Inst.getOpcode());
+    for (unsigned I = 0, E = Desc.getNumOperands(); I != E; ++I) {
+      int Tied = Desc.getOperandConstraint(I, MCOI::TIED_TO);
+      if (Tied != -1 && Inst.getOperand(Tied).isImm() &&
+          Inst.getOperand(I).isReg())
+        Inst.getOperand(Tied) = Inst.getOperand(I);
+    }
+    Inst.setLoc(IDLoc);
+    Out.EmitInstruction(Inst, STI);
+    return false;
+  }
+
+  case Match_MissingFeature:
+    return Error(IDLoc,
+                 "instruction requires a CPU feature not currently enabled");
+
+  case Match_InvalidOperand: {
+    SMLoc ErrorLoc = IDLoc;
+    if (ErrorInfo != ~0ULL) {
+      if (ErrorInfo >= Operands.size())
+        return Error(IDLoc, "too few operands for instruction");
+
+      ErrorLoc = ((TriCoreOperand &)*Operands[ErrorInfo]).getStartLoc();
+      if (ErrorLoc == SMLoc())
+        ErrorLoc = IDLoc;
+    }
+    return Error(ErrorLoc, "invalid operand for instruction");
+  }
+
+  case Match_MnemonicFail:
+    return Error(IDLoc, "invalid instruction mnemonic");
+  }
+  llvm_unreachable("Implement any new match types added!");
+}
+
+extern "C" void LLVMInitializeTriCoreAsmParser() {
+  RegisterMCAsmParser<TriCoreAsmParser> X(TheTriCoreTarget);
+}
+
+#define GET_MATCHER_IMPLEMENTATION
+#include "TriCoreGenAsmMatcher.inc"
+
+unsigned TriCoreAsmParser::validateTargetOperandClass(MCParsedAsmOperand &GOp,
+                                                      unsigned Kind) {
+  TriCoreOperand &Op = static_cast<TriCoreOperand &>(GOp);
+  switch (Kind) {
+  default:
+    break;
+  // The literal shift operand of the Q format multiplies.
+  case MCK_1:
+    if (Op.isConstantImm(1))
+      return Match_Success;
+    break;
+  // The F registers are the D registers under another class, with the same
+  // name and encoding.
+  case MCK_FPRegs:
+    if (Op.isReg() && getContext().getRegisterInfo()->getRegClass(
+                          TriCore::DataRegsRegClassID).contains(Op.getReg()))
+      return Match_Success;
+    break;
+  }
+  return Match_InvalidOperand;
+}
@@ -0,0 +1,215 @@
+//===-- TriCoreDisassembler.cpp - Disassembler for TriCore ----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is part of the TriCore Disassembler. Bit 0 of the first halfword
+// tells a 32-bit instruction from a 16-bit one, each size has its own
+// generated decoder table.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MCTargetDesc/TriCoreMCTargetDesc.h"
+#include "llvm/MC/MCDisassembler.h"
+#include "llvm/MC/MCFixedLenDisassembler.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCSubtargetInfo.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/TargetRegistry.h"
+
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-disassembler"
+
+typedef MCDisassembler::DecodeStatus DecodeStatus;
+
+namespace {
+
+/// A disassembler class for TriCore.
+class TriCoreDisassembler : public MCDisassembler {
+public:
+  TriCoreDisassembler(const MCSubtargetInfo &STI, MCContext &Ctx)
+      : MCDisassembler(STI, Ctx) {}
+  virtual ~TriCoreDisassembler() {}
+
+  DecodeStatus getInstruction(MCInst &Instr, uint64_t &Size,
+                              ArrayRef<uint8_t> Bytes, uint64_t Address,
+                              raw_ostream &VStream,
+                              raw_ostream &CStream) const override;
+};
+}
+
+static MCDisassembler *createTriCoreDisassembler(const Target &T,
+                                                 const MCSubtargetInfo &STI,
+                                                 MCContext &Ctx) {
+  return new TriCoreDisassembler(STI, Ctx);
+}
+
+extern "C" void LLVMInitializeTriCoreDisassembler() {
+  // Register the disassembler.
+  TargetRegistry::RegisterMCDisassembler(TheTriCoreTarget,
+                                         createTriCoreDisassembler);
+}
+
+static const unsigned DataRegDecoderTable[] = {
+  TriCore::D0,  TriCore::D1,  TriCore::D2,  TriCore::D3,
+  TriCore::D4,  TriCore::D5,  TriCore::D6,  TriCore::D7,
+  TriCore::D8,  TriCore::D9,  TriCore::D10, TriCore::D11,
+  TriCore::D12, TriCore::D13, TriCore::D14, TriCore::D15 };
+
+static const unsigned AddrRegDecoderTable[] = {
+  TriCore::A0,  TriCore::A1,  TriCore::A2,  TriCore::A3,
+  TriCore::A4,  TriCore::A5,  TriCore::A6,  TriCore::A7,
+  TriCore::A8,  TriCore::A9,  TriCore::A10, TriCore::A11,
+  TriCore::A12, TriCore::A13, TriCore::A14, TriCore::A15 };
+
+static const unsigned FPRegDecoderTable[] = {
+  TriCore::F0,  TriCore::F1,  TriCore::F2,  TriCore::F3,
+  TriCore::F4,  TriCore::F5,  TriCore::F6,  TriCore::F7,
+  TriCore::F8,  TriCore::F9,  TriCore::F10, TriCore::F11,
+  TriCore::F12, TriCore::F13, TriCore::F14, TriCore::F15 };
+
+// Extended registers are named by their even half.
+static const unsigned ExtRegDecoderTable[] = {
+  TriCore::E0,  TriCore::E2,  TriCore::E4,  TriCore::E6,
+  TriCore::E8,  TriCore::E10, TriCore::E12, TriCore::E14 };
+
+static DecodeStatus DecodeDataRegsRegisterClass(MCInst &Inst, unsigned RegNo,
+                                                uint64_t Address,
+                                                const void *Decoder) {
+  if (RegNo > 15)
+    return MCDisassembler::Fail;
+  Inst.addOperand(MCOperand::createReg(DataRegDecoderTable[RegNo]));
+  return MCDisassembler::Success;
+}
+
+static DecodeStatus DecodeAddrRegsRegisterClass(MCInst &Inst, unsigned RegNo,
+                                                uint64_t Address,
+                                                const void *Decoder) {
+  if (RegNo > 15)
+    return MCDisassembler::Fail;
+  Inst.addOperand(MCOperand::createReg(AddrRegDecoderTable[RegNo]));
+  return MCDisassembler::Success;
+}
+
+static DecodeStatus DecodeFPRegsRegisterClass(MCInst &Inst, unsigned RegNo,
+                                              uint64_t Address,
+                                              const void *Decoder) {
+  if (RegNo > 15)
+    return MCDisassembler::Fail;
+  Inst.addOperand(MCOperand::createReg(FPRegDecoderTable[RegNo]));
+  return MCDisassembler::Success;
+}
+
+static DecodeStatus DecodeExtRegsRegisterClass(MCInst &Inst, unsigned RegNo,
+                                               uint64_t Address,
+                                               const void *Decoder) {
+  if (RegNo > 15 || RegNo % 2)
+    return MCDisassembler::Fail;
+  Inst.addOperand(MCOperand::createReg(ExtRegDecoderTable[RegNo / 2]));
+  return MCDisassembler::Success;
+}
+
+/// decodeMemSrc - Split a memsrc field into the base register in the low four
+/// bits and the signed offset above them.
+template <unsigned OffBits>
+static DecodeStatus decodeMemSrc(MCInst &Inst, unsigned Insn,
+                                 uint64_t Address, const void *Decoder) {
+  if (DecodeAddrRegsRegisterClass(Inst, Insn & 0xf, Address, Decoder) ==
+      MCDisassembler::Fail)
+    return MCDisassembler::Fail;
+  Inst.addOperand(MCOperand::createImm(SignExtend32<OffBits>(Insn >> 4)));
+  return MCDisassembler::Success;
+}
+
+/// decodeBranchTarget - Turn a displacement in halfwords into the byte offset
+/// the code emitter takes. disp4 is the only one that is zero extended.
+template <unsigned Bits>
+static DecodeStatus decodeBranchTarget(MCInst &Inst, unsigned Insn,
+                                       uint64_t Address, const void *Decoder) {
+  int32_t Disp = Bits == 4 ? Insn : SignExtend32<Bits>(Insn);
+  Inst.addOperand(MCOperand::createImm(Disp * 2));
+  return MCDisassembler::Success;
+}
+
+/// decodeIncrementData - The data register of a post- or pre-increment BO
+/// access, its class follows from the low bits of op2.
+static DecodeStatus decodeIncrementData(MCInst &Inst, unsigned Insn,
+                                        uint64_t Address, const void *Decoder) {
+  unsigned RegNo = (Insn >> 8) & 0xf;
+  switch ((Insn >> 22) & 0xf) {
+  case 5:
+    return DecodeExtRegsRegisterClass(Inst, RegNo, Address, Decoder);
+  case 6:
+    return DecodeAddrRegsRegisterClass(Inst, RegNo, Address, Decoder);
+  default:
+    return DecodeDataRegsRegisterClass(Inst, RegNo, Address, Decoder);
+  }
+}
+
+/// decodeIncrementMemSrc - The off10 of a BO access, with the base register
+/// in Inst{15-12}.
+static DecodeStatus decodeIncrementMemSrc(MCInst &Inst, unsigned Insn,
+                                          uint64_t Address,
+                                          const void *Decoder) {
+  unsigned MemSrc = ((Insn >> 12) & 0xf) | (((Insn >> 16) & 0x3f) << 4) |
+                    ((Insn >> 28) << 10);
+  return decodeMemSrc<10>(Inst, MemSrc, Address, Decoder);
+}
+
+/// decodeLoadIncrement - d, the written back base and the memsrc of a post-
+/// or pre-increment load.
+static DecodeStatus decodeLoadIncrement(MCInst &Inst, unsigned Insn,
+                                        uint64_t Address, const void *Decoder) {
+  if (decodeIncrementData(Inst, Insn, Address, Decoder) ==
+          MCDisassembler::Fail ||
+      DecodeAddrRegsRegisterClass(Inst, (Insn >> 12) & 0xf, Address,
+                                  Decoder) == MCDisassembler::Fail)
+    return MCDisassembler::Fail;
+  return decodeIncrementMemSrc(Inst, Insn, Address, Decoder);
+}
+
+/// decodeStoreIncrement - The written back base, d and the memsrc of a post-
+/// or pre-increment store.
+static DecodeStatus decodeStoreIncrement(MCInst &Inst, unsigned Insn,
+                                         uint64_t Address,
+                                         const void *Decoder) {
+  if (DecodeAddrRegsRegisterClass(Inst, (Insn >> 12) & 0xf, Address,
+                                  Decoder) == MCDisassembler::Fail ||
+      decodeIncrementData(Inst, Insn, Address, Decoder) ==
+          MCDisassembler::Fail)
+    return MCDisassembler::Fail;
+  return decodeIncrementMemSrc(Inst, Insn, Address, Decoder);
+}
+
+#include "TriCoreGenDisassemblerTables.inc"
+
+DecodeStatus TriCoreDisassembler::getInstruction(MCInst &Instr, uint64_t &Size,
+                                                 ArrayRef<uint8_t> Bytes,
+                                                 uint64_t Address,
+                                                 raw_ostream &VStream,
+                                                 raw_ostream &CStream) const {
+  Size = 0;
+  if (Bytes.size() < 2)
+    return MCDisassembler::Fail;
+
+  // Instructions are little endian halfwords, and bit 0 gives the length
+  // even when the encoding is unknown. Size is set on failure as well, so
+  // that a caller skipping the bad instruction stays on a halfword boundary.
+  uint32_t Insn = (Bytes[1] << 8) | Bytes[0];
+  if (!(Insn & 1)) {
+    Size = 2;
+    return decodeInstruction(DecoderTable16, Instr, Insn, Address, this, STI);
+  }
+
+  if (Bytes.size() < 4)
+    return MCDisassembler::Fail;
+
+  Size = 4;
+  Insn |= (uint32_t(Bytes[3]) << 24) | (Bytes[2] << 16);
+  return decodeInstruction(DecoderTable32, Instr, Insn, Address, this, STI);
+}
@@ -60,6 +60,8 @@ static void printExpr(const MCExpr *Expr, raw_ostream &OS) {
   	OS << "hi:";
   else if (Kind ==  MCSymbolRefExpr::VK_TRICORE_LO_OFFSET)
   	OS << "lo:";
+  else if (Kind == MCSymbolRefExpr::VK_TRICORE_SM)
+  	OS << "sm:";
   OS << SRE->getSymbol();
   if (Offset) {
     if (Offset > 0) {
@@ -89,7 +91,11 @@ void TriCoreInstPrinter::printSExtImm(const MCInst *MI, unsigned OpNo,
                                        raw_ostream &O) {
 
  //MI->getOperand(OpNo).dump();
- if(! MI->getOperand(OpNo).isImm()) return;
+ // A symbol, such as lo:sym of ADDI.
+ if(! MI->getOperand(OpNo).isImm()) {
+   printOperand(MI, OpNo, O);
+   return;
+ }
  int64_t Value = MI->getOperand(OpNo).getImm();
  Value = SignExtend32<bits>(Value);
  //outs()<< "Value: "<< Value <<"\n";
@@ -121,15 +127,34 @@ void TriCoreInstPrinter::printAddrModeMemSrc(const MCInst *MI, unsigned OpNum,
 	if (Base.getReg())
 			O << "[%" << StringRef(getRegisterName(Base.getReg())).lower() << ']';
 
-	if (Disp.isExpr())
-		Disp.getExpr()->print(O, &MAI);
-	else {
+	if (Disp.isExpr()) {
+		O << " ";
+		printExpr(Disp.getExpr(), O);
+	} else {
 		assert(Disp.isImm() && "Expected immediate in displacement field");
 		O << " " << Disp.getImm();
 	}
 
 }
 
+// Print the (Register, Offset) pair of a post-increment access, the base is
+// advanced by the offset after the access.
+void TriCoreInstPrinter::printAddrModePostInc(const MCInst *MI, unsigned OpNum,
+                                              raw_ostream &O) {
+  O << '[';
+  printRegName(O, MI->getOperand(OpNum).getReg());
+  O << "+] " << MI->getOperand(OpNum + 1).getImm();
+}
+
+// Print the (Register, Offset) pair of a pre-increment access, the base is
+// advanced by the offset before the access.
+void TriCoreInstPrinter::printAddrModePreInc(const MCInst *MI, unsigned OpNum,
+                                             raw_ostream &O) {
+  O << "[+";
+  printRegName(O, MI->getOperand(OpNum).getReg());
+  O << "] " << MI->getOperand(OpNum + 1).getImm();
+}
+
 void TriCoreInstPrinter::printOperand(const MCInst *MI, unsigned OpNo,
                                   raw_ostream &O) {
 
@@ -39,6 +39,8 @@ public:
 
 private:
   void printAddrModeMemSrc(const MCInst *MI, unsigned OpNum, raw_ostream &O);
+  void printAddrModePostInc(const MCInst *MI, unsigned OpNum, raw_ostream &O);
+  void printAddrModePreInc(const MCInst *MI, unsigned OpNum, raw_ostream &O);
   void printOperand(const MCInst *MI, unsigned OpNo, raw_ostream &O);
   void printMemOperand(const MCInst *MI, int opNum, raw_ostream &O);
   template <unsigned bits>
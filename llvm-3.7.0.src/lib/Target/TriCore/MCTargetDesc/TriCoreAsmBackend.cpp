@@ -17,6 +17,7 @@
 #include "llvm/MC/MCELFObjectWriter.h"
 #include "llvm/MC/MCExpr.h"
 #include "llvm/MC/MCFixupKindInfo.h"
+#include "llvm/MC/MCInst.h"
 #include "llvm/MC/MCMachObjectWriter.h"
 #include "llvm/MC/MCObjectWriter.h"
 #include "llvm/MC/MCSectionELF.h"
@@ -26,18 +27,11 @@
 #include "llvm/Support/ELF.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MachO.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/raw_ostream.h"
 using namespace llvm;
 
 namespace {
-class TriCoreELFObjectWriter : public MCELFObjectTargetWriter {
-public:
-  TriCoreELFObjectWriter(uint8_t OSABI)
-      : MCELFObjectTargetWriter(/*Is64Bit*/ false, OSABI, 
-                                /*ELF::EM_TriCore*/ ELF::EM_TRICORE,
-                                /*HasRelocationAddend*/ false) {}
-};
-
 class TriCoreAsmBackend : public MCAsmBackend {
 public:
   TriCoreAsmBackend(const Target &T, const StringRef TT) : MCAsmBackend() {}
@@ -56,7 +50,14 @@ public:
       // Name                      Offset (bits) Size (bits)     Flags
       { "fixup_leg_mov_hi16_pcrel", 0, 32, MCFixupKindInfo::FKF_IsPCRel },
       { "fixup_leg_mov_lo16_pcrel", 0, 32, MCFixupKindInfo::FKF_IsPCRel },
-			{ "fixup_call"							, 0, 24, 0 },
+      { "fixup_tricore_disp4",      8,  4, MCFixupKindInfo::FKF_IsPCRel },
+      { "fixup_tricore_disp8",      8,  8, MCFixupKindInfo::FKF_IsPCRel },
+      { "fixup_tricore_disp15",    16, 15, MCFixupKindInfo::FKF_IsPCRel },
+      { "fixup_tricore_disp24",     0, 32, MCFixupKindInfo::FKF_IsPCRel },
+      { "fixup_tricore_hiadj",     12, 16, 0 },
+      { "fixup_tricore_lo",        12, 16, 0 },
+      { "fixup_tricore_lo2",       16, 16, 0 },
+      { "fixup_tricore_sm16",      16, 16, 0 },
     };
 
     if (Kind < FirstTargetFixupKind) {
@@ -68,78 +69,167 @@ public:
     return Infos[Kind - FirstTargetFixupKind];
   }
 
-  /// processFixupValue - Target hook to process the literal value of a fixup
-  /// if necessary.
-  void processFixupValue(const MCAssembler &Asm, const MCAsmLayout &Layout,
-                         const MCFixup &Fixup, const MCFragment *DF,
-                         const MCValue &Target, uint64_t &Value,
-                         bool &IsResolved) override;
-
   void applyFixup(const MCFixup &Fixup, char *Data, unsigned DataSize,
                   uint64_t Value, bool IsPCRel) const override;
 
-  bool mayNeedRelaxation(const MCInst &Inst) const override { return false; }
+  bool mayNeedRelaxation(const MCInst &Inst) const override;
 
   bool fixupNeedsRelaxation(const MCFixup &Fixup, uint64_t Value,
                             const MCRelaxableFragment *DF,
-                            const MCAsmLayout &Layout) const override {
-    return false;
-  }
+                            const MCAsmLayout &Layout) const override;
 
-  void relaxInstruction(const MCInst &Inst, MCInst &Res) const override {}
+  void relaxInstruction(const MCInst &Inst, MCInst &Res) const override;
 
-  bool writeNopData(uint64_t Count, MCObjectWriter *OW) const override {
-    if (Count == 0) {
-      return true;
-    }
-    return false;
-  }
+  bool writeNopData(uint64_t Count, MCObjectWriter *OW) const override;
 
   unsigned getPointerSize() const { return 4; }
 };
 } // end anonymous namespace
 
-static unsigned adjustFixupValue(const MCFixup &Fixup, uint64_t Value,
-                                 MCContext *Ctx = NULL) {
+/// getRelaxedOpcode - The 32-bit form of a 16-bit branch, or the opcode
+/// itself if it has none.
+static unsigned getRelaxedOpcode(unsigned Op) {
+  switch (Op) {
+  default:                  return Op;
+  case TriCore::Jsb:        return TriCore::Jb;
+  case TriCore::JZsb:
+  case TriCore::JZsbr:      return TriCore::JZbrc;
+  case TriCore::JNZsb:
+  case TriCore::JNZsbr:     return TriCore::JNZbrc;
+  case TriCore::JZTsbrn:    return TriCore::JZTbrn;
+  case TriCore::JNZTsbrn:   return TriCore::JNZTbrn;
+  }
+}
+
+/// isBranchInRange - True if the byte displacement Value fits the field of a
+/// branch fixup.
+static bool isBranchInRange(unsigned Kind, int64_t Value) {
+  switch (Kind) {
+  default:
+    llvm_unreachable("Not a branch fixup!");
+  case TriCore::fixup_tricore_disp4:
+    return isShiftedUInt<4, 1>(Value);
+  case TriCore::fixup_tricore_disp8:
+    return isShiftedInt<8, 1>(Value);
+  case TriCore::fixup_tricore_disp15:
+    return isShiftedInt<15, 1>(Value);
+  case TriCore::fixup_tricore_disp24:
+    return isShiftedInt<24, 1>(Value);
+  }
+}
+
+bool TriCoreAsmBackend::mayNeedRelaxation(const MCInst &Inst) const {
+  return getRelaxedOpcode(Inst.getOpcode()) != Inst.getOpcode();
+}
+
+bool TriCoreAsmBackend::fixupNeedsRelaxation(const MCFixup &Fixup,
+                                             uint64_t Value,
+                                             const MCRelaxableFragment *DF,
+                                             const MCAsmLayout &Layout) const {
+  return !isBranchInRange(Fixup.getKind(), int64_t(Value));
+}
+
+void TriCoreAsmBackend::relaxInstruction(const MCInst &Inst,
+                                         MCInst &Res) const {
+  unsigned Op = Inst.getOpcode();
+  Res.setOpcode(getRelaxedOpcode(Op));
+  Res.addOperand(Inst.getOperand(0));
+
+  switch (Op) {
+  default:
+    llvm_unreachable("Unexpected opcode to relax!");
+  case TriCore::Jsb:
+    break;
+  case TriCore::JZsbr:
+  case TriCore::JNZsbr:
+    Res.addOperand(Inst.getOperand(1));
+    break;
+  // The 16-bit forms of these read D15 implicitly.
+  case TriCore::JZsb:
+  case TriCore::JNZsb:
+    Res.addOperand(MCOperand::createReg(TriCore::D15));
+    break;
+  case TriCore::JZTsbrn:
+  case TriCore::JNZTsbrn:
+    Res.addOperand(MCOperand::createReg(TriCore::D15));
+    Res.addOperand(Inst.getOperand(1));
+    break;
+  }
+}
+
+/// writeNopData - Pad with 32-bit NOPs, which take one fetch slot less than
+/// two 16-bit ones, and a 16-bit NOP for an odd halfword.
+bool TriCoreAsmBackend::writeNopData(uint64_t Count,
+                                     MCObjectWriter *OW) const {
+  if (Count % 2)
+    return false;
+
+  for (uint64_t i = 0, e = Count / 4; i != e; ++i)
+    OW->write32(0x0000000D); // nop (SYS)
+  if (Count % 4)
+    OW->write16(0x0000);     // nop (SR)
+  return true;
+}
+
+/// adjustFixupValue - Move the value of a resolved fixup into the fields of
+/// the instruction it patches.
+static unsigned adjustFixupValue(const MCFixup &Fixup, uint64_t Value) {
   unsigned Kind = Fixup.getKind();
-  outs() << "Fixup: " << Fixup.getKind() << "\n";
   switch (Kind) {
   default:
     llvm_unreachable("Unknown fixup kind!");
-  case TriCore::fixup_call:
-    	return Value & 0xffffff;
+  case FK_Data_1:
+  case FK_Data_2:
+  case FK_Data_4:
+    return Value;
   case TriCore::fixup_tricore_mov_hi16_pcrel:
     Value >>= 16;
   // Intentional fall-through
-  case TriCore::fixup_tricore_mov_lo16_pcrel:
+  case TriCore::fixup_tricore_mov_lo16_pcrel: {
     unsigned Hi4  = (Value & 0xF000) >> 12;
     unsigned Lo12 = Value & 0x0FFF;
     // inst{19-16} = Hi4;
     // inst{11-0} = Lo12;
     Value = (Hi4 << 16) | (Lo12);
     return Value;
-
   }
-  return Value;
-}
-
-void TriCoreAsmBackend::processFixupValue(const MCAssembler &Asm,
-                                      const MCAsmLayout &Layout,
-                                      const MCFixup &Fixup,
-                                      const MCFragment *DF,
-                                      const MCValue &Target, uint64_t &Value,
-                                      bool &IsResolved) {
-  // We always have resolved fixups for now.
-  IsResolved = true;
-  // At this point we'll ignore the value returned by adjustFixupValue as
-  // we are only checking if the fixup can be applied correctly.
-  (void)adjustFixupValue(Fixup, Value, &Asm.getContext());
+  // Branch displacements count halfwords.
+  case TriCore::fixup_tricore_disp4:
+    return ((Value >> 1) & 0xf) << 8;
+  case TriCore::fixup_tricore_disp8:
+    return ((Value >> 1) & 0xff) << 8;
+  case TriCore::fixup_tricore_disp15:
+    return ((Value >> 1) & 0x7fff) << 16;
+  case TriCore::fixup_tricore_disp24: {
+    unsigned Disp = (Value >> 1) & 0xffffff;
+    return ((Disp >> 16) << 8) | ((Disp & 0xffff) << 16);
+  }
+  case TriCore::fixup_tricore_hiadj:
+    return (((Value + 0x8000) >> 16) & 0xffff) << 12;
+  case TriCore::fixup_tricore_lo:
+    return (Value & 0xffff) << 12;
+  case TriCore::fixup_tricore_lo2:
+  case TriCore::fixup_tricore_sm16: {
+    unsigned Off = Value & 0xffff;
+    return ((Off & 0x3f) << 16) | (((Off >> 6) & 0xf) << 28) |
+           ((Off >> 10) << 22);
+  }
+  }
 }
 
 void TriCoreAsmBackend::applyFixup(const MCFixup &Fixup, char *Data,
                                unsigned DataSize, uint64_t Value,
                                bool isPCRel) const {
-  unsigned NumBytes = 4;
+  unsigned Kind = Fixup.getKind();
+  const MCFixupKindInfo &Info = getFixupKindInfo(Fixup.getKind());
+  unsigned NumBytes = (Info.TargetOffset + Info.TargetSize + 7) / 8;
+
+  // Relaxation has picked the widest form a branch can take by now.
+  if (Kind >= TriCore::fixup_tricore_disp4 &&
+      Kind <= TriCore::fixup_tricore_disp24 &&
+      !isBranchInRange(Kind, int64_t(Value)))
+    report_fatal_error("branch target out of range");
+
   Value = adjustFixupValue(Fixup, Value);
   if (!Value) {
     return; // Doesn't change encoding.
@@ -36,27 +36,48 @@ namespace {
 unsigned TriCoreELFObjectWriter::GetRelocType(const MCValue &Target,
                                           const MCFixup &Fixup,
                                           bool IsPCRel) const {
-  if (!IsPCRel) {
-    llvm_unreachable("Only dealying with PC-relative fixups for now");
+  unsigned Kind = Fixup.getKind();
+
+  if (IsPCRel) {
+    switch (Kind) {
+    default:
+      report_fatal_error("unsupported PC-relative relocation");
+    case FK_Data_4:
+      return ELF::R_TRICORE_32REL;
+    case TriCore::fixup_tricore_disp4:
+      return ELF::R_TRICORE_4REL;
+    case TriCore::fixup_tricore_disp8:
+      return ELF::R_TRICORE_8REL;
+    case TriCore::fixup_tricore_disp15:
+      return ELF::R_TRICORE_15REL;
+    case TriCore::fixup_tricore_disp24:
+      return ELF::R_TRICORE_24REL;
+    }
   }
 
-  unsigned Type = 0;
-  switch ((unsigned)Fixup.getKind()) {
+  switch (Kind) {
   default:
-    llvm_unreachable("Unimplemented");
-  case TriCore::fixup_tricore_mov_hi16_pcrel:
-    Type = ELF::R_ARM_MOVT_PREL;
-    break;
-  case TriCore::fixup_tricore_mov_lo16_pcrel:
-    Type = ELF::R_ARM_MOVW_PREL_NC;
-    break;
+    report_fatal_error("unsupported relocation");
+  case FK_Data_1:
+    return ELF::R_TRICORE_8ABS;
+  case FK_Data_2:
+    return ELF::R_TRICORE_16ABS;
+  case FK_Data_4:
+    return ELF::R_TRICORE_32ABS;
+  case TriCore::fixup_tricore_hiadj:
+    return ELF::R_TRICORE_HIADJ;
+  case TriCore::fixup_tricore_lo:
+    return ELF::R_TRICORE_LO;
+  case TriCore::fixup_tricore_lo2:
+    return ELF::R_TRICORE_LO2;
+  case TriCore::fixup_tricore_sm16:
+    return ELF::R_TRICORE_16SM;
   }
-  return Type;
 }
 
 TriCoreELFObjectWriter::TriCoreELFObjectWriter(uint8_t OSABI)
     : MCELFObjectTargetWriter(/*Is64Bit*/ false, OSABI, /*ELF::EM_TriCore*/ ELF::EM_TRICORE,
-                              /*HasRelocationAddend*/ false) {}
+                              /*HasRelocationAddend*/ true) {}
 
 TriCoreELFObjectWriter::~TriCoreELFObjectWriter() {}
 
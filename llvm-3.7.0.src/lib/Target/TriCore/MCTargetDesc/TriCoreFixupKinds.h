@@ -17,7 +17,22 @@ namespace TriCore {
 enum Fixups {
   fixup_tricore_mov_hi16_pcrel = FirstTargetFixupKind,
   fixup_tricore_mov_lo16_pcrel,
-	fixup_call,
+
+  // PC-relative branch displacements in halfwords. disp4 is zero extended,
+  // all others are sign extended.
+  fixup_tricore_disp4,  // SBR, SBRN: Inst{11-8}
+  fixup_tricore_disp8,  // SB: Inst{15-8}
+  fixup_tricore_disp15, // BRC, BRN, BRR: Inst{30-16}
+  fixup_tricore_disp24, // B: Inst{15-8} high byte, Inst{31-16} low half
+
+  // Halves of an absolute address. The low half is sign extended by ADDI and
+  // LEA, so the high half is adjusted for it.
+  fixup_tricore_hiadj,  // RLC: Inst{27-12}
+  fixup_tricore_lo,     // RLC: Inst{27-12}
+  fixup_tricore_lo2,    // BOL: off16 split over Inst{31-16}
+
+  // Offset of a small data object from the base in A0, laid out as lo2.
+  fixup_tricore_sm16,   // BOL: off16 split over Inst{31-16}
 
   // Marker
   LastTargetFixupKind,
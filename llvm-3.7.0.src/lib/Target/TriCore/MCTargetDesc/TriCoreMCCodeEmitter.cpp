@@ -63,6 +63,13 @@ public:
 															SmallVectorImpl<MCFixup> &Fixups,
 															const MCSubtargetInfo &STI) const;
 
+  /// encodeBranchTarget - Return the displacement of a branch in halfwords,
+  /// or record a fixup of the given kind for a symbolic target.
+  template <unsigned Kind>
+  unsigned encodeBranchTarget(const MCInst &MI, unsigned OpNo,
+                              SmallVectorImpl<MCFixup> &Fixups,
+                              const MCSubtargetInfo &STI) const;
+
   void EmitByte(unsigned char C, raw_ostream &OS) const
   {
   	OS << (char)C;
@@ -99,7 +106,8 @@ unsigned TriCoreMCCodeEmitter::encodeCallTarget(const MCInst &MI, unsigned OpNo,
   auto MO = MI.getOperand(OpNo);
 
   if (MO.isExpr()) {
-    MCFixupKind FixupKind = static_cast<MCFixupKind>(TriCore::fixup_call);
+    MCFixupKind FixupKind =
+        static_cast<MCFixupKind>(TriCore::fixup_tricore_disp24);
     Fixups.push_back(MCFixup::create(0, MO.getExpr(), FixupKind, MI.getLoc()));
     return 0;
   }
@@ -110,6 +118,23 @@ unsigned TriCoreMCCodeEmitter::encodeCallTarget(const MCInst &MI, unsigned OpNo,
   return target;
 }
 
+template <unsigned Kind>
+unsigned TriCoreMCCodeEmitter::encodeBranchTarget(const MCInst &MI,
+                                            unsigned OpNo,
+                                            SmallVectorImpl<MCFixup> &Fixups,
+                                            const MCSubtargetInfo &STI) const {
+  const MCOperand &MO = MI.getOperand(OpNo);
+
+  if (MO.isExpr()) {
+    Fixups.push_back(MCFixup::create(0, MO.getExpr(), MCFixupKind(Kind),
+                                     MI.getLoc()));
+    return 0;
+  }
+
+  assert(MO.isImm() && "unknown branch target operand");
+  return static_cast<unsigned>(MO.getImm()) >> 1;
+}
+
 /// getMachineOpValue - Return binary encoding of operand. If the machine
 /// operand requires relocation, record the relocation and return zero.
 unsigned TriCoreMCCodeEmitter::getMachineOpValue(const MCInst &MI,
@@ -146,14 +171,17 @@ unsigned TriCoreMCCodeEmitter::getMachineOpValue(const MCInst &MI,
 
   assert (Kind == MCExpr::SymbolRef);
 
-  cast<MCSymbolRefExpr>(Expr)->printVariantKind(outs());
   unsigned FixupKind;
   switch (cast<MCSymbolRefExpr>(Expr)->getKind()) {
   default:
     llvm_unreachable("Unknown fixup kind!");
-  case MCSymbolRefExpr::VK_TRICORE_LO_OFFSET:
+  // hi: and lo: only come as the const16 of MOVH, MOVH.A and ADDI.
   case MCSymbolRefExpr::VK_TRICORE_HI_OFFSET:
-		return 0;
+    FixupKind = TriCore::fixup_tricore_hiadj;
+    break;
+  case MCSymbolRefExpr::VK_TRICORE_LO_OFFSET:
+    FixupKind = TriCore::fixup_tricore_lo;
+    break;
   case MCSymbolRefExpr::VK_TRICORE_LO: {
     FixupKind = TriCore::fixup_tricore_mov_lo16_pcrel;
     break;
@@ -175,6 +203,21 @@ unsigned TriCoreMCCodeEmitter::getMemSrcValue(const MCInst &MI, unsigned OpIdx,
   const MCOperand &ImmMO = MI.getOperand(OpIdx + 1);
   //assert(ImmMO.getImm() >= 0);
   unsigned Reg = getMachineOpValue(MI, RegMO, Fixups, STI);
+
+  // lo:sym or sm:sym as the off16 of a BOL instruction.
+  if (ImmMO.isExpr()) {
+    const MCExpr *Expr = ImmMO.getExpr();
+    if (const MCBinaryExpr *BE = dyn_cast<MCBinaryExpr>(Expr))
+      Expr = BE->getLHS();
+    TriCore::Fixups FixupKind = TriCore::fixup_tricore_lo2;
+    if (cast<MCSymbolRefExpr>(Expr)->getKind() ==
+        MCSymbolRefExpr::VK_TRICORE_SM)
+      FixupKind = TriCore::fixup_tricore_sm16;
+    Fixups.push_back(MCFixup::create(0, ImmMO.getExpr(),
+                                     MCFixupKind(FixupKind), MI.getLoc()));
+    return Reg;
+  }
+
   int32_t offset = Reg | (ImmMO.getImm() << 4);
   return offset;
 }
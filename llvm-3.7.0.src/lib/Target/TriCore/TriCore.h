@@ -19,11 +19,20 @@
 #include "llvm/Target/TargetMachine.h"
 
 namespace llvm {
+class ModulePass;
+class Pass;
 class TargetMachine;
 class TriCoreTargetMachine;
 
 FunctionPass *createTriCoreISelDag(TriCoreTargetMachine &TM,
                                CodeGenOpt::Level OptLevel);
+FunctionPass *createTriCoreLoopLatchPass();
+FunctionPass *createTriCoreBranchRelaxPass();
+ModulePass *createTriCoreFastCallPass(CodeGenOpt::Level OptLevel);
+ModulePass *createTriCoreCSADepthPass();
+Pass *createTriCoreCallGraphOrderPass();
+FunctionPass *createTriCoreRegUsageCollectorPass(TriCoreTargetMachine &TM);
+FunctionPass *createTriCoreRegUsagePropagatePass(TriCoreTargetMachine &TM);
 } // end namespace llvm;
 
 #endif
@@ -15,10 +15,12 @@
 #define DEBUG_TYPE "asm-printer"
 #include "TriCore.h"
 #include "InstPrinter/TriCoreInstPrinter.h"
+#include "TriCoreFrameLowering.h"
 #include "TriCoreInstrInfo.h"
 #include "TriCoreMCInstLower.h"
 #include "TriCoreSubtarget.h"
 #include "TriCoreTargetMachine.h"
+#include "TriCoreTargetObjectFile.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/CodeGen/AsmPrinter.h"
@@ -36,6 +38,7 @@
 #include "llvm/MC/MCAsmInfo.h"
 #include "llvm/MC/MCExpr.h"
 #include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCInstBuilder.h"
 #include "llvm/MC/MCStreamer.h"
 #include "llvm/MC/MCSymbol.h"
 #include "llvm/Support/ErrorHandling.h"
@@ -60,6 +63,17 @@ public:
   void EmitFunctionEntryLabel();
   void EmitInstruction(const MachineInstr *MI);
   void EmitFunctionBodyStart();
+  void EmitFunctionBodyEnd();
+
+  bool PrintAsmOperand(const MachineInstr *MI, unsigned OpNo,
+                       unsigned AsmVariant, const char *ExtraCode,
+                       raw_ostream &O) override;
+  bool PrintAsmMemoryOperand(const MachineInstr *MI, unsigned OpNo,
+                             unsigned AsmVariant, const char *ExtraCode,
+                             raw_ostream &O) override;
+
+private:
+  void EmitInterruptVector(unsigned Priority);
 };
 } // end of anonymous namespace
 
@@ -67,17 +81,138 @@ void TriCoreAsmPrinter::EmitFunctionBodyStart() {
   MCInstLowering.Initialize(Mang, &MF->getContext());
 }
 
+void TriCoreAsmPrinter::EmitFunctionBodyEnd() {
+  if (unsigned Priority =
+          TriCoreFrameLowering::getInterruptPriority(*MF->getFunction()))
+    EmitInterruptVector(Priority);
+}
+
+/// EmitInterruptVector - Emit the vector table entry of an interrupt handler
+/// with a priority. Each entry has 32 bytes, too few for the handler itself,
+/// so it jumps there through A14:
+///
+///   movh.a %a14, hi:handler
+///   lea    %a14, [%a14] lo:handler
+///   ji     %a14
+void TriCoreAsmPrinter::EmitInterruptVector(unsigned Priority) {
+  const TriCoreTargetObjectFile &TLOF =
+      static_cast<const TriCoreTargetObjectFile &>(getObjFileLowering());
+  MCContext &Ctx = OutContext;
+  const MCExpr *Hi = MCSymbolRefExpr::create(
+      CurrentFnSym, MCSymbolRefExpr::VK_TRICORE_HI_OFFSET, Ctx);
+  const MCExpr *Lo = MCSymbolRefExpr::create(
+      CurrentFnSym, MCSymbolRefExpr::VK_TRICORE_LO_OFFSET, Ctx);
+
+  OutStreamer->PushSection();
+  OutStreamer->SwitchSection(TLOF.getInterruptVectorSection(Priority));
+  EmitAlignment(5);
+
+  MCInst MovH;
+  MovH.setOpcode(TriCore::MOVHArlc);
+  MovH.addOperand(MCOperand::createReg(TriCore::A14));
+  MovH.addOperand(MCOperand::createExpr(Hi));
+  EmitToStreamer(*OutStreamer, MovH);
+
+  MCInst Lea;
+  Lea.setOpcode(TriCore::LEAbol);
+  Lea.addOperand(MCOperand::createReg(TriCore::A14));
+  Lea.addOperand(MCOperand::createReg(TriCore::A14));
+  Lea.addOperand(MCOperand::createExpr(Lo));
+  EmitToStreamer(*OutStreamer, Lea);
+
+  MCInst Jump;
+  Jump.setOpcode(TriCore::JIsr);
+  Jump.addOperand(MCOperand::createReg(TriCore::A14));
+  EmitToStreamer(*OutStreamer, Jump);
+
+  OutStreamer->PopSection();
+}
+
 void TriCoreAsmPrinter::EmitFunctionEntryLabel() {
   OutStreamer->EmitLabel(CurrentFnSym);
 }
 
+/// getOverflowOpcode - The arithmetic half of an overflow pseudo, or 0.
+static unsigned getOverflowOpcode(unsigned Opc) {
+  switch (Opc) {
+  default:             return 0;
+  case TriCore::ADDVrr: return TriCore::ADDrr;
+  case TriCore::ADDVrc: return TriCore::ADDrc;
+  case TriCore::SUBVrr: return TriCore::SUBrr;
+  case TriCore::MULVrr: return TriCore::MULrr2;
+  }
+}
+
 void TriCoreAsmPrinter::EmitInstruction(const MachineInstr *MI) {
+  // The overflow pseudos split only here, after every pass that could move
+  // another PSW.V writer in between. The operation is followed by MFCR of
+  // PSW, core special function register 0xFE04.
+  if (unsigned Opc = getOverflowOpcode(MI->getOpcode())) {
+    MCOperand LHS = MCInstLowering.LowerOperand(MI->getOperand(2));
+    MCOperand RHS = MCInstLowering.LowerOperand(MI->getOperand(3));
+    EmitToStreamer(*OutStreamer, MCInstBuilder(Opc)
+                                     .addReg(MI->getOperand(0).getReg())
+                                     .addOperand(LHS)
+                                     .addOperand(RHS));
+    EmitToStreamer(*OutStreamer, MCInstBuilder(TriCore::MFCRrlc)
+                                     .addReg(MI->getOperand(1).getReg())
+                                     .addImm(0xFE04));
+    return;
+  }
+
   MCInst TmpInst;
   MCInstLowering.Lower(MI, TmpInst);
 
   EmitToStreamer(*OutStreamer, TmpInst);
 }
 
+/// PrintAsmOperand - Print an inline asm operand the way the instruction
+/// printer does, so the assembler parser reads it back.
+bool TriCoreAsmPrinter::PrintAsmOperand(const MachineInstr *MI, unsigned OpNo,
+                                        unsigned AsmVariant,
+                                        const char *ExtraCode,
+                                        raw_ostream &O) {
+  // The generic modifiers, such as 'c' for a bare constant.
+  if (ExtraCode && ExtraCode[0])
+    return AsmPrinter::PrintAsmOperand(MI, OpNo, AsmVariant, ExtraCode, O);
+
+  const MachineOperand &MO = MI->getOperand(OpNo);
+  switch (MO.getType()) {
+  case MachineOperand::MO_Register:
+    O << '%' << TriCoreInstPrinter::getRegisterName(MO.getReg());
+    return false;
+  case MachineOperand::MO_Immediate:
+    O << MO.getImm();
+    return false;
+  case MachineOperand::MO_GlobalAddress:
+    getSymbol(MO.getGlobal())->print(O, MAI);
+    printOffset(MO.getOffset(), O);
+    return false;
+  case MachineOperand::MO_MachineBasicBlock:
+    MO.getMBB()->getSymbol()->print(O, MAI);
+    return false;
+  default:
+    return true;
+  }
+}
+
+/// PrintAsmMemoryOperand - An "m" operand is an address register and an
+/// offset, see TriCoreDAGToDAGISel::SelectInlineAsmMemoryOperand.
+bool TriCoreAsmPrinter::PrintAsmMemoryOperand(const MachineInstr *MI,
+                                              unsigned OpNo,
+                                              unsigned AsmVariant,
+                                              const char *ExtraCode,
+                                              raw_ostream &O) {
+  if (ExtraCode && ExtraCode[0])
+    return true;
+
+  const MachineOperand &Base = MI->getOperand(OpNo);
+  const MachineOperand &Disp = MI->getOperand(OpNo + 1);
+  O << "[%" << TriCoreInstPrinter::getRegisterName(Base.getReg()) << "] "
+    << Disp.getImm();
+  return false;
+}
+
 // Force static initialization.
 extern "C" void LLVMInitializeTriCoreAsmPrinter() {
   RegisterAsmPrinter<TriCoreAsmPrinter> X(TheTriCoreTarget);
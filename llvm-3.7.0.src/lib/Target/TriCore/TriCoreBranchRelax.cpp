@@ -0,0 +1,431 @@
+//===-- TriCoreBranchRelax.cpp - Pick the shortest branch forms -----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Most TriCore branches come in several encodings that trade size for reach:
+//
+//   j     disp8   (SB)   +-256 bytes       j     disp24  (B)    +-16 MB
+//   jz    d15     (SB)   +-256 bytes       jz    Da      (SBR)  +30 bytes
+//   jz.t  d15, n  (SBRN) +30 bytes         jeq   Da, 0   (BRC)  +-32 KB
+//   jz.t  Da, n   (BRN)  +-32 KB
+//
+// Instruction selection always emits the short forms, some of which cannot
+// even reach backwards. This pass lays out the function from the sizes
+// returned by getInstSizeInBytes and widens every branch whose target is out
+// of reach, one step at a time until nothing changes. As sizes only grow,
+// this ends with the shortest forms that fit.
+//
+// A conditional branch that is out of reach of its widest form jumps around
+// a J instead:
+//
+//   jeq  %d2, 0, .LBB0_9         jne  %d2, 0, .LBB0_2
+//                          =>    j    .LBB0_9
+//                              .LBB0_2:
+//
+// JNED and JNEI step their counter, so they cannot be inverted and branch to
+// a J of their own instead.
+//
+// The assembler relaxes the same forms again for assembly input, see
+// TriCoreAsmBackend.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCore.h"
+#include "TriCoreInstrInfo.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/CodeGen/MachineFunctionPass.h"
+#include "llvm/CodeGen/MachineInstrBuilder.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Target/TargetSubtargetInfo.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-branch-relax"
+
+STATISTIC(NumShortened, "Number of branches given a 16-bit form or removed");
+STATISTIC(NumWidened,   "Number of branches given a longer form");
+STATISTIC(NumInverted,  "Number of conditional branches inverted around a J");
+
+namespace {
+  struct TriCoreBranchRelax : public MachineFunctionPass {
+    static char ID;
+    TriCoreBranchRelax() : MachineFunctionPass(ID) {}
+
+    bool runOnMachineFunction(MachineFunction &MF) override;
+
+    const char *getPassName() const override {
+      return "TriCore Branch Relaxation";
+    }
+
+  private:
+    const TriCoreInstrInfo *TII;
+    MachineFunction *MF;
+    // Offset of each block from the start of the function, by block number.
+    SmallVector<unsigned, 16> BlockOffset;
+
+    void computeBlockOffsets();
+    unsigned getInstrOffset(const MachineInstr &MI) const;
+    bool isInRange(const MachineInstr &MI, unsigned Opc,
+                   const MachineBasicBlock &Dest) const;
+    MachineInstr *setOpcode(MachineInstr &MI, unsigned Opc);
+    MachineBasicBlock *createBlockAfter(MachineBasicBlock &MBB);
+    void fixupOutOfRange(MachineInstr &MI);
+    bool relaxBranches();
+  };
+  char TriCoreBranchRelax::ID = 0;
+}
+
+/// createTriCoreBranchRelaxPass - returns an instance of the branch
+/// relaxation pass.
+FunctionPass *llvm::createTriCoreBranchRelaxPass() {
+  return new TriCoreBranchRelax();
+}
+
+/// getDestBlock - The block a direct branch jumps to, or null for any other
+/// instruction.
+static MachineBasicBlock *getDestBlock(const MachineInstr &MI) {
+  if (!MI.isBranch() || MI.isIndirectBranch())
+    return nullptr;
+  for (const MachineOperand &MO : MI.operands())
+    if (MO.isMBB())
+      return MO.getMBB();
+  return nullptr;
+}
+
+/// isInRange - True if a branch with opcode Opc reaches Disp bytes.
+static bool isInRange(unsigned Opc, int64_t Disp) {
+  switch (Opc) {
+  default:
+    llvm_unreachable("Unexpected branch opcode!");
+  case TriCore::JZsbr:
+  case TriCore::JNZsbr:
+  case TriCore::JZTsbrn:
+  case TriCore::JNZTsbrn:
+    return isShiftedUInt<4, 1>(Disp);
+  case TriCore::Jsb:
+  case TriCore::JZsb:
+  case TriCore::JNZsb:
+    return isShiftedInt<8, 1>(Disp);
+  case TriCore::JZbrc:
+  case TriCore::JNZbrc:
+  case TriCore::JZTbrn:
+  case TriCore::JNZTbrn:
+  case TriCore::JNEIbrc:
+  case TriCore::JNEIbrr:
+  case TriCore::JNEDbrc:
+  case TriCore::JNEDbrr:
+    return isShiftedInt<15, 1>(Disp);
+  case TriCore::Jb:
+    return isShiftedInt<24, 1>(Disp);
+  }
+}
+
+/// getOperands - Split a branch that has several forms into its target
+/// register and bit. The short forms test D15 implicitly.
+static void getOperands(const MachineInstr &MI, unsigned &Reg, int64_t &N) {
+  Reg = TriCore::D15;
+  N = 0;
+  for (const MachineOperand &MO : MI.explicit_operands()) {
+    if (MO.isReg())
+      Reg = MO.getReg();
+    else if (MO.isImm())
+      N = MO.getImm();
+  }
+}
+
+/// getShortestOpcode - The 16-bit form of the branch MI, if it has one that
+/// can encode its operands, and its own opcode otherwise.
+static unsigned getShortestOpcode(const MachineInstr &MI) {
+  unsigned Reg;
+  int64_t N;
+  getOperands(MI, Reg, N);
+
+  switch (MI.getOpcode()) {
+  default:                return MI.getOpcode();
+  case TriCore::Jb:       return TriCore::Jsb;
+  case TriCore::JZsb:
+  case TriCore::JZbrc:    return TriCore::JZsbr;
+  case TriCore::JNZsb:
+  case TriCore::JNZbrc:   return TriCore::JNZsbr;
+  case TriCore::JZTbrn:
+    return (Reg == TriCore::D15 && isUInt<4>(N)) ? TriCore::JZTsbrn
+                                                 : TriCore::JZTbrn;
+  case TriCore::JNZTbrn:
+    return (Reg == TriCore::D15 && isUInt<4>(N)) ? TriCore::JNZTsbrn
+                                                 : TriCore::JNZTbrn;
+  }
+}
+
+/// getWiderOpcode - The next form of the branch MI with a longer reach, or 0
+/// if it has none.
+static unsigned getWiderOpcode(const MachineInstr &MI) {
+  unsigned Reg;
+  int64_t N;
+  getOperands(MI, Reg, N);
+
+  switch (MI.getOpcode()) {
+  default:                return 0;
+  case TriCore::Jsb:      return TriCore::Jb;
+  case TriCore::JZsbr:
+    return Reg == TriCore::D15 ? TriCore::JZsb : TriCore::JZbrc;
+  case TriCore::JNZsbr:
+    return Reg == TriCore::D15 ? TriCore::JNZsb : TriCore::JNZbrc;
+  case TriCore::JZsb:     return TriCore::JZbrc;
+  case TriCore::JNZsb:    return TriCore::JNZbrc;
+  case TriCore::JZTsbrn:  return TriCore::JZTbrn;
+  case TriCore::JNZTsbrn: return TriCore::JNZTbrn;
+  }
+}
+
+/// getInvertedOpcode - The branch of the same form taken on the opposite
+/// condition, or 0 if there is none.
+static unsigned getInvertedOpcode(unsigned Opc) {
+  switch (Opc) {
+  default:                return 0;
+  case TriCore::JZsbr:    return TriCore::JNZsbr;
+  case TriCore::JNZsbr:   return TriCore::JZsbr;
+  case TriCore::JZsb:     return TriCore::JNZsb;
+  case TriCore::JNZsb:    return TriCore::JZsb;
+  case TriCore::JZbrc:    return TriCore::JNZbrc;
+  case TriCore::JNZbrc:   return TriCore::JZbrc;
+  case TriCore::JZTsbrn:  return TriCore::JNZTsbrn;
+  case TriCore::JNZTsbrn: return TriCore::JZTsbrn;
+  case TriCore::JZTbrn:   return TriCore::JNZTbrn;
+  case TriCore::JNZTbrn:  return TriCore::JZTbrn;
+  }
+}
+
+void TriCoreBranchRelax::computeBlockOffsets() {
+  MF->RenumberBlocks();
+  BlockOffset.resize(MF->getNumBlockIDs());
+
+  // The function itself is only aligned to MF->getAlignment(), so the
+  // padding in front of a block that wants more is only known to be below
+  // its alignment.
+  unsigned FnAlign = MF->getAlignment();
+  unsigned Offset = 0;
+  for (MachineBasicBlock &MBB : *MF) {
+    unsigned LogAlign = MBB.getAlignment();
+    if (LogAlign <= FnAlign)
+      Offset = RoundUpToAlignment(Offset, 1u << LogAlign);
+    else
+      Offset += (1u << LogAlign) - 2;
+    BlockOffset[MBB.getNumber()] = Offset;
+    for (const MachineInstr &MI : MBB)
+      Offset += TII->GetInstSizeInBytes(&MI);
+  }
+}
+
+unsigned TriCoreBranchRelax::getInstrOffset(const MachineInstr &MI) const {
+  const MachineBasicBlock &MBB = *MI.getParent();
+  unsigned Offset = BlockOffset[MBB.getNumber()];
+  for (MachineBasicBlock::const_iterator I = MBB.begin(); &*I != &MI; ++I)
+    Offset += TII->GetInstSizeInBytes(I);
+  return Offset;
+}
+
+bool TriCoreBranchRelax::isInRange(const MachineInstr &MI, unsigned Opc,
+                                   const MachineBasicBlock &Dest) const {
+  int64_t Disp = int64_t(BlockOffset[Dest.getNumber()]) - getInstrOffset(MI);
+  return ::isInRange(Opc, Disp);
+}
+
+/// setOpcode - Replace the branch MI by the same branch in the form Opc and
+/// return the new instruction.
+MachineInstr *TriCoreBranchRelax::setOpcode(MachineInstr &MI, unsigned Opc) {
+  MachineBasicBlock &MBB = *MI.getParent();
+  MachineBasicBlock *Dest = getDestBlock(MI);
+  unsigned Reg;
+  int64_t N;
+  getOperands(MI, Reg, N);
+
+  MachineInstrBuilder MIB =
+      BuildMI(MBB, &MI, MI.getDebugLoc(), TII->get(Opc)).addMBB(Dest);
+  switch (Opc) {
+  default:
+    llvm_unreachable("Unexpected branch opcode!");
+  case TriCore::Jsb:
+  case TriCore::Jb:
+  case TriCore::JZsb:
+  case TriCore::JNZsb:
+    break;
+  case TriCore::JZsbr:
+  case TriCore::JNZsbr:
+  case TriCore::JZbrc:
+  case TriCore::JNZbrc:
+    MIB.addReg(Reg);
+    break;
+  case TriCore::JZTsbrn:
+  case TriCore::JNZTsbrn:
+    MIB.addImm(N);
+    break;
+  case TriCore::JZTbrn:
+  case TriCore::JNZTbrn:
+    MIB.addReg(Reg).addImm(N);
+    break;
+  }
+
+  MI.eraseFromParent();
+  return MIB;
+}
+
+MachineBasicBlock *
+TriCoreBranchRelax::createBlockAfter(MachineBasicBlock &MBB) {
+  MachineBasicBlock *NewBB = MF->CreateMachineBasicBlock(MBB.getBasicBlock());
+  MF->insert(std::next(MachineFunction::iterator(MBB)), NewBB);
+  return NewBB;
+}
+
+/// fixupOutOfRange - Rewrite a conditional branch that not even its widest
+/// form can take to its target as a branch around, or to, a J.
+void TriCoreBranchRelax::fixupOutOfRange(MachineInstr &MI) {
+  MachineBasicBlock &MBB = *MI.getParent();
+  MachineBasicBlock *Dest = getDestBlock(MI);
+  DebugLoc DL = MI.getDebugLoc();
+
+  if (!MI.isConditionalBranch())
+    report_fatal_error("function too large for a direct branch");
+
+  // The other successor, either the target of a trailing J or the block
+  // falling through.
+  MachineBasicBlock::iterator Jmp = std::next(MachineBasicBlock::iterator(MI));
+  MachineBasicBlock *Other = Jmp != MBB.end()
+                                 ? getDestBlock(*Jmp)
+                                 : &*std::next(MachineFunction::iterator(MBB));
+  assert(Other && "Conditional branch without a second successor");
+
+  unsigned InvOpc = getInvertedOpcode(MI.getOpcode());
+  if (!InvOpc) {
+    // jned %d4, 5, .LBB0_9  =>  jned %d4, 5, .LBB0_3
+    // j    .LBB0_2              j    .LBB0_2
+    //                         .LBB0_3:
+    //                           j    .LBB0_9
+    MachineBasicBlock *NewBB = createBlockAfter(MBB);
+    if (Jmp == MBB.end())
+      BuildMI(&MBB, DL, TII->get(TriCore::Jsb)).addMBB(Other);
+    BuildMI(NewBB, DL, TII->get(TriCore::Jsb)).addMBB(Dest);
+    for (MachineOperand &MO : MI.operands())
+      if (MO.isMBB())
+        MO.setMBB(NewBB);
+    MBB.replaceSuccessor(Dest, NewBB);
+    if (!MBB.isSuccessor(Other))
+      MBB.addSuccessor(Other);
+    NewBB->addSuccessor(Dest);
+    return;
+  }
+
+  if (Other == Dest) {
+    MI.eraseFromParent();
+    return;
+  }
+
+  if (Jmp != MBB.end()) {
+    // jeq %d2, 0, .LBB0_9  =>  jne %d2, 0, .LBB0_2
+    // j   .LBB0_2              j   .LBB0_9
+    if (isInRange(MI, MI.getOpcode(), *Other)) {
+      Jmp->getOperand(0).setMBB(Dest);
+      MachineInstr *NewMI = setOpcode(MI, InvOpc);
+      for (MachineOperand &MO : NewMI->operands())
+        if (MO.isMBB())
+          MO.setMBB(Other);
+      ++NumInverted;
+      return;
+    }
+
+    // Give the J to the other successor a block of its own, so that MBB
+    // falls through to it.
+    MachineBasicBlock *NewBB = createBlockAfter(MBB);
+    NewBB->splice(NewBB->end(), &MBB, Jmp);
+    MBB.replaceSuccessor(Other, NewBB);
+    NewBB->addSuccessor(Other);
+  }
+
+  // Skip the new J if the condition fails.
+  MachineBasicBlock *FallThrough = &*std::next(MachineFunction::iterator(MBB));
+  MachineInstr *NewMI = setOpcode(MI, InvOpc);
+  for (MachineOperand &MO : NewMI->operands())
+    if (MO.isMBB())
+      MO.setMBB(FallThrough);
+  setOpcode(*NewMI, getShortestOpcode(*NewMI));
+  BuildMI(&MBB, DL, TII->get(TriCore::Jsb)).addMBB(Dest);
+  ++NumInverted;
+}
+
+/// relaxBranches - Widen the branches that are out of reach under the current
+/// layout. Return true if anything changed.
+bool TriCoreBranchRelax::relaxBranches() {
+  computeBlockOffsets();
+
+  bool Changed = false;
+  for (MachineBasicBlock &MBB : *MF) {
+    for (MachineBasicBlock::iterator I = MBB.getFirstTerminator(),
+                                     E = MBB.end(); I != E;) {
+      MachineInstr &MI = *I++;
+      MachineBasicBlock *Dest = getDestBlock(MI);
+      if (!Dest || isInRange(MI, MI.getOpcode(), *Dest))
+        continue;
+
+      DEBUG(dbgs() << "Branch to BB#" << Dest->getNumber()
+                   << " out of range: " << MI);
+      if (unsigned Opc = getWiderOpcode(MI)) {
+        setOpcode(MI, Opc);
+        ++NumWidened;
+        Changed = true;
+        continue;
+      }
+
+      // New blocks are not laid out yet, start over.
+      fixupOutOfRange(MI);
+      return true;
+    }
+  }
+  return Changed;
+}
+
+bool TriCoreBranchRelax::runOnMachineFunction(MachineFunction &Fn) {
+  MF = &Fn;
+  TII = static_cast<const TriCoreInstrInfo *>(
+      MF->getSubtarget().getInstrInfo());
+
+  // Start from the shortest forms. That of a J to the next block is none,
+  // the target has no branch analysis for BranchFolding to remove it.
+  bool Changed = false;
+  for (MachineFunction::iterator FI = MF->begin(), FE = MF->end(); FI != FE;
+       ++FI) {
+    MachineBasicBlock &MBB = *FI;
+    for (MachineBasicBlock::iterator I = MBB.getFirstTerminator(),
+                                     E = MBB.end(); I != E;) {
+      MachineInstr &MI = *I++;
+      MachineBasicBlock *Dest = getDestBlock(MI);
+      if (!Dest)
+        continue;
+      if (MI.isUnconditionalBranch() && I == E &&
+          std::next(FI) != FE && Dest == &*std::next(FI)) {
+        MI.eraseFromParent();
+        ++NumShortened;
+        Changed = true;
+        continue;
+      }
+      unsigned Opc = getShortestOpcode(MI);
+      if (Opc == MI.getOpcode())
+        continue;
+      setOpcode(MI, Opc);
+      ++NumShortened;
+      Changed = true;
+    }
+  }
+
+  while (relaxBranches())
+    Changed = true;
+
+  BlockOffset.clear();
+  return Changed;
+}
@@ -0,0 +1,53 @@
+//===-- TriCoreCCState.cpp - CCState with TriCore specific extensions -----===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCoreCCState.h"
+#include "llvm/IR/Function.h"
+
+using namespace llvm;
+
+void TriCoreCCState::PreAnalyzeFormalArguments(
+    const SmallVectorImpl<ISD::InputArg> &Ins) {
+  const Function *F = getMachineFunction().getFunction();
+
+  // Index the IR arguments once so that the lookup below stays linear.
+  SmallVector<const Argument *, 8> IRArgs;
+  for (const Argument &Arg : F->args())
+    IRArgs.push_back(&Arg);
+
+  for (unsigned i = 0, e = Ins.size(); i != e; ++i) {
+    // A demoted return value arrives as a hidden sret pointer that has no
+    // IR argument of its own.
+    if (!Ins[i].isOrigArg()) {
+      OriginalArgWasPointer.push_back(Ins[i].Flags.isSRet());
+      continue;
+    }
+    const Argument *Arg = IRArgs[Ins[i].getOrigArgIndex()];
+    OriginalArgWasPointer.push_back(Arg->getType()->isPointerTy());
+  }
+}
+
+void TriCoreCCState::PreAnalyzeCallOperands(
+    const SmallVectorImpl<ISD::OutputArg> &Outs,
+    const std::vector<TargetLowering::ArgListEntry> &FuncArgs) {
+  for (unsigned i = 0, e = Outs.size(); i != e; ++i) {
+    const TargetLowering::ArgListEntry &Arg = FuncArgs[Outs[i].OrigArgIndex];
+    OriginalArgWasPointer.push_back(Arg.Ty->isPointerTy() ||
+                                    Outs[i].Flags.isSRet());
+    // Libcalls are made with no fixed operands at all; only a variadic call
+    // has unnamed ones.
+    CallOperandIsFixed.push_back(Outs[i].IsFixed || !isVarArg());
+  }
+}
+
+void TriCoreCCState::PreAnalyzeReturnType(unsigned NumValues,
+                                          const Type *RetTy) {
+  bool IsPointer = RetTy && RetTy->isPointerTy();
+  OriginalArgWasPointer.assign(NumValues, IsPointer);
+}
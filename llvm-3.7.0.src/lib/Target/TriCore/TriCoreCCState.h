@@ -0,0 +1,109 @@
+//===-- TriCoreCCState.h - CCState with TriCore specific extensions -------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// The TriCore EABI passes pointers in the address registers and everything
+// else in the data registers. Pointers are lowered to plain i32 values before
+// the calling convention sees them, so this CCState records which lowered
+// values started out as pointers. The record lives only as long as a single
+// Analyze* call, which keeps argument assignment reentrant and independent of
+// the rest of the module.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TRICORECCSTATE_H
+#define TRICORECCSTATE_H
+
+#include "TriCoreISelLowering.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/CodeGen/CallingConvLower.h"
+
+namespace llvm {
+
+class TriCoreCCState : public CCState {
+  /// Records whether the lowered value at each index originated from a
+  /// pointer-typed IR value.
+  SmallVector<bool, 4> OriginalArgWasPointer;
+
+  /// Records whether the value was a fixed argument.
+  /// See ISD::OutputArg::IsFixed.
+  SmallVector<bool, 4> CallOperandIsFixed;
+
+  /// Identify the incoming formal arguments that are pointers.
+  void PreAnalyzeFormalArguments(const SmallVectorImpl<ISD::InputArg> &Ins);
+
+  /// Identify the outgoing call operands that are pointers.
+  void PreAnalyzeCallOperands(
+      const SmallVectorImpl<ISD::OutputArg> &Outs,
+      const std::vector<TargetLowering::ArgListEntry> &FuncArgs);
+
+  /// Mark every part of a return value of type \p RetTy.
+  void PreAnalyzeReturnType(unsigned NumValues, const Type *RetTy);
+
+public:
+  TriCoreCCState(CallingConv::ID CC, bool isVarArg, MachineFunction &MF,
+                 SmallVectorImpl<CCValAssign> &locs, LLVMContext &C)
+      : CCState(CC, isVarArg, MF, locs, C) {}
+
+  void AnalyzeFormalArguments(const SmallVectorImpl<ISD::InputArg> &Ins,
+                              CCAssignFn Fn) {
+    PreAnalyzeFormalArguments(Ins);
+    CCState::AnalyzeFormalArguments(Ins, Fn);
+    OriginalArgWasPointer.clear();
+  }
+
+  void AnalyzeCallOperands(
+      const SmallVectorImpl<ISD::OutputArg> &Outs, CCAssignFn Fn,
+      const std::vector<TargetLowering::ArgListEntry> &FuncArgs) {
+    PreAnalyzeCallOperands(Outs, FuncArgs);
+    CCState::AnalyzeCallOperands(Outs, Fn);
+    OriginalArgWasPointer.clear();
+    CallOperandIsFixed.clear();
+  }
+
+  // The AnalyzeCallOperands in the base class cannot see the IR argument
+  // types. Delete it from this class.
+  void AnalyzeCallOperands(const SmallVectorImpl<ISD::OutputArg> &Outs,
+                           CCAssignFn Fn) = delete;
+
+  void AnalyzeCallResult(const SmallVectorImpl<ISD::InputArg> &Ins,
+                         CCAssignFn Fn, const Type *RetTy) {
+    PreAnalyzeReturnType(Ins.size(), RetTy);
+    CCState::AnalyzeCallResult(Ins, Fn);
+    OriginalArgWasPointer.clear();
+  }
+
+  void AnalyzeReturn(const SmallVectorImpl<ISD::OutputArg> &Outs,
+                     CCAssignFn Fn, const Type *RetTy) {
+    PreAnalyzeReturnType(Outs.size(), RetTy);
+    CCState::AnalyzeReturn(Outs, Fn);
+    OriginalArgWasPointer.clear();
+  }
+
+  bool CheckReturn(const SmallVectorImpl<ISD::OutputArg> &Outs,
+                   CCAssignFn Fn) {
+    OriginalArgWasPointer.assign(Outs.size(), false);
+    bool Return = CCState::CheckReturn(Outs, Fn);
+    OriginalArgWasPointer.clear();
+    return Return;
+  }
+
+  bool WasOriginalArgPointer(unsigned ValNo) const {
+    return ValNo < OriginalArgWasPointer.size() &&
+           OriginalArgWasPointer[ValNo];
+  }
+
+  /// Variadic operands of a call go on the stack. Formal arguments and
+  /// return values are always fixed.
+  bool IsCallOperandFixed(unsigned ValNo) const {
+    return ValNo >= CallOperandIsFixed.size() || CallOperandIsFixed[ValNo];
+  }
+};
+}
+
+#endif
@@ -0,0 +1,214 @@
+//===-- TriCoreCSADepth.cpp - Worst-case CSA use along the call graph -----===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Every CALL and every interrupt takes a CSA frame off the free context list
+// for the upper context, SVLCX and BISR take one more for the lower context.
+// When the list runs empty the core traps with FCD, which usually means a
+// reset in the field.
+//
+// This pass computes how many frames each call graph root may hold at once
+// and adds to each interrupt handler the frames of the code it can preempt:
+// the deepest non-interrupt root and every nested handler of lower priority.
+// If that exceeds the pool set up by the startup code, it warns.
+//
+// Functions outside the module are taken to use one frame, so the result is
+// a lower bound for code calling into libraries.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCore.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SCCIterator.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Analysis/CallGraph.h"
+#include "llvm/IR/DiagnosticInfo.h"
+#include "llvm/IR/DiagnosticPrinter.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/InitializePasses.h"
+#include "llvm/Pass.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/raw_ostream.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-csa-depth"
+
+static cl::opt<unsigned> CSAPoolSize(
+    "tricore-csa-pool", cl::Hidden, cl::init(64),
+    cl::desc("Number of CSA frames on the free context list, 0 disables the "
+             "exhaustion warning"));
+
+static cl::opt<bool> PrintCSADepth(
+    "tricore-print-csa-depth", cl::Hidden, cl::init(false),
+    cl::desc("Print the worst-case CSA depth of every call graph root"));
+
+namespace {
+  /// A warning about an interrupt handler that may drain the CSA pool.
+  class DiagnosticInfoCSADepth : public DiagnosticInfo {
+    const Function &Fn;
+    unsigned Depth;
+
+  public:
+    static int Kind;
+
+    DiagnosticInfoCSADepth(const Function &Fn, unsigned Depth)
+        : DiagnosticInfo(Kind, DS_Warning), Fn(Fn), Depth(Depth) {}
+
+    void print(DiagnosticPrinter &DP) const override {
+      DP << "interrupt handler '" << Fn.getName() << "' ";
+      if (Depth == ~0U)
+        DP << "reaches recursive code and may exhaust the CSA pool";
+      else
+        DP << "may need " << Depth << " CSA frames, more than the pool of "
+           << CSAPoolSize;
+    }
+  };
+  int DiagnosticInfoCSADepth::Kind = getNextAvailablePluginDiagnosticKind();
+
+  struct TriCoreCSADepth : public ModulePass {
+    static char ID;
+    TriCoreCSADepth() : ModulePass(ID) {
+      // llc only registers the code generator's own passes.
+      initializeCallGraphWrapperPassPass(*PassRegistry::getPassRegistry());
+    }
+
+    bool runOnModule(Module &M) override;
+
+    void print(raw_ostream &OS, const Module *M) const override;
+
+    void getAnalysisUsage(AnalysisUsage &AU) const override {
+      AU.addRequired<CallGraphWrapperPass>();
+      AU.setPreservesAll();
+    }
+
+    const char *getPassName() const override {
+      return "TriCore CSA Depth Analysis";
+    }
+
+  private:
+    // Worst-case frames held by a function and its callees, ~0U if it may
+    // recurse.
+    DenseMap<const Function *, unsigned> Depth;
+    std::vector<const Function *> Roots;
+
+    unsigned getDepth(const CallGraphNode *CGN) const;
+  };
+  char TriCoreCSADepth::ID = 0;
+}
+
+/// createTriCoreCSADepthPass - returns an instance of the CSA depth analysis.
+ModulePass *llvm::createTriCoreCSADepthPass() {
+  return new TriCoreCSADepth();
+}
+
+static unsigned addDepth(unsigned A, unsigned B) {
+  return (A == ~0U || B == ~0U) ? ~0U : A + B;
+}
+
+static bool isInterruptHandler(const Function &F) {
+  return F.hasFnAttribute("interrupt");
+}
+
+/// getPriority - The priority of an interrupt handler, or 0 if unknown.
+static unsigned getPriority(const Function &F) {
+  unsigned Priority;
+  if (F.getFnAttribute("interrupt").getValueAsString().getAsInteger(10,
+                                                                    Priority))
+    return 0;
+  return Priority;
+}
+
+/// getOwnFrames - The CSA frames F takes on entry, see the frame lowering.
+static unsigned getOwnFrames(const CallGraphNode &CGN) {
+  const Function &F = *CGN.getFunction();
+  if (isInterruptHandler(F))
+    return (F.hasFnAttribute("interrupt-nested") || CGN.size()) ? 2 : 1;
+  // JL and FCALL leave the context list alone.
+  return F.getCallingConv() == CallingConv::Fast ? 0 : 1;
+}
+
+unsigned TriCoreCSADepth::getDepth(const CallGraphNode *CGN) const {
+  const Function *F = CGN->getFunction();
+  if (!F || F->isDeclaration())
+    return 1;
+  auto I = Depth.find(F);
+  assert(I != Depth.end() && "Callee not visited bottom-up");
+  return I->second;
+}
+
+bool TriCoreCSADepth::runOnModule(Module &M) {
+  CallGraph &CG = getAnalysis<CallGraphWrapperPass>().getCallGraph();
+  Depth.clear();
+  Roots.clear();
+
+  SmallPtrSet<const Function *, 32> Called;
+  for (scc_iterator<CallGraph *> I = scc_begin(&CG); !I.isAtEnd(); ++I) {
+    for (const CallGraphNode *CGN : *I) {
+      const Function *F = CGN->getFunction();
+      if (!F || F->isDeclaration())
+        continue;
+
+      unsigned Callees = 0;
+      for (const CallGraphNode::CallRecord &CR : *CGN) {
+        Called.insert(CR.second->getFunction());
+        Callees = std::max(Callees, I.hasLoop() ? ~0U : getDepth(CR.second));
+      }
+      Depth[F] = addDepth(getOwnFrames(*CGN), Callees);
+    }
+  }
+
+  // Roots are entered from outside the module, by reset or by an interrupt.
+  unsigned MainDepth = 0;
+  for (const Function &F : M) {
+    if (F.isDeclaration() || (Called.count(&F) && !isInterruptHandler(F)))
+      continue;
+    Roots.push_back(&F);
+    if (!isInterruptHandler(F))
+      MainDepth = std::max(MainDepth, Depth[&F]);
+  }
+
+  if (PrintCSADepth)
+    print(errs(), &M);
+
+  if (!CSAPoolSize)
+    return false;
+
+  for (const Function *H : Roots) {
+    if (!isInterruptHandler(*H))
+      continue;
+
+    // Nested handlers reopen interrupts, so H may preempt every one of them
+    // with a lower priority on top of the main program.
+    unsigned Total = addDepth(MainDepth, Depth[H]);
+    unsigned Priority = getPriority(*H);
+    for (const Function *N : Roots)
+      if (N != H && N->hasFnAttribute("interrupt-nested") &&
+          (!Priority || getPriority(*N) < Priority))
+        Total = addDepth(Total, Depth[N]);
+
+    if (Total > CSAPoolSize)
+      M.getContext().diagnose(DiagnosticInfoCSADepth(*H, Total));
+  }
+  return false;
+}
+
+void TriCoreCSADepth::print(raw_ostream &OS, const Module *M) const {
+  OS << "Worst-case CSA depth of the call graph roots:\n";
+  for (const Function *F : Roots) {
+    unsigned D = Depth.lookup(F);
+    OS << "  " << F->getName() << ": ";
+    if (D == ~0U)
+      OS << "unbounded";
+    else
+      OS << D;
+    if (isInterruptHandler(*F))
+      OS << " (interrupt)";
+    OS << '\n';
+  }
+}
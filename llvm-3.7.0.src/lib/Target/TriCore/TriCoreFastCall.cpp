@@ -0,0 +1,178 @@
+//===-- TriCoreFastCall.cpp - Pick the functions called with JL/FCALL -----===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// CALL saves the whole upper context to a CSA and RET reloads it, which costs
+// more than the body of a small helper. A fastcc function is entered with JL
+// (FCALL on TC1.6.2) instead and keeps only the upper registers it touches
+// itself, see CSR_FastCC.
+//
+// This pass walks the call graph bottom-up and gives fastcc to the internal
+// functions that only ever are called directly, are small and make no calls
+// of their own except to other fastcc functions. Every other internal
+// function that came in as fastcc, e.g. from GlobalOpt, goes back to the C
+// convention.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCore.h"
+#include "llvm/ADT/SCCIterator.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/CallGraph.h"
+#include "llvm/IR/CallSite.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Module.h"
+#include "llvm/InitializePasses.h"
+#include "llvm/Pass.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/MathExtras.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-fastcall"
+
+STATISTIC(NumFastCalls, "Number of functions called with JL/FCALL");
+
+static cl::opt<unsigned> FastCallThreshold(
+    "tricore-fastcall-threshold", cl::Hidden, cl::init(40),
+    cl::desc("Largest function, in IR instructions, called with JL/FCALL"));
+
+namespace {
+  struct TriCoreFastCall : public ModulePass {
+    static char ID;
+    explicit TriCoreFastCall(CodeGenOpt::Level OptLevel)
+        : ModulePass(ID), OptLevel(OptLevel) {
+      // llc only registers the code generator's own passes.
+      initializeCallGraphWrapperPassPass(*PassRegistry::getPassRegistry());
+    }
+
+    bool runOnModule(Module &M) override;
+
+    void getAnalysisUsage(AnalysisUsage &AU) const override {
+      AU.addRequired<CallGraphWrapperPass>();
+      AU.setPreservesCFG();
+    }
+
+    const char *getPassName() const override {
+      return "TriCore Fast Call Selection";
+    }
+
+  private:
+    CodeGenOpt::Level OptLevel;
+    SmallPtrSet<const Function *, 16> FastFuncs;
+
+    bool isProfitable(const CallGraphNode &CGN) const;
+  };
+  char TriCoreFastCall::ID = 0;
+}
+
+/// createTriCoreFastCallPass - returns an instance of the fast call pass.
+ModulePass *llvm::createTriCoreFastCallPass(CodeGenOpt::Level OptLevel) {
+  return new TriCoreFastCall(OptLevel);
+}
+
+/// hasOnlyDirectCalls - True if every use of F is a call to it, so the
+/// convention can be changed on both sides.
+static bool hasOnlyDirectCalls(const Function &F) {
+  for (const Use &U : F.uses()) {
+    ImmutableCallSite CS(U.getUser());
+    if (!CS || !CS.isCallee(&U))
+      return false;
+  }
+  return true;
+}
+
+/// hasRegisterArgs - True if all arguments of F travel in registers. Neither
+/// JL nor FCALL give the callee a stack of its own for them.
+static bool hasRegisterArgs(const Function &F) {
+  unsigned DataRegs = 0, AddrRegs = 0;
+  for (const Argument &Arg : F.args()) {
+    Type *Ty = Arg.getType();
+    if (Arg.hasByValAttr())
+      return false;
+    if (Ty->isPointerTy())
+      ++AddrRegs;
+    else if (Ty->isIntegerTy(64))
+      DataRegs = RoundUpToAlignment(DataRegs, 2) + 2;
+    else if (Ty->isIntegerTy() || Ty->isFloatTy())
+      ++DataRegs;
+    else
+      return false;
+  }
+  return DataRegs <= 4 && AddrRegs <= 4;
+}
+
+bool TriCoreFastCall::isProfitable(const CallGraphNode &CGN) const {
+  const Function &F = *CGN.getFunction();
+  if (OptLevel == CodeGenOpt::None || F.hasFnAttribute(Attribute::OptimizeNone))
+    return false;
+  if (F.hasFnAttribute("interrupt") || F.hasFnAttribute(Attribute::Naked))
+    return false;
+  if (F.isVarArg() || !hasRegisterArgs(F))
+    return false;
+
+  // Any call other than to another fastcc leaf needs a context save anyway,
+  // so JL would only add the A11 spill on top of it.
+  for (const CallGraphNode::CallRecord &CR : CGN) {
+    const Function *Callee = CR.second->getFunction();
+    if (!Callee || Callee == &F || !FastFuncs.count(Callee))
+      return false;
+  }
+
+  unsigned Size = 0;
+  for (const BasicBlock &BB : F)
+    for (const Instruction &I : BB) {
+      // A frame pointer costs a save and restore of the caller's A14.
+      // Dynamic allocas and llvm.frameaddress make hasFP true for fastcc.
+      if (const AllocaInst *AI = dyn_cast<AllocaInst>(&I))
+        if (!AI->isStaticAlloca())
+          return false;
+      if (const IntrinsicInst *II = dyn_cast<IntrinsicInst>(&I))
+        if (II->getIntrinsicID() == Intrinsic::frameaddress)
+          return false;
+      if (++Size > FastCallThreshold)
+        return false;
+    }
+  return true;
+}
+
+bool TriCoreFastCall::runOnModule(Module &M) {
+  CallGraph &CG = getAnalysis<CallGraphWrapperPass>().getCallGraph();
+  FastFuncs.clear();
+
+  bool Changed = false;
+  for (scc_iterator<CallGraph *> I = scc_begin(&CG); !I.isAtEnd(); ++I) {
+    const std::vector<CallGraphNode *> &SCC = *I;
+    for (CallGraphNode *CGN : SCC) {
+      Function *F = CGN->getFunction();
+      if (!F || F->isDeclaration() || !F->hasLocalLinkage())
+        continue;
+      CallingConv::ID CC = F->getCallingConv();
+      if (CC != CallingConv::C && CC != CallingConv::Fast)
+        continue;
+      if (!hasOnlyDirectCalls(*F))
+        continue;
+
+      bool Fast = SCC.size() == 1 && !I.hasLoop() && isProfitable(*CGN);
+      CallingConv::ID NewCC = Fast ? CallingConv::Fast : CallingConv::C;
+      if (Fast) {
+        FastFuncs.insert(F);
+        ++NumFastCalls;
+      }
+      if (NewCC == CC)
+        continue;
+
+      F->setCallingConv(NewCC);
+      for (Use &U : F->uses())
+        CallSite(U.getUser()).setCallingConv(NewCC);
+      Changed = true;
+    }
+  }
+  return Changed;
+}
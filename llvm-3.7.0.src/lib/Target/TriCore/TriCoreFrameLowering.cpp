@@ -42,6 +42,11 @@ bool TriCoreFrameLowering::hasFP(const MachineFunction &MF) const {
 
 	const MachineFrameInfo *MFI = MF.getFrameInfo();
 
+  // A14 belongs to the caller of a fastcc function, so it is only taken over
+  // when the frame really cannot do without it.
+  if (isFastCall(MF))
+    return MFI->hasVarSizedObjects() || MFI->isFrameAddressTaken();
+
   return (MF.getTarget().Options.DisableFramePointerElim(MF) ||
          MF.getFrameInfo()->hasVarSizedObjects() ||
 				 MFI->isFrameAddressTaken()) ;
@@ -57,37 +62,93 @@ uint64_t TriCoreFrameLowering::computeStackSize(MachineFunction &MF) const {
   return StackSize;
 }
 
-// Materialize an offset for a ADD/SUB stack operation.
-// Return zero if the offset fits into the instruction as an immediate,
-// or the number of the register where the offset is materialized.
-static unsigned materializeOffset(MachineFunction &MF, MachineBasicBlock &MBB,
-                                  MachineBasicBlock::iterator MBBI,
-                                  unsigned Offset) {
-  const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
-  DebugLoc dl = MBBI != MBB.end() ? MBBI->getDebugLoc() : DebugLoc();
-  const uint64_t MaxSubImm = 0xfff;
+bool TriCoreFrameLowering::hasReservedCallFrame(
+    const MachineFunction &MF) const {
+  return !MF.getFrameInfo()->hasVarSizedObjects();
+}
+
+bool TriCoreFrameLowering::isFastCall(const MachineFunction &MF) {
+  return MF.getFunction()->getCallingConv() == CallingConv::Fast;
+}
+
+bool TriCoreFrameLowering::isInterruptHandler(const MachineFunction &MF) {
+  return MF.getFunction()->hasFnAttribute("interrupt");
+}
 
-  if (Offset <= MaxSubImm) {
-    // The stack offset fits in the ADD/SUB instruction.
+unsigned TriCoreFrameLowering::getInterruptPriority(const Function &F) {
+  StringRef Value = F.getFnAttribute("interrupt").getValueAsString();
+  unsigned Priority;
+  if (Value.empty())
     return 0;
-  } else {
-    // The stack offset does not fit in the ADD/SUB instruction.
-    // Materialize the offset using MOVLO/MOVHI.
-  	// FIXME: See to this code, in case we ever get a very large stack.
-  	// 		    I guess it should create an error someday.
-    unsigned OffsetReg = TriCore::A14;
-    unsigned OffsetLo = (unsigned)(Offset & 0xffff);
-    unsigned OffsetHi = (unsigned)((Offset & 0xffff0000) >> 16);
-    BuildMI(MBB, MBBI, dl, TII.get(TriCore::MOVrlc), OffsetReg) //MOVLOi16
-        .addImm(OffsetLo)
-        .setMIFlag(MachineInstr::FrameSetup);
-    if (OffsetHi) {
-      BuildMI(MBB, MBBI, dl, TII.get(TriCore::MOVHrlc), OffsetReg)
-          .addReg(OffsetReg)
-          .addImm(OffsetHi)
-          .setMIFlag(MachineInstr::FrameSetup);
-    }
-    return OffsetReg;
+  if (Value.getAsInteger(10, Priority) || Priority == 0 || Priority > 255)
+    report_fatal_error("interrupt priority must be between 1 and 255");
+  return Priority;
+}
+
+bool TriCoreFrameLowering::savesLowerContext(const MachineFunction &MF) const {
+  if (!isInterruptHandler(MF))
+    return false;
+  // A call may use the whole lower context, and one SVLCX is cheaper than
+  // spilling it register by register. BISR saves it anyway.
+  return MF.getFunction()->hasFnAttribute("interrupt-nested") ||
+         MF.getFrameInfo()->hasCalls();
+}
+
+bool TriCoreFrameLowering::canUseAsPrologue(
+    const MachineBasicBlock &MBB) const {
+  // The callee-saved list of a handler that saves the lower context leaves
+  // out D0-D7 and A2-A7, so shrink-wrapping would treat them as free above
+  // the SVLCX.
+  const MachineFunction &MF = *MBB.getParent();
+  return !isInterruptHandler(MF) || &MBB == &MF.front();
+}
+
+bool TriCoreFrameLowering::canUseAsEpilogue(
+    const MachineBasicBlock &MBB) const {
+  if (!isInterruptHandler(*MBB.getParent()))
+    return true;
+  return !MBB.empty() && MBB.back().isReturn();
+}
+
+bool TriCoreFrameLowering::restoresContextOnReturn(
+    const MachineFunction &MF) const {
+  // CALL saves the upper context, A10 and A14 included, and RET reloads it,
+  // so the caller's stack and frame pointers come back for free. JL and
+  // FCALL save nothing.
+  return !isFastCall(MF);
+}
+
+// Add Amount to the stack pointer. SUB.A covers an unsigned 8-bit decrement,
+// LEA a signed 16-bit displacement and ADDIH.A the remaining upper half, so
+// no scratch register is ever needed.
+void TriCoreFrameLowering::adjustStackPointer(MachineBasicBlock &MBB,
+                                      MachineBasicBlock::iterator MBBI,
+                                      DebugLoc dl, const TargetInstrInfo &TII,
+                                      int64_t Amount,
+                                      MachineInstr::MIFlag Flag) const {
+  if (Amount == 0)
+    return;
+
+  if (Amount < 0 && isUInt<8>(-Amount)) {
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::SUBAsc))
+        .addImm(-Amount)
+        .setMIFlag(Flag);
+    return;
+  }
+
+  int64_t Lo = SignExtend64<16>(Amount);
+  int64_t Hi = ((Amount - Lo) >> 16) & 0xffff;
+  if (Hi) {
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::ADDIHArlc), TriCore::A10)
+        .addReg(TriCore::A10)
+        .addImm(Hi)
+        .setMIFlag(Flag);
+  }
+  if (Lo) {
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::LEAbol), TriCore::A10)
+        .addReg(TriCore::A10)
+        .addImm(Lo)
+        .setMIFlag(Flag);
   }
 }
 
@@ -97,49 +158,124 @@ void TriCoreFrameLowering::emitPrologue(MachineFunction &MF,
   const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
   MachineBasicBlock::iterator MBBI = MBB.begin();
   DebugLoc dl = MBBI != MBB.end() ? MBBI->getDebugLoc() : DebugLoc();
-  // const TargetFrameLowering *TFI = MF.getSubtarget().getFrameLowering();
   uint64_t StackSize = computeStackSize(MF);
-  if (!StackSize) {
-    return;
-  }
 
-  if (hasFP(MF)) {
-  	MachineFunction::iterator I;
-  	BuildMI(MBB, MBBI, dl, TII.get(TriCore::MOVAAsrr), TriCore::A14)
-	      			.addReg(TriCore::A10);
+  // Frame indices are resolved against the rounded size.
+  MF.getFrameInfo()->setStackSize(StackSize);
 
-  	// Mark the FramePtr as live-in in every block except the entry
- 	   for (I = std::next(MF.begin());	I != MF.end(); ++I)
- 	  	 I->addLiveIn(TriCore::A14);
+  // The interrupt has saved the upper context. A nested handler reopens
+  // interrupts above its own priority with BISR, which saves the lower
+  // context first.
+  if (MF.getFunction()->hasFnAttribute("interrupt-nested")) {
+    unsigned Priority = getInterruptPriority(*MF.getFunction());
+    if (!Priority)
+      report_fatal_error("nested interrupt handlers need a priority");
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::BISRrc))
+        .addImm(Priority)
+        .setMIFlag(MachineInstr::FrameSetup);
+  } else if (savesLowerContext(MF)) {
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::SVLCX))
+        .setMIFlag(MachineInstr::FrameSetup);
   }
 
-  // Adjust the stack pointer.
-  unsigned StackReg = TriCore::A10;
-  unsigned OffsetReg = materializeOffset(MF, MBB, MBBI, (unsigned)StackSize);
-  if (OffsetReg) {
-    BuildMI(MBB, MBBI, dl, TII.get(TriCore::SUBArr), StackReg)
-        .addReg(StackReg)
-        .addReg(OffsetReg)
+  if (hasFP(MF) && isFastCall(MF)) {
+    // A14 still belongs to the caller. Push it into the slot reserved at
+    // -8, ahead of the callee-saved spills, and point A14 back at the
+    // incoming stack pointer.
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::STA_pre), TriCore::A10)
+        .addReg(TriCore::A14)
+        .addReg(TriCore::A10)
+        .addImm(-8)
         .setMIFlag(MachineInstr::FrameSetup);
-  } else {
-    BuildMI(MBB, MBBI, dl, TII.get(TriCore::SUBAsc))
-        .addImm(StackSize)
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::LEAbol), TriCore::A14)
+        .addReg(TriCore::A10)
+        .addImm(8)
         .setMIFlag(MachineInstr::FrameSetup);
+    adjustStackPointer(MBB, MBBI, dl, TII, 8 - (int64_t)StackSize,
+                       MachineInstr::FrameSetup);
+    return;
   }
-}
 
+  if (hasFP(MF)) {
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::MOVAAsrr), TriCore::A14)
+        .addReg(TriCore::A10)
+        .setMIFlag(MachineInstr::FrameSetup);
+  }
+
+  adjustStackPointer(MBB, MBBI, dl, TII, -(int64_t)StackSize,
+                     MachineInstr::FrameSetup);
+}
 
 void TriCoreFrameLowering::emitEpilogue(MachineFunction &MF,
-                            MachineBasicBlock &MBB) const {}
+                            MachineBasicBlock &MBB) const {
+  const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
+  MachineBasicBlock::iterator MBBI = MBB.getLastNonDebugInstr();
+  DebugLoc dl = MBBI->getDebugLoc();
+
+  // RFE only brings back the upper context.
+  if (savesLowerContext(MF))
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::RSLCX));
+
+  if (restoresContextOnReturn(MF))
+    return;
+
+  uint64_t StackSize = MF.getFrameInfo()->getStackSize();
+
+  if (hasFP(MF)) {
+    // A fastcc function pops the caller's A14 on the way out.
+    if (isFastCall(MF)) {
+      BuildMI(MBB, MBBI, dl, TII.get(TriCore::LEAbol), TriCore::A10)
+          .addReg(TriCore::A14)
+          .addImm(-8);
+      BuildMI(MBB, MBBI, dl, TII.get(TriCore::LDA_post), TriCore::A14)
+          .addReg(TriCore::A10, RegState::Define)
+          .addReg(TriCore::A10)
+          .addImm(8);
+      return;
+    }
+    BuildMI(MBB, MBBI, dl, TII.get(TriCore::MOVAAsrr), TriCore::A10)
+        .addReg(TriCore::A14);
+    return;
+  }
+
+  adjustStackPointer(MBB, MBBI, dl, TII, StackSize, MachineInstr::NoFlags);
+}
+
+void TriCoreFrameLowering::processFunctionBeforeFrameFinalized(
+    MachineFunction &MF, RegScavenger *RS) const {
+  // Offsets past the 10-bit BO range are formed in a scavenged address
+  // register. Keep a slot for it in case none is free.
+  MachineFrameInfo *MFI = MF.getFrameInfo();
+
+  // The caller's A14, saved by the prologue of a fastcc function that needs
+  // a frame pointer.
+  if (isFastCall(MF) && hasFP(MF))
+    MFI->CreateFixedObject(4, -8, true);
+
+  if (RS && !isInt<10>(MFI->estimateStackSize(MF))) {
+    const TargetRegisterClass *RC = &TriCore::AddrRegsRegClass;
+    RS->addScavengingFrameIndex(MFI->CreateStackObject(RC->getSize(),
+                                                       RC->getAlignment(),
+                                                       false));
+  }
+}
 
 // This function eliminates ADJCALLSTACKDOWN, ADJCALLSTACKUP pseudo
-// instructions
+// instructions. With a reserved call frame the outgoing arguments are part
+// of the fixed frame and the pseudos simply go away.
 void TriCoreFrameLowering::eliminateCallFramePseudoInstr(
     MachineFunction &MF, MachineBasicBlock &MBB,
     MachineBasicBlock::iterator I) const {
-  if (I->getOpcode() == TriCore::ADJCALLSTACKUP ||
-      I->getOpcode() == TriCore::ADJCALLSTACKDOWN) {
-    MBB.erase(I);
+  if (!hasReservedCallFrame(MF)) {
+    int64_t Amount = I->getOperand(0).getImm();
+    if (Amount) {
+      const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
+      Amount = RoundUpToAlignment(Amount, getStackAlignment());
+      if (I->getOpcode() == TriCore::ADJCALLSTACKDOWN)
+        Amount = -Amount;
+      adjustStackPointer(MBB, I, I->getDebugLoc(), TII, Amount,
+                         MachineInstr::NoFlags);
+    }
   }
-  return;
+  MBB.erase(I);
 }
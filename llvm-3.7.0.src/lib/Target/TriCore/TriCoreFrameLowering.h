@@ -20,6 +20,7 @@
 
 namespace llvm {
 class TriCoreSubtarget;
+class TargetInstrInfo;
 
 class TriCoreFrameLowering : public TargetFrameLowering {
 public:
@@ -38,13 +39,53 @@ public:
                                      MachineBasicBlock::iterator I)
                                      const override;
 
-  bool hasFP(const MachineFunction &MF) const;
+  bool hasFP(const MachineFunction &MF) const override;
+
+  /// hasReservedCallFrame - Outgoing arguments live in the bottom of the
+  /// fixed frame unless the stack pointer moves at run time, so the call
+  /// frame setup and destroy pseudos fold away.
+  bool hasReservedCallFrame(const MachineFunction &MF) const override;
+
+  /// restoresContextOnReturn - True if RET brings A10 and A14 back from the
+  /// upper context saved by the call, making an explicit stack pointer
+  /// restore in the epilogue redundant. False for fastcc functions.
+  bool restoresContextOnReturn(const MachineFunction &MF) const;
+
+  void processFunctionBeforeFrameFinalized(MachineFunction &MF,
+                                           RegScavenger *RS) const override;
+
+  /// canUseAsPrologue/canUseAsEpilogue - Interrupt handlers keep their
+  /// prologue in the entry block and their epilogue in front of RFE, so
+  /// that nothing runs on the interrupted task's lower context before SVLCX
+  /// or BISR has saved it, or after RSLCX has brought it back.
+  bool canUseAsPrologue(const MachineBasicBlock &MBB) const override;
+  bool canUseAsEpilogue(const MachineBasicBlock &MBB) const override;
+
+  /// isFastCall - True for fastcc functions, which are entered with JL or
+  /// FCALL and get no context of their own.
+  static bool isFastCall(const MachineFunction &MF);
+
+  /// isInterruptHandler - True for functions with the "interrupt" attribute.
+  static bool isInterruptHandler(const MachineFunction &MF);
+
+  /// getInterruptPriority - The priority given as the value of the
+  /// "interrupt" attribute, or 0 if there is none.
+  static unsigned getInterruptPriority(const Function &F);
+
+  /// savesLowerContext - True if an interrupt handler saves the whole lower
+  /// context with SVLCX or BISR rather than only the registers it uses.
+  bool savesLowerContext(const MachineFunction &MF) const;
 
   //! Stack slot size (4 bytes)
   static int stackSlotSize() { return 8; }
 
 private:
   uint64_t computeStackSize(MachineFunction &MF) const;
+
+  void adjustStackPointer(MachineBasicBlock &MBB,
+                          MachineBasicBlock::iterator MBBI, DebugLoc dl,
+                          const TargetInstrInfo &TII, int64_t Amount,
+                          MachineInstr::MIFlag Flag) const;
 };
 }
 
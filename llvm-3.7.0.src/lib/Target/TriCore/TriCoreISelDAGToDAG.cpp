@@ -15,13 +15,13 @@
 #include "TriCoreTargetMachine.h"
 #include "llvm/CodeGen/SelectionDAGISel.h"
 #include "llvm/CodeGen/MachineRegisterInfo.h"
+#include "llvm/IR/InlineAsm.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "TriCoreInstrInfo.h"
-#include "TriCoreCallingConvHook.h"
 
 #define DEBUG_TYPE "tricore-isel"
 
@@ -87,17 +87,24 @@ struct TriCoreISelAddressMode {
 ///
 namespace {
 class TriCoreDAGToDAGISel : public SelectionDAGISel {
-	const TriCoreSubtarget &Subtarget;
+	const TriCoreSubtarget *Subtarget;
 
 
 public:
 	explicit TriCoreDAGToDAGISel(TriCoreTargetMachine &TM, CodeGenOpt::Level OptLevel)
-	: SelectionDAGISel(TM, OptLevel), Subtarget(*TM.getSubtargetImpl()) {}
+	: SelectionDAGISel(TM, OptLevel), Subtarget(nullptr) {}
+
+	bool runOnMachineFunction(MachineFunction &MF) override {
+		Subtarget = &MF.getSubtarget<TriCoreSubtarget>();
+		return SelectionDAGISel::runOnMachineFunction(MF);
+	}
 
 	SDNode *Select(SDNode *N);
 	SDNode *SelectConstant(SDNode *N);
 
 	bool SelectAddr(SDValue Addr, SDValue &Base, SDValue &Offset);
+	bool SelectInlineAsmMemoryOperand(const SDValue &Op, unsigned ConstraintID,
+	                                  std::vector<SDValue> &OutOps) override;
 	//bool SelectAddr_new(SDValue N, SDValue &Base, SDValue &Disp);
 	bool MatchAddress(SDValue N, TriCoreISelAddressMode &AM);
 	bool MatchWrapper(SDValue N, TriCoreISelAddressMode &AM);
@@ -137,12 +144,11 @@ bool TriCoreDAGToDAGISel::MatchWrapper(SDValue N, TriCoreISelAddressMode &AM) {
 	N.dump();
 	errs()<< "N0 => "; N0.dump(); );
 
-	if (GlobalAddressSDNode *G = dyn_cast<GlobalAddressSDNode>(N0)) {
-		AM.GV = G->getGlobal();
-		AM.Disp += G->getOffset();
-		DEBUG(errs() << "MatchWrapper->Displacement: " << AM.Disp );
-		//AM.SymbolFlags = G->getTargetFlags();
-	} else if (ConstantPoolSDNode *CP = dyn_cast<ConstantPoolSDNode>(N0)) {
+	// BO and BOL displacements are too short for a symbol, a global address
+	// goes into a register as a whole and is relocated with hi:/lo: there.
+	if (isa<GlobalAddressSDNode>(N0))
+		return true;
+	if (ConstantPoolSDNode *CP = dyn_cast<ConstantPoolSDNode>(N0)) {
     AM.CP = CP->getConstVal();
     AM.Align = CP->getAlignment();
     AM.Disp += CP->getOffset();
@@ -283,6 +289,35 @@ bool TriCoreDAGToDAGISel::SelectAddr(SDValue N,
 }
 
 
+/// SelectInlineAsmMemoryOperand - An "m" operand is a base and an offset like
+/// those of the loads, the base is copied into an address register if it is
+/// not a frame index.
+bool TriCoreDAGToDAGISel::SelectInlineAsmMemoryOperand(
+		const SDValue &Op, unsigned ConstraintID, std::vector<SDValue> &OutOps) {
+	if (ConstraintID != InlineAsm::Constraint_m)
+		return true;
+
+	SDLoc DL(Op);
+	SDValue Base, Disp;
+	RegisterSDNode *Reg;
+	if (!SelectAddr(Op, Base, Disp) || !isa<ConstantSDNode>(Disp) ||
+			((Reg = dyn_cast<RegisterSDNode>(Base)) && !Reg->getReg())) {
+		Base = Op;
+		Disp = CurDAG->getTargetConstant(0, DL, MVT::i32);
+	}
+
+	if (!isa<FrameIndexSDNode>(Base)) {
+		SDValue RC = CurDAG->getTargetConstant(TriCore::AddrRegsRegClassID, DL,
+		                                       MVT::i32);
+		Base = SDValue(CurDAG->getMachineNode(TargetOpcode::COPY_TO_REGCLASS, DL,
+		                                      MVT::i32, Base, RC), 0);
+	}
+
+	OutOps.push_back(Base);
+	OutOps.push_back(Disp);
+	return false;
+}
+
 //bool TriCoreDAGToDAGISel::SelectAddr(SDValue Addr, SDValue &Base, SDValue &Offset) {
 //
 //
@@ -351,13 +386,12 @@ SDNode *TriCoreDAGToDAGISel::SelectConstant(SDNode *N) {
 	  	 * pseudo moves.
 	  	 */
 
-	  	outs() << ConstVal->getValueType(0).getEVTString() << "\n";
 	  	uint32_t lowerByte 	= ImmVal & 0x00000000ffffffff;
 	  	uint32_t higherByte = ImmVal>>32;
 			uint64_t width = 0;
 
-			outs()<<"higherByte: " << higherByte << "\n";
-			outs()<<"lowerByte: " <<  lowerByte << "\n";
+			DEBUG(dbgs() << "i64 constant, higherByte: " << higherByte
+			             << " lowerByte: " << lowerByte << "\n");
 			if (ImmVal == 0) {
 				SDValue _constVal = CurDAG->getTargetConstant(0, N, MVT::i32);
 				SDValue _width = CurDAG->getTargetConstant(0, N, MVT::i32);
@@ -366,9 +400,27 @@ SDNode *TriCoreDAGToDAGISel::SelectConstant(SDNode *N) {
 					  				_constVal, _pos, _width);
 			}
 
+	  	// A value/mask pair, as LDMST takes it: the mask in the upper word is
+	  	// a single patch of set bits and the value in the lower word is a
+	  	// 4-bit constant at the same position.
+	  	if (higherByte != 0 && lowerByte != 0) {
+	  		uint64_t posLSB = getFFS(higherByte) - 1;
+	  		uint64_t numSetBits = getNumSetBits(higherByte);
+	  		uint64_t numConsecBits = getNumConsecutiveOnes(higherByte);
+	  		uint64_t Const4Val = lowerByte >> posLSB;
+	  		if (numSetBits == numConsecBits &&
+	  		    (posLSB + numConsecBits) <= 31 &&
+	  		    (Const4Val << posLSB) == lowerByte && Const4Val <= 0xf) {
+	  			SDValue _constVal = CurDAG->getTargetConstant(Const4Val, N, MVT::i32);
+	  			SDValue _width = CurDAG->getTargetConstant(numConsecBits, N, MVT::i32);
+	  			SDValue _pos = CurDAG->getTargetConstant(posLSB, N, MVT::i32);
+	  			return CurDAG->getMachineNode(TriCore::IMASKrcpw, N, MVT::i64,
+	  					_constVal, _pos, _width);
+	  		}
+	  	}
+
 	  	// In case both bytes contain set bits then exit
 	  	if(ImmSVal<0 || (higherByte!=0 && lowerByte!=0)) {
-	  		outs()<< "exit\n";
 	  		return SelectCode(N);
 	  	}
 	  	else if(higherByte==0 && lowerByte!=0) {
@@ -383,8 +435,8 @@ SDNode *TriCoreDAGToDAGISel::SelectConstant(SDNode *N) {
 	  		// In case we are dealing with the lower byte,
 	  		// only Const4Val is set
 	  		int64_t Const4Val = ipow(numConsecBits) - 1;
-	  		outs()<<"posLSB: " << posLSB << "\n";
-	  		outs()<<"ConstVal: " << Const4Val << "\n";
+	  		DEBUG(dbgs() << "IMASK posLSB: " << posLSB
+	  		             << " ConstVal: " << Const4Val << "\n");
 
 	  		SDValue _constVal = CurDAG->getTargetConstant(Const4Val, N, MVT::i32);
 	  		SDValue _width = CurDAG->getTargetConstant(width, N, MVT::i32);
@@ -397,8 +449,8 @@ SDNode *TriCoreDAGToDAGISel::SelectConstant(SDNode *N) {
 	  		uint64_t posLSB = getFFS(higherByte) - 1;
 	  		uint64_t numSetBits = getNumSetBits(higherByte);
 				uint64_t numConsecBits = getNumConsecutiveOnes(higherByte);
-	  		outs()<<"posLSB: " << posLSB << "\n";
-	  		outs()<<"numConsecBits: " << numConsecBits << "\n";
+	  		DEBUG(dbgs() << "IMASK posLSB: " << posLSB
+	  		             << " numConsecBits: " << numConsecBits << "\n");
 	  		// In case the patch of set bits is not a mask then exit
 	  		if (numSetBits != numConsecBits) return SelectCode(N);
 
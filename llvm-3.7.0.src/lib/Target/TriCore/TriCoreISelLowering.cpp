@@ -13,6 +13,7 @@
 
 #include "TriCoreISelLowering.h"
 #include "TriCore.h"
+#include "TriCoreCCState.h"
 #include "TriCoreMachineFunctionInfo.h"
 #include "TriCoreSubtarget.h"
 #include "TriCoreTargetMachine.h"
@@ -21,6 +22,7 @@
 #include "llvm/CodeGen/MachineFunction.h"
 #include "llvm/CodeGen/MachineInstrBuilder.h"
 #include "llvm/CodeGen/MachineJumpTableInfo.h"
+#include "llvm/CodeGen/MachineLoopInfo.h"
 #include "llvm/CodeGen/MachineRegisterInfo.h"
 #include "llvm/CodeGen/SelectionDAGISel.h"
 #include "llvm/CodeGen/TargetLoweringObjectFileImpl.h"
@@ -32,22 +34,29 @@
 #include "llvm/IR/GlobalAlias.h"
 #include "llvm/IR/GlobalVariable.h"
 #include "llvm/IR/Intrinsics.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
-#include "TriCoreCallingConvHook.h"
 
 using namespace llvm;
 
+static cl::opt<bool> AlignSmallLoops(
+    "tricore-align-small-loops", cl::Hidden, cl::init(false),
+    cl::desc("Only align loops whose body fits in the fetch buffer"));
+
 
 const char *TriCoreTargetLowering::getTargetNodeName(unsigned Opcode) const {
   switch (Opcode) {
   default:
     return NULL;
   case TriCoreISD::RET_FLAG: return "TriCoreISD::RetFlag";
+  case TriCoreISD::RFE_FLAG: return "TriCoreISD::RfeFlag";
+  case TriCoreISD::RET_FAST: return "TriCoreISD::RET_FAST";
   case TriCoreISD::LOAD_SYM: return "TriCoreISD::LOAD_SYM";
   case TriCoreISD::MOVEi32:  return "TriCoreISD::MOVEi32";
   case TriCoreISD::CALL:     return "TriCoreISD::CALL";
+  case TriCoreISD::CALL_FAST:return "TriCoreISD::CALL_FAST";
   case TriCoreISD::BR_CC:    return "TriCoreISD::BR_CC";
   case TriCoreISD::SELECT_CC:return "TriCoreISD::SELECT_CC";
   case TriCoreISD::LOGICCMP: return "TriCoreISD::LOGICCMP";
@@ -57,16 +66,42 @@ const char *TriCoreTargetLowering::getTargetNodeName(unsigned Opcode) const {
   case TriCoreISD::SH:       return "TriCoreISD::SH";
   case TriCoreISD::SHA:      return "TriCoreISD::SHA";
   case TriCoreISD::EXTR:     return "TriCoreISD::EXTR";
+  case TriCoreISD::ADDS:     return "TriCoreISD::ADDS";
+  case TriCoreISD::ADDS_U:   return "TriCoreISD::ADDS_U";
+  case TriCoreISD::SUBS:     return "TriCoreISD::SUBS";
+  case TriCoreISD::SUBS_U:   return "TriCoreISD::SUBS_U";
+  case TriCoreISD::SAT_B:    return "TriCoreISD::SAT_B";
+  case TriCoreISD::SAT_BU:   return "TriCoreISD::SAT_BU";
+  case TriCoreISD::SAT_H:    return "TriCoreISD::SAT_H";
+  case TriCoreISD::SAT_HU:   return "TriCoreISD::SAT_HU";
+  case TriCoreISD::ABS:      return "TriCoreISD::ABS";
+  case TriCoreISD::ABSDIF:   return "TriCoreISD::ABSDIF";
+  case TriCoreISD::MUL_Q:    return "TriCoreISD::MUL_Q";
+  case TriCoreISD::BR_BIT:   return "TriCoreISD::BR_BIT";
+  case TriCoreISD::AND_T:    return "TriCoreISD::AND_T";
+  case TriCoreISD::OR_T:     return "TriCoreISD::OR_T";
+  case TriCoreISD::XOR_T:    return "TriCoreISD::XOR_T";
+  case TriCoreISD::INS_T:    return "TriCoreISD::INS_T";
+  case TriCoreISD::INSN_T:   return "TriCoreISD::INSN_T";
+  case TriCoreISD::ADDV:     return "TriCoreISD::ADDV";
+  case TriCoreISD::SUBV:     return "TriCoreISD::SUBV";
+  case TriCoreISD::MULV:     return "TriCoreISD::MULV";
+  case TriCoreISD::SWAPMSK:  return "TriCoreISD::SWAPMSK";
+  case TriCoreISD::LDMST:    return "TriCoreISD::LDMST";
+  case TriCoreISD::ST_T:     return "TriCoreISD::ST_T";
   }
 }
 
-TriCoreTargetLowering::TriCoreTargetLowering(TriCoreTargetMachine &TriCoreTM)
-    : TargetLowering(TriCoreTM), Subtarget(*TriCoreTM.getSubtargetImpl()) {
+TriCoreTargetLowering::TriCoreTargetLowering(TriCoreTargetMachine &TriCoreTM,
+                                             const TriCoreSubtarget &STI)
+    : TargetLowering(TriCoreTM), Subtarget(STI) {
   // Set up the register classes.
   addRegisterClass(MVT::i32, &TriCore::DataRegsRegClass);
   //addRegisterClass(MVT::i32, &TriCore::AddrRegsRegClass);
   addRegisterClass(MVT::i64, &TriCore::ExtRegsRegClass);
-  addRegisterClass(MVT::f32, &TriCore::FPRegsRegClass);
+  // Without the FPU, floating point is softened into library calls.
+  if (Subtarget.hasFPU())
+    addRegisterClass(MVT::f32, &TriCore::FPRegsRegClass);
   //addRegisterClass(MVT::i32, &TriCore::PSRegsRegClass);
 
 
@@ -78,6 +113,31 @@ TriCoreTargetLowering::TriCoreTargetLowering(TriCoreTargetMachine &TriCoreTM)
 
   setSchedulingPreference(Sched::Source);
 
+  // Instructions are halfword aligned. Beyond that, code should start on the
+  // boundaries the core fetches from: 64 bits on all cores, and a 256-bit
+  // cache line or flash prefetch buffer on the performance cores.
+  setMinFunctionAlignment(1);
+  switch (Subtarget.getProcFamily()) {
+  case TriCoreSubtarget::Others:
+    break;
+  case TriCoreSubtarget::TC13:
+  case TriCoreSubtarget::TC16E:
+    setPrefFunctionAlignment(3);
+    setPrefLoopAlignment(3);
+    break;
+  case TriCoreSubtarget::TC16P:
+  case TriCoreSubtarget::TC18:
+    setPrefFunctionAlignment(5);
+    setPrefLoopAlignment(3);
+    break;
+  }
+
+  // EQ, LT, GE and the accumulating compares all produce 0 or 1.
+  setBooleanContents(ZeroOrOneBooleanContent);
+  // Keep a && b as one condition rather than two branches; the accumulating
+  // compares evaluate it without a jump.
+  setJumpIsExpensive(true);
+
 //  for (MVT VT : MVT::integer_valuetypes()) {
 //     setLoadExtAction(ISD::SEXTLOAD, VT, MVT::i8,  Expand);
 //     setLoadExtAction(ISD::SEXTLOAD, MVT::i32, MVT::i16,  Promote);
@@ -89,10 +149,108 @@ TriCoreTargetLowering::TriCoreTargetLowering(TriCoreTargetMachine &TriCoreTM)
   setOperationAction(ISD::BR_CC,         MVT::i32,   Custom);
   setOperationAction(ISD::BR_CC, 				 MVT::i64, 	 Custom);
   setOperationAction(ISD::SELECT_CC,     MVT::i32,   Custom);
+  setOperationAction(ISD::SELECT,        MVT::i32,   Expand);
   setOperationAction(ISD::SETCC,         MVT::i32,   Custom);
+  setOperationAction(ISD::SETCC,         MVT::i64,   Custom);
   setOperationAction(ISD::SHL,           MVT::i32,   Custom);
   setOperationAction(ISD::SRL,           MVT::i32,   Custom);
   setOperationAction(ISD::SRA,           MVT::i32,   Custom);
+
+  // Unnamed arguments live on the stack, so va_list is a plain pointer.
+  setOperationAction(ISD::VASTART,       MVT::Other, Custom);
+  setOperationAction(ISD::VAARG,         MVT::Other, Expand);
+  setOperationAction(ISD::VACOPY,        MVT::Other, Expand);
+  setOperationAction(ISD::VAEND,         MVT::Other, Expand);
+
+  // Dynamic allocas move A10 down; the frame pointer keeps the fixed
+  // objects addressable.
+  setOperationAction(ISD::DYNAMIC_STACKALLOC, MVT::i32, Expand);
+  setOperationAction(ISD::STACKSAVE,     MVT::Other, Expand);
+  setOperationAction(ISD::STACKRESTORE,  MVT::Other, Expand);
+  setOperationAction(ISD::FRAMEADDR,     MVT::i32,   Custom);
+
+  // MIN/MAX handle 32-bit min/max directly. The 64-bit forms are only
+  // formed so that clamps can be combined into the saturating instructions;
+  // anything left over goes back to a select.
+  setOperationAction(ISD::SMIN,          MVT::i32,   Legal);
+  setOperationAction(ISD::SMAX,          MVT::i32,   Legal);
+  setOperationAction(ISD::UMIN,          MVT::i32,   Legal);
+  setOperationAction(ISD::UMAX,          MVT::i32,   Legal);
+  setOperationAction(ISD::SMIN,          MVT::i64,   Custom);
+  setOperationAction(ISD::SMAX,          MVT::i64,   Custom);
+  setOperationAction(ISD::UMIN,          MVT::i64,   Custom);
+  setOperationAction(ISD::UMAX,          MVT::i64,   Custom);
+  // Bit counting and byte order. CLZ is always there, CTTZ expands through
+  // it (or POPCNT.W), and without SHUFFLE a byte swap is built from two
+  // DEXTR rotates.
+  setOperationAction(ISD::CTLZ,          MVT::i32,   Legal);
+  setOperationAction(ISD::CTTZ,          MVT::i32,   Expand);
+  setOperationAction(ISD::CTLZ_ZERO_UNDEF, MVT::i32, Expand);
+  setOperationAction(ISD::CTTZ_ZERO_UNDEF, MVT::i32, Expand);
+  setOperationAction(ISD::CTPOP,         MVT::i32,
+                     Subtarget.hasPOPCNT() ? Legal : Expand);
+  setOperationAction(ISD::BSWAP,         MVT::i32,
+                     Subtarget.hasTC162() ? Legal : Custom);
+  setOperationAction(ISD::ROTL,          MVT::i32,   Custom);
+  setOperationAction(ISD::ROTR,          MVT::i32,   Custom);
+  for (unsigned Opc : {ISD::CTLZ, ISD::CTTZ, ISD::CTLZ_ZERO_UNDEF,
+                       ISD::CTTZ_ZERO_UNDEF, ISD::CTPOP, ISD::BSWAP,
+                       ISD::ROTL, ISD::ROTR})
+    setOperationAction(Opc,              MVT::i64,   Expand);
+  // DIV and DIV.U give quotient and remainder together. Cores before
+  // TriCore 1.6 call the runtime library instead.
+  for (unsigned Opc : {ISD::SDIV, ISD::SREM, ISD::UDIV, ISD::UREM})
+    setOperationAction(Opc,              MVT::i32,
+                       Subtarget.hasDIV() ? Legal : Expand);
+  setOperationAction(ISD::SDIVREM,       MVT::i32,   Expand);
+  setOperationAction(ISD::UDIVREM,       MVT::i32,   Expand);
+  // Signed overflow is the V flag the arithmetic leaves in PSW. Unsigned
+  // overflow keeps the generic expansion, a single LT.U on the result.
+  setOperationAction(ISD::SADDO,         MVT::i32,   Custom);
+  setOperationAction(ISD::SSUBO,         MVT::i32,   Custom);
+  setOperationAction(ISD::SMULO,         MVT::i32,   Custom);
+
+  // Word atomics use SWAP.W, CMPSWAP.W and the masked SWAPMSK.W/LDMST, with
+  // DSYNC fences around them for ordering. AtomicExpand turns the other
+  // read-modify-write operations into CMPSWAP.W loops; without CMPSWAP.W,
+  // and for other sizes, they become __sync libcalls. Those are lowered here
+  // rather than by the legalizer so the address travels in A4.
+  setInsertFencesForAtomic(true);
+  for (unsigned Opc : {ISD::ATOMIC_SWAP, ISD::ATOMIC_CMP_SWAP,
+                       ISD::ATOMIC_LOAD_ADD, ISD::ATOMIC_LOAD_SUB,
+                       ISD::ATOMIC_LOAD_AND, ISD::ATOMIC_LOAD_OR,
+                       ISD::ATOMIC_LOAD_XOR, ISD::ATOMIC_LOAD_NAND,
+                       ISD::ATOMIC_LOAD_MIN, ISD::ATOMIC_LOAD_MAX,
+                       ISD::ATOMIC_LOAD_UMIN, ISD::ATOMIC_LOAD_UMAX})
+    setOperationAction(Opc,              MVT::i32,   Custom);
+  // 64-bit loads and stores expand into CMP_SWAP and SWAP.
+  for (unsigned Opc : {ISD::ATOMIC_LOAD, ISD::ATOMIC_STORE})
+    setOperationAction(Opc,              MVT::i64,   Expand);
+  for (unsigned Opc : {ISD::ATOMIC_SWAP,
+                       ISD::ATOMIC_CMP_SWAP, ISD::ATOMIC_LOAD_ADD,
+                       ISD::ATOMIC_LOAD_SUB, ISD::ATOMIC_LOAD_AND,
+                       ISD::ATOMIC_LOAD_OR, ISD::ATOMIC_LOAD_XOR,
+                       ISD::ATOMIC_LOAD_NAND, ISD::ATOMIC_LOAD_MIN,
+                       ISD::ATOMIC_LOAD_MAX, ISD::ATOMIC_LOAD_UMIN,
+                       ISD::ATOMIC_LOAD_UMAX})
+    setOperationAction(Opc,              MVT::i64,   Custom);
+
+  // Extending loads to i64 load a word or less and extend it in registers.
+  for (unsigned Ext : {ISD::EXTLOAD, ISD::SEXTLOAD, ISD::ZEXTLOAD})
+    for (MVT MemVT : {MVT::i8, MVT::i16, MVT::i32})
+      setLoadExtAction(Ext, MVT::i64, MemVT, Custom);
+
+  setTargetDAGCombine(ISD::SMIN);
+  setTargetDAGCombine(ISD::SMAX);
+  setTargetDAGCombine(ISD::UMIN);
+  setTargetDAGCombine(ISD::TRUNCATE);
+  setTargetDAGCombine(ISD::AND);
+  setTargetDAGCombine(ISD::OR);
+  setTargetDAGCombine(ISD::XOR);
+  setTargetDAGCombine(ISD::SADDO);
+  setTargetDAGCombine(ISD::SSUBO);
+  setTargetDAGCombine(ISD::SMULO);
+  setTargetDAGCombine(ISD::STORE);
   //setOperationAction(ISD::SRA,           MVT::i16,   Custom);
   //setOperationAction(ISD::SIGN_EXTEND,   MVT::i16,   Expand);
 
@@ -110,6 +268,31 @@ SDValue TriCoreTargetLowering::LowerOperation(SDValue Op, SelectionDAG &DAG) con
   case ISD::SHL:
   case ISD::SRL:
   case ISD::SRA:              	return LowerShifts(Op, DAG);
+  case ISD::VASTART:          	return LowerVASTART(Op, DAG);
+  case ISD::FRAMEADDR:        	return LowerFRAMEADDR(Op, DAG);
+  case ISD::SMIN:
+  case ISD::SMAX:
+  case ISD::UMIN:
+  case ISD::UMAX:             	return LowerMinMax(Op, DAG);
+  case ISD::BSWAP:            	return LowerBSWAP(Op, DAG);
+  case ISD::ROTL:
+  case ISD::ROTR:             	return LowerRotate(Op, DAG);
+  case ISD::SADDO:
+  case ISD::SSUBO:
+  case ISD::SMULO:            	return LowerXALUO(Op, DAG);
+  case ISD::ATOMIC_SWAP:
+  case ISD::ATOMIC_CMP_SWAP:
+  case ISD::ATOMIC_LOAD_ADD:
+  case ISD::ATOMIC_LOAD_SUB:
+  case ISD::ATOMIC_LOAD_AND:
+  case ISD::ATOMIC_LOAD_OR:
+  case ISD::ATOMIC_LOAD_XOR:
+  case ISD::ATOMIC_LOAD_NAND:
+  case ISD::ATOMIC_LOAD_MIN:
+  case ISD::ATOMIC_LOAD_MAX:
+  case ISD::ATOMIC_LOAD_UMIN:
+  case ISD::ATOMIC_LOAD_UMAX:   	return LowerATOMIC(Op, DAG);
+  case ISD::LOAD:             	return LowerLOAD(Op, DAG);
   //case ISD::SIGN_EXTEND:      	return LowerSIGN_EXTEND(Op, DAG);
   //case ISD::SIGN_EXTEND_INREG:  return LowerSIGN_EXTEND_INREG(Op, DAG);
   }
@@ -188,16 +371,16 @@ static SDValue EmitCMP(SDValue &LHS, SDValue &RHS, ISD::CondCode CC,
   case ISD::SETULE:
     std::swap(LHS, RHS);        // FALLTHROUGH
   case ISD::SETUGE:
+  	tricoreCC = DAG.getConstant(TriCoreCC::COND_NE, dl, MVT::i32);
     // Turn lhs u>= rhs with lhs constant into rhs u< lhs+1, this allows us to
     // fold constant into instruction.
     if (const ConstantSDNode * C = dyn_cast<ConstantSDNode>(LHS)) {
       LHS = RHS;
       RHS = DAG.getConstant(C->getSExtValue() + 1, dl, C->getValueType(0));
-      TCC = TriCoreCC::COND_LT;
+      TCC = TriCoreCC::COND_LTU;
       break;
     }
-    TCC = TriCoreCC::COND_GE;    // aka COND_C
-    tricoreCC = DAG.getConstant(TriCoreCC::COND_NE, dl, MVT::i32);
+    TCC = TriCoreCC::COND_GEU;
     break;
   case ISD::SETUGT:
     std::swap(LHS, RHS);        // FALLTHROUGH
@@ -208,10 +391,10 @@ static SDValue EmitCMP(SDValue &LHS, SDValue &RHS, ISD::CondCode CC,
     if (const ConstantSDNode * C = dyn_cast<ConstantSDNode>(LHS)) {
       LHS = RHS;
       RHS = DAG.getConstant(C->getSExtValue() + 1, dl, C->getValueType(0));
-      TCC = TriCoreCC::COND_GE;
+      TCC = TriCoreCC::COND_GEU;
       break;
     }
-    TCC = TriCoreCC::COND_LT;    // aka COND_NC
+    TCC = TriCoreCC::COND_LTU;
     break;
   case ISD::SETLE:
     std::swap(LHS, RHS);        // FALLTHROUGH
@@ -243,65 +426,57 @@ static SDValue EmitCMP(SDValue &LHS, SDValue &RHS, ISD::CondCode CC,
     break;
   }
 
-  if (VT == MVT::i64) {
-
-  	SDValue LHSlo = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, LHS,
-  	                               DAG.getIntPtrConstant(0, dl));
-  	SDValue LHShi = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, LHS,
-  	  	                           DAG.getIntPtrConstant(1, dl));
-
-  	SDValue RHSlo, RHShi;
-  	if (RHS.getOpcode() != ISD::Constant) {
-  			RHSlo = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, RHS,
-																					 DAG.getIntPtrConstant(0, dl));
-				RHShi = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, RHS,
-																					 DAG.getIntPtrConstant(1, dl));
-  	}
-  	else
-  	{
-  		ConstantSDNode *C = cast<ConstantSDNode>(RHS);
-  		int64_t immVal = C->getSExtValue();
-  		int32_t lowerByte = immVal & 0xffffffff;
-  		int32_t HigherByte = (immVal >> 32);
-
-  		RHSlo = DAG.getConstant(lowerByte, dl, MVT::i32);
-  		RHShi = DAG.getConstant(HigherByte, dl, MVT::i32);
-  		RHShi.dump();
-  	}
-
-  	SDValue TargetEQ;
-  	if (TCC != TriCoreCC::COND_NE)
-  		TargetEQ = DAG.getConstant(TriCoreCC::COND_EQ, dl, MVT::i32);
-  	else
-  		TargetEQ = DAG.getConstant(TCC, dl, MVT::i32);
-
-		SDVTList VTs = DAG.getVTList(MVT::i32, MVT::Glue);
-		SDValue Ops[] = {LHShi, RHShi, TargetEQ};
-		SDValue compareHi = DAG.getNode(TriCoreISD::CMP, dl, VTs, Ops);
-
-		TargetCC = DAG.getConstant(TCC, dl, MVT::i32);
-		SDValue Ops2[] = {compareHi.getValue(0), LHSlo, RHSlo, TargetCC, compareHi.getValue(1)};
-		SDValue compareLo = DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, Ops2);
-
-		if ( (TCC == TriCoreCC::COND_NE ) || (TCC == TriCoreCC::COND_EQ))
-			return compareLo;
-
-		SDValue SecondCC = DAG.getConstant(TriCoreCC::COND_LT + 10, dl, MVT::i32);
-		if(RHS.getOpcode() == ISD::Constant) {
-			std::swap(LHShi, RHShi);
-			SecondCC = DAG.getConstant(TCC + 10, dl, MVT::i32);
-		}
+  SDVTList VTs = DAG.getVTList(MVT::i32, MVT::Glue);
 
-		SDValue Ops3[] = {compareLo.getValue(0), RHShi, LHShi, SecondCC, compareLo.getValue(1)};
-		SDValue compareCombine = DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, Ops3);
+  if (VT == MVT::i64) {
+    SDValue LHSlo = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, LHS,
+                                DAG.getIntPtrConstant(0, dl));
+    SDValue LHShi = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, LHS,
+                                DAG.getIntPtrConstant(1, dl));
+    SDValue RHSlo = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, RHS,
+                                DAG.getIntPtrConstant(0, dl));
+    SDValue RHShi = DAG.getNode(ISD::EXTRACT_ELEMENT, dl, MVT::i32, RHS,
+                                DAG.getIntPtrConstant(1, dl));
+
+    // Compare the high words and fold the low words in with the accumulating
+    // compares:
+    //   eq:  and.eq (eq hi), lo
+    //   ne:  or.ne  (ne hi), lo
+    //   lt:  or.lt  (and.lt.u (eq hi), lo), hi         (lt.u when unsigned)
+    //   ge:  or.lt  (and.ge.u (eq hi), lo), hi swapped
+    if (TCC == TriCoreCC::COND_EQ || TCC == TriCoreCC::COND_NE) {
+      SDValue HiOps[] = {LHShi, RHShi, DAG.getConstant(TCC, dl, MVT::i32)};
+      SDValue Hi = DAG.getNode(TriCoreISD::CMP, dl, VTs, HiOps);
+      TriCoreCC::LogicCodes Logic = TCC == TriCoreCC::COND_EQ ?
+          TriCoreCC::LOGIC_AND : TriCoreCC::LOGIC_OR;
+      SDValue LoOps[] = {Hi, LHSlo, RHSlo,
+                         DAG.getConstant(TriCoreCC::getLogicCmpCode(Logic, TCC),
+                                         dl, MVT::i32)};
+      return DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, LoOps);
+    }
 
-		return compareCombine;
-  	//LHS2.dump();
+    bool isLess = TCC == TriCoreCC::COND_LT || TCC == TriCoreCC::COND_LTU;
+    bool isUnsigned = TCC == TriCoreCC::COND_GEU || TCC == TriCoreCC::COND_LTU;
+    unsigned LoCode = TriCoreCC::getLogicCmpCode(TriCoreCC::LOGIC_AND,
+        isLess ? TriCoreCC::COND_LTU : TriCoreCC::COND_GEU);
+    unsigned HiCode = TriCoreCC::getLogicCmpCode(TriCoreCC::LOGIC_OR,
+        isUnsigned ? TriCoreCC::COND_LTU : TriCoreCC::COND_LT);
+
+    SDValue HiOps[] = {LHShi, RHShi,
+                       DAG.getConstant(TriCoreCC::COND_EQ, dl, MVT::i32)};
+    SDValue Acc = DAG.getNode(TriCoreISD::CMP, dl, VTs, HiOps);
+    SDValue LoOps[] = {Acc, LHSlo, RHSlo,
+                       DAG.getConstant(LoCode, dl, MVT::i32)};
+    Acc = DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, LoOps);
+
+    if (!isLess)
+      std::swap(LHShi, RHShi);
+    SDValue OrOps[] = {Acc, LHShi, RHShi,
+                       DAG.getConstant(HiCode, dl, MVT::i32)};
+    return DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, OrOps);
   }
 
-
   TargetCC = DAG.getConstant(TCC, dl, MVT::i32);
-  SDVTList VTs = DAG.getVTList(MVT::i32, MVT::Glue);
   SDValue Ops[] = {LHS, RHS, TargetCC};
 
 //  return DAG.getNode(TriCoreISD::CMP, dl, MVT::i32, LHS, RHS, TargetCC);
@@ -311,6 +486,64 @@ static SDValue EmitCMP(SDValue &LHS, SDValue &RHS, ISD::CondCode CC,
   return DAG.getNode(TriCoreISD::CMP, dl, VTs, Ops);
 }
 
+// Recognize an AND that keeps a single bit, as seen after the operands
+// have been legalized (right shifts are SH with a negative count):
+//   and(X, 1 << n)           -> bit n of X
+//   and(SH(X, -k), 1 << n)   -> bit n + k of X
+//   and(SH(1, Idx), Mask)    -> bit 0 of Mask >> Idx, the form switch bit
+//                               tests and x & (1 << n) with a variable n take
+static bool isSingleBitTest(SDValue V, SDLoc dl, SelectionDAG &DAG,
+                            SDValue &X, unsigned &Bit) {
+  if (V.getOpcode() != ISD::AND || V.getValueType() != MVT::i32)
+    return false;
+
+  for (unsigned i = 0; i < 2; ++i) {
+    // The shift may not have been legalized yet.
+    SDValue Src = V.getOperand(i);
+    if (Src.getOpcode() != TriCoreISD::SH && Src.getOpcode() != ISD::SHL)
+      continue;
+    ConstantSDNode *One = dyn_cast<ConstantSDNode>(Src.getOperand(0));
+    if (One && One->getZExtValue() == 1 &&
+        !isa<ConstantSDNode>(Src.getOperand(1))) {
+      SDValue Idx = DAG.getNode(ISD::SUB, dl, MVT::i32,
+                                DAG.getConstant(0, dl, MVT::i32),
+                                Src.getOperand(1));
+      X = DAG.getNode(TriCoreISD::SH, dl, MVT::i32, V.getOperand(1 - i), Idx);
+      Bit = 0;
+      return true;
+    }
+  }
+
+  SDValue Src = V.getOperand(0);
+  ConstantSDNode *Mask = dyn_cast<ConstantSDNode>(V.getOperand(1));
+  if (!Mask) {
+    Src = V.getOperand(1);
+    Mask = dyn_cast<ConstantSDNode>(V.getOperand(0));
+  }
+  if (!Mask)
+    return false;
+
+  uint64_t M = Mask->getZExtValue();
+  if (!isPowerOf2_64(M))
+    return false;
+  X = Src;
+  Bit = Log2_64(M);
+
+  if (Src.getOpcode() == TriCoreISD::SH) {
+    ConstantSDNode *Amt = dyn_cast<ConstantSDNode>(Src.getOperand(1));
+    if (Amt && Amt->getSExtValue() < 0 && Bit - Amt->getSExtValue() < 32) {
+      X = Src.getOperand(0);
+      Bit -= Amt->getSExtValue();
+    }
+  }
+  return true;
+}
+
+// True if V is known to be 0 or 1.
+static bool isBoolean(SDValue V, SelectionDAG &DAG) {
+  return DAG.MaskedValueIsZero(V, APInt::getHighBitsSet(32, 31));
+}
+
 SDValue TriCoreTargetLowering::LowerBR_CC(SDValue Op, SelectionDAG &DAG) const {
   SDValue Chain = Op.getOperand(0);
   ISD::CondCode CC = cast<CondCodeSDNode>(Op.getOperand(1))->get();
@@ -319,6 +552,34 @@ SDValue TriCoreTargetLowering::LowerBR_CC(SDValue Op, SelectionDAG &DAG) const {
   SDValue Dest  = Op.getOperand(4);
   SDLoc dl  (Op);
 
+  // A condition that is already 0 or 1, such as a chain of accumulating
+  // compares or an overflow flag, is branched on directly. Testing it
+  // against 1 is the inverse test against 0.
+  ConstantSDNode *RHSC = dyn_cast<ConstantSDNode>(RHS);
+  bool IsBool = (CC == ISD::SETEQ || CC == ISD::SETNE) && RHSC &&
+                RHSC->getZExtValue() <= 1 && LHS.getValueType() == MVT::i32 &&
+                isBoolean(LHS, DAG);
+  if (IsBool && RHSC->isOne())
+    CC = CC == ISD::SETEQ ? ISD::SETNE : ISD::SETEQ;
+
+  // A single bit tested against zero needs no compare.
+  SDValue BitReg;
+  unsigned Bit;
+  if ((CC == ISD::SETEQ || CC == ISD::SETNE) && RHSC &&
+      (RHSC->isNullValue() || IsBool) &&
+      isSingleBitTest(LHS, dl, DAG, BitReg, Bit)) {
+    unsigned TCC = CC == ISD::SETEQ ? TriCoreCC::COND_EQ : TriCoreCC::COND_NE;
+    return DAG.getNode(TriCoreISD::BR_BIT, dl, MVT::Other, Chain, Dest, BitReg,
+                       DAG.getConstant(Bit, dl, MVT::i32),
+                       DAG.getConstant(TCC, dl, MVT::i32));
+  }
+
+  if (IsBool) {
+    unsigned TCC = CC == ISD::SETNE ? TriCoreCC::COND_NE : TriCoreCC::COND_EQ;
+    return DAG.getNode(TriCoreISD::BR_CC, dl, MVT::Other, Chain, Dest, LHS,
+                       DAG.getConstant(TCC, dl, MVT::i32));
+  }
+
   SDValue tricoreCC;
   SDValue Flag = EmitCMP(LHS, RHS, CC, dl, DAG, tricoreCC);
 
@@ -336,12 +597,9 @@ SDValue TriCoreTargetLowering::LowerSETCC(SDValue Op, SelectionDAG &DAG) const {
 
   ISD::CondCode CC = cast<CondCodeSDNode>(Op.getOperand(2))->get();
   SDValue TargetCC;
+  // The compare instructions already produce 0 or 1.
   SDValue Flag = EmitCMP(LHS, RHS, CC, dl, DAG, TargetCC);
-  SDVTList VTs = DAG.getVTList(Op.getValueType(), MVT::Glue);
-  SDValue Ops[] = {LHS, RHS, TargetCC, Flag};
-
-  return DAG.getNode(TriCoreISD::SELECT_CC, dl, VTs, Ops);
-
+  return Flag.getValue(0);
 }
 
 
@@ -363,6 +621,238 @@ SDValue TriCoreTargetLowering::LowerSELECT_CC(SDValue Op,
   return DAG.getNode(TriCoreISD::SELECT_CC, dl, VTs, Ops);
 }
 
+SDValue TriCoreTargetLowering::LowerBSWAP(SDValue Op,
+                                          SelectionDAG &DAG) const {
+  // With X = [b3 b2 b1 b0], rotl(X, 8) = [b2 b1 b0 b3] supplies bytes 0
+  // and 2 of the result and rotl(X, 24) = [b0 b3 b2 b1] bytes 1 and 3.
+  SDValue X = Op.getOperand(0);
+  SDLoc dl(Op);
+
+  SDValue Rot8 = DAG.getNode(ISD::ROTL, dl, MVT::i32, X,
+                             DAG.getConstant(8, dl, MVT::i32));
+  SDValue Rot24 = DAG.getNode(ISD::ROTL, dl, MVT::i32, X,
+                              DAG.getConstant(24, dl, MVT::i32));
+  SDValue Lo = DAG.getNode(ISD::AND, dl, MVT::i32, Rot8,
+                           DAG.getConstant(0x00ff00ff, dl, MVT::i32));
+  SDValue Hi = DAG.getNode(ISD::AND, dl, MVT::i32, Rot24,
+                           DAG.getConstant(0xff00ff00, dl, MVT::i32));
+  return DAG.getNode(ISD::OR, dl, MVT::i32, Lo, Hi);
+}
+
+SDValue TriCoreTargetLowering::LowerRotate(SDValue Op,
+                                           SelectionDAG &DAG) const {
+  SDValue X = Op.getOperand(0);
+  SDValue Amt = Op.getOperand(1);
+  EVT VT = Op.getValueType();
+  SDLoc dl(Op);
+
+  // DEXTR with both sources the same is a left rotate, by a constant or by
+  // the low five bits of a register.
+  if (Op.getOpcode() == ISD::ROTL)
+    return Op;
+  if (ConstantSDNode *C = dyn_cast<ConstantSDNode>(Amt))
+    return DAG.getNode(ISD::ROTL, dl, VT, X,
+                       DAG.getConstant((32 - C->getZExtValue()) & 31, dl,
+                                       MVT::i32));
+  return DAG.getNode(ISD::ROTL, dl, VT, X,
+                     DAG.getNode(ISD::SUB, dl, MVT::i32,
+                                 DAG.getConstant(0, dl, MVT::i32), Amt));
+}
+
+SDValue TriCoreTargetLowering::LowerMinMax(SDValue Op,
+                                           SelectionDAG &DAG) const {
+  SDValue LHS = Op.getOperand(0);
+  SDValue RHS = Op.getOperand(1);
+  EVT VT = Op.getValueType();
+  SDLoc dl(Op);
+
+  ISD::CondCode CC;
+  switch (Op.getOpcode()) {
+  default: llvm_unreachable("Invalid min/max opcode!");
+  case ISD::SMIN: CC = ISD::SETLT;  break;
+  case ISD::SMAX: CC = ISD::SETGT;  break;
+  case ISD::UMIN: CC = ISD::SETULT; break;
+  case ISD::UMAX: CC = ISD::SETUGT; break;
+  }
+
+  EVT CCVT = getSetCCResultType(DAG.getDataLayout(), *DAG.getContext(), VT);
+  SDValue Cond = DAG.getSetCC(dl, CCVT, LHS, RHS, CC);
+  return DAG.getSelect(dl, VT, Cond, LHS, RHS);
+}
+
+// The overflow bit of PSW.
+static const int TriCorePSWOverflowBit = 30;
+
+SDValue TriCoreTargetLowering::LowerXALUO(SDValue Op,
+                                          SelectionDAG &DAG) const {
+  SDLoc dl(Op);
+
+  unsigned Opc;
+  switch (Op.getOpcode()) {
+  default: llvm_unreachable("Invalid overflow opcode!");
+  case ISD::SADDO: Opc = TriCoreISD::ADDV; break;
+  case ISD::SSUBO: Opc = TriCoreISD::SUBV; break;
+  case ISD::SMULO: Opc = TriCoreISD::MULV; break;
+  }
+
+  SDValue Value = DAG.getNode(Opc, dl, DAG.getVTList(MVT::i32, MVT::i32),
+                              Op.getOperand(0), Op.getOperand(1));
+  SDValue PSW = Value.getValue(1);
+
+  // Hand back PSW.V as a right shift and mask, which EXTR.U selects and a
+  // branch on it turns into JNZ.T/JZ.T of the flag in place.
+  SDValue Shift = DAG.getNode(TriCoreISD::SH, dl, MVT::i32, PSW,
+                              DAG.getConstant(-TriCorePSWOverflowBit, dl,
+                                              MVT::i32));
+  SDValue Overflow = DAG.getNode(ISD::AND, dl, MVT::i32, Shift,
+                                 DAG.getConstant(1, dl, MVT::i32));
+  // The type legalizer hands over the original i1 flag.
+  if (Op->getValueType(1) != MVT::i32)
+    Overflow = DAG.getNode(ISD::TRUNCATE, dl, Op->getValueType(1), Overflow);
+  return DAG.getMergeValues({Value, Overflow}, dl);
+}
+
+SDValue TriCoreTargetLowering::LowerATOMIC(SDValue Op,
+                                           SelectionDAG &DAG) const {
+  AtomicSDNode *AN = cast<AtomicSDNode>(Op);
+  // Promoted byte and halfword operations and doubleword ones become
+  // libcalls.
+  if (AN->getMemoryVT() != MVT::i32)
+    return LowerATOMICLibCall(Op, DAG);
+
+  switch (Op.getOpcode()) {
+  default:
+    return LowerATOMICLibCall(Op, DAG);
+  case ISD::ATOMIC_SWAP:
+    return Op;
+  case ISD::ATOMIC_CMP_SWAP:
+    return Subtarget.hasCmpSwap() ? Op : LowerATOMICLibCall(Op, DAG);
+  case ISD::ATOMIC_LOAD_AND:
+  case ISD::ATOMIC_LOAD_OR:
+    break;
+  }
+
+  // Both store Val into the bits under the mask: OR masks the bits that are
+  // set in Val, AND the bits that are clear.
+  SDLoc dl(Op);
+  SDValue Val = AN->getVal();
+  SDValue Mask = Op.getOpcode() == ISD::ATOMIC_LOAD_OR
+                     ? Val : DAG.getNOT(dl, Val, MVT::i32);
+  SDValue Pair = DAG.getNode(ISD::BUILD_PAIR, dl, MVT::i64, Val, Mask);
+  SDValue Ops[] = { AN->getChain(), AN->getBasePtr(), Pair };
+
+  // LDMST does not return the old word, but exists on every core.
+  if (!Op->hasAnyUseOfValue(0)) {
+    SDValue Chain = DAG.getMemIntrinsicNode(TriCoreISD::LDMST, dl,
+                                            DAG.getVTList(MVT::Other), Ops,
+                                            MVT::i32, AN->getMemOperand());
+    return DAG.getMergeValues({ DAG.getUNDEF(MVT::i32), Chain }, dl);
+  }
+  if (!Subtarget.hasCmpSwap())
+    return LowerATOMICLibCall(Op, DAG);
+  return DAG.getMemIntrinsicNode(TriCoreISD::SWAPMSK, dl,
+                                 DAG.getVTList(MVT::i32, MVT::Other), Ops,
+                                 MVT::i32, AN->getMemOperand());
+}
+
+SDValue TriCoreTargetLowering::LowerATOMICLibCall(SDValue Op,
+                                                  SelectionDAG &DAG) const {
+  AtomicSDNode *AN = cast<AtomicSDNode>(Op);
+  RTLIB::Libcall LC = RTLIB::getATOMIC(Op.getOpcode(),
+                                       AN->getMemoryVT().getSimpleVT());
+  LLVMContext &C = *DAG.getContext();
+  SDLoc dl(Op);
+
+  // The legalizer would type the address as an integer and pass it in D4.
+  ArgListTy Args;
+  ArgListEntry Entry;
+  Entry.Node = AN->getBasePtr(); Entry.Ty = Type::getInt8PtrTy(C);
+  Args.push_back(Entry);
+  Entry.isZExt = true;
+  for (unsigned i = 2, e = Op.getNumOperands(); i != e; ++i) {
+    Entry.Node = Op.getOperand(i);
+    Entry.Ty = Entry.Node.getValueType().getTypeForEVT(C);
+    Args.push_back(Entry);
+  }
+
+  CallLoweringInfo CLI(DAG);
+  CLI.setDebugLoc(dl)
+      .setChain(AN->getChain())
+      .setCallee(getLibcallCallingConv(LC),
+                 Op.getValueType().getTypeForEVT(C),
+                 DAG.getExternalSymbol(getLibcallName(LC),
+                                       getPointerTy(DAG.getDataLayout())),
+                 std::move(Args), 0)
+      .setZExtResult();
+  std::pair<SDValue, SDValue> Call = LowerCallTo(CLI);
+  return DAG.getMergeValues({ Call.first, Call.second }, dl);
+}
+
+SDValue TriCoreTargetLowering::LowerLOAD(SDValue Op, SelectionDAG &DAG) const {
+  LoadSDNode *LD = cast<LoadSDNode>(Op);
+  SDLoc dl(Op);
+  ISD::LoadExtType ExtType = LD->getExtensionType();
+  EVT MemVT = LD->getMemoryVT();
+
+  // The low word comes from an ordinary load; the extension fills in the odd
+  // register.
+  SDValue Lo = MemVT == MVT::i32
+                   ? DAG.getLoad(MVT::i32, dl, LD->getChain(), LD->getBasePtr(),
+                                 LD->getMemOperand())
+                   : DAG.getExtLoad(ExtType, dl, MVT::i32, LD->getChain(),
+                                    LD->getBasePtr(), MemVT,
+                                    LD->getMemOperand());
+  unsigned Ext = ExtType == ISD::SEXTLOAD   ? ISD::SIGN_EXTEND
+                 : ExtType == ISD::ZEXTLOAD ? ISD::ZERO_EXTEND
+                                            : ISD::ANY_EXTEND;
+  SDValue Ops[] = { DAG.getNode(Ext, dl, MVT::i64, Lo), Lo.getValue(1) };
+  return DAG.getMergeValues(Ops, dl);
+}
+
+TargetLowering::AtomicRMWExpansionKind
+TriCoreTargetLowering::shouldExpandAtomicRMWInIR(AtomicRMWInst *AI) const {
+  if (!Subtarget.hasCmpSwap() ||
+      AI->getType()->getPrimitiveSizeInBits() != 32)
+    return AtomicRMWExpansionKind::None;
+
+  switch (AI->getOperation()) {
+  default:
+    return AtomicRMWExpansionKind::CmpXChg;
+  case AtomicRMWInst::Xchg:
+  case AtomicRMWInst::And:
+  case AtomicRMWInst::Or:
+    return AtomicRMWExpansionKind::None;
+  }
+}
+
+SDValue TriCoreTargetLowering::LowerVASTART(SDValue Op,
+                                            SelectionDAG &DAG) const {
+  MachineFunction &MF = DAG.getMachineFunction();
+  TriCoreFunctionInfo *FuncInfo = MF.getInfo<TriCoreFunctionInfo>();
+  EVT PtrVT = getPointerTy(DAG.getDataLayout());
+  SDLoc dl(Op);
+
+  // Store the address of the first unnamed argument into the va_list.
+  SDValue FrameIndex = DAG.getFrameIndex(FuncInfo->getVarArgsFrameIndex(),
+                                         PtrVT);
+  const Value *SV = cast<SrcValueSDNode>(Op.getOperand(2))->getValue();
+  return DAG.getStore(Op.getOperand(0), dl, FrameIndex, Op.getOperand(1),
+                      MachinePointerInfo(SV), false, false, 0);
+}
+
+SDValue TriCoreTargetLowering::LowerFRAMEADDR(SDValue Op,
+                                              SelectionDAG &DAG) const {
+  MachineFrameInfo *MFI = DAG.getMachineFunction().getFrameInfo();
+  MFI->setFrameAddressIsTaken(true);
+  SDLoc dl(Op);
+
+  // The frame pointers of the callers sit in their saved upper contexts,
+  // which the stack does not link together. Only depth 0 has an answer.
+  if (cast<ConstantSDNode>(Op.getOperand(0))->getZExtValue())
+    return DAG.getConstant(0, dl, MVT::i32);
+  return DAG.getCopyFromReg(DAG.getEntryNode(), dl, TriCore::A14, MVT::i32);
+}
+
 SDValue TriCoreTargetLowering::LowerGlobalAddress(SDValue Op, SelectionDAG& DAG) const
 {
 
@@ -464,16 +954,11 @@ SDValue TriCoreTargetLowering::LowerCall(TargetLowering::CallLoweringInfo &CLI,
 
   CLI.IsTailCall = false;
 
-  if (isVarArg) {
-    llvm_unreachable("Unimplemented");
-  }
-
-
   // Analyze operands of the call, assigning locations to each operand.
   SmallVector<CCValAssign, 16> ArgLocs;
-  CCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), ArgLocs,
-                 *DAG.getContext());
-  CCInfo.AnalyzeCallOperands(Outs, CC_TriCore);
+  TriCoreCCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), ArgLocs,
+                        *DAG.getContext());
+  CCInfo.AnalyzeCallOperands(Outs, CC_TriCore, CLI.getArgs());
 
     // Get the size of the outgoing arguments stack space requirement.
   const unsigned NumBytes = CCInfo.getNextStackOffset();
@@ -485,30 +970,36 @@ SDValue TriCoreTargetLowering::LowerCall(TargetLowering::CallLoweringInfo &CLI,
   SmallVector<std::pair<unsigned, SDValue>, 8> RegsToPass;
   SmallVector<SDValue, 8> MemOpChains;
 
-  // We only support calling global addresses.
-	GlobalAddressSDNode *G = dyn_cast<GlobalAddressSDNode>(Callee);
-	assert(G && "We only support the calling of global addresses");
-	Callee = DAG.getTargetGlobalAddress(G->getGlobal(), Loc, MVT::i32);
+  // Direct calls go to a global or an external symbol (libcalls such as
+  // memcpy), anything else is called indirectly through an address register.
+  if (GlobalAddressSDNode *G = dyn_cast<GlobalAddressSDNode>(Callee))
+    Callee = DAG.getTargetGlobalAddress(G->getGlobal(), Loc, MVT::i32);
+  else if (ExternalSymbolSDNode *E = dyn_cast<ExternalSymbolSDNode>(Callee))
+    Callee = DAG.getTargetExternalSymbol(E->getSymbol(), MVT::i32);
 
-	int32_t originalArgPos = TCCH.findInRegRecord(G->getGlobal()->getName());
-	uint32_t argNum = TCCH.getNumOfArgs(G->getGlobal()->getName());
-  TCCH.init();
-  TCCH.setArgPos(originalArgPos);
   // Walk the register/memloc assignments, inserting copies/loads.
   for (unsigned i = 0, e = ArgLocs.size(); i != e; ++i) {
     CCValAssign &VA = ArgLocs[i];
-    if(i<argNum)
-    	VA.convertToReg(TCCH.getRegRecordRegister(TCCH.getArgPos()));
     SDValue Arg = OutVals[i];
-
-    // We only handle fully promoted arguments.
-    assert(VA.getLocInfo() == CCValAssign::Full && "Unhandled loc info");
+    ISD::ArgFlagsTy Flags = Outs[i].Flags;
+
+    // Promote the value if needed.
+    switch (VA.getLocInfo()) {
+    default: llvm_unreachable("Unknown loc info!");
+    case CCValAssign::Full: break;
+    case CCValAssign::SExt:
+      Arg = DAG.getNode(ISD::SIGN_EXTEND, Loc, VA.getLocVT(), Arg);
+      break;
+    case CCValAssign::ZExt:
+      Arg = DAG.getNode(ISD::ZERO_EXTEND, Loc, VA.getLocVT(), Arg);
+      break;
+    case CCValAssign::AExt:
+      Arg = DAG.getNode(ISD::ANY_EXTEND, Loc, VA.getLocVT(), Arg);
+      break;
+    }
 
     if (VA.isRegLoc()) {
-    	RegsToPass.push_back(
-    					std::make_pair(VA.getLocReg(), Arg));
-    	TCCH.incrArgPos();
-      //RegsToPass.push_back(std::make_pair(VA.getLocReg(), Arg));
+      RegsToPass.push_back(std::make_pair(VA.getLocReg(), Arg));
       continue;
     }
     assert(VA.isMemLoc() &&
@@ -517,6 +1008,20 @@ SDValue TriCoreTargetLowering::LowerCall(TargetLowering::CallLoweringInfo &CLI,
     SDValue StackPtr = DAG.getRegister(TriCore::A10, MVT::i32);
     SDValue PtrOff = DAG.getIntPtrConstant(VA.getLocMemOffset(), Loc);
     PtrOff = DAG.getNode(ISD::ADD, Loc, MVT::i32, StackPtr, PtrOff);
+
+    // Aggregates passed by value are copied into the argument area.
+    if (Flags.isByVal()) {
+      SDValue SizeNode = DAG.getConstant(Flags.getByValSize(), Loc, MVT::i32);
+      MemOpChains.push_back(DAG.getMemcpy(Chain, Loc, PtrOff, Arg, SizeNode,
+                                          Flags.getByValAlign(),
+                                          /*isVolatile=*/false,
+                                          /*AlwaysInline=*/true,
+                                          /*isTailCall=*/false,
+                                          MachinePointerInfo(),
+                                          MachinePointerInfo()));
+      continue;
+    }
+
     MemOpChains.push_back(DAG.getStore(Chain, Loc, Arg, PtrOff,
                                        MachinePointerInfo(), false, false, 0));
   }
@@ -558,8 +1063,12 @@ SDValue TriCoreTargetLowering::LowerCall(TargetLowering::CallLoweringInfo &CLI,
 
   SDVTList NodeTys = DAG.getVTList(MVT::Other, MVT::Glue);
 
+  // fastcc callees are entered with JL or FCALL, which skip the context save.
+  unsigned CallOpc = CallConv == CallingConv::Fast ? TriCoreISD::CALL_FAST
+                                                   : TriCoreISD::CALL;
+
   // Returns a chain and a flag for retval copy to use.
-  Chain = DAG.getNode(TriCoreISD::CALL, Loc, NodeTys, Ops);
+  Chain = DAG.getNode(CallOpc, Loc, NodeTys, Ops);
   InFlag = Chain.getValue(1);
 
   Chain = DAG.getCALLSEQ_END(Chain, DAG.getIntPtrConstant(NumBytes, Loc, true),
@@ -569,36 +1078,26 @@ SDValue TriCoreTargetLowering::LowerCall(TargetLowering::CallLoweringInfo &CLI,
   }
 
 
-  //TCCH.setArgPos(originalArgPos);
   // Handle result values, copying them out of physregs into vregs that we
   // return.
   return LowerCallResult(Chain, InFlag, CallConv, isVarArg, Ins, Loc, DAG,
-                         InVals);
+                         InVals, CLI.RetTy);
 }
 
 SDValue TriCoreTargetLowering::LowerCallResult(
     SDValue Chain, SDValue InGlue, CallingConv::ID CallConv, bool isVarArg,
     const SmallVectorImpl<ISD::InputArg> &Ins, SDLoc dl, SelectionDAG &DAG,
-    SmallVectorImpl<SDValue> &InVals) const {
-  assert(!isVarArg && "Unsupported");
-  //outs()<<"LowerCallResult\n";
-  // Assign locations to each value returned by this call.
+    SmallVectorImpl<SDValue> &InVals, Type *RetTy) const {
+  // Assign locations to each value returned by this call. The callee's
+  // return type decides between A2 and D2.
   SmallVector<CCValAssign, 16> RVLocs;
-  CCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), RVLocs,
-                 *DAG.getContext());
+  TriCoreCCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), RVLocs,
+                        *DAG.getContext());
 
-  Type* t= DAG.getMachineFunction().getFunction()->getReturnType();
-  //t->dump();
-  //outs() << "LowerCallResult IsPointer: " << t->isPointerTy() << "\n";
+  CCInfo.AnalyzeCallResult(Ins, RetCC_TriCore, RetTy);
 
-  CCInfo.AnalyzeCallResult(Ins, RetCC_TriCore);
-  //DAG.getMachineFunction().getFunction()->get
   // Copy all of the result registers out of their specified physreg.
   for (auto &Loc : RVLocs) {
-
-  	if (t->isPointerTy())
-  		Loc.convertToReg(TriCore::A2);
-
     Chain = DAG.getCopyFromReg(Chain, dl, Loc.getLocReg(), Loc.getValVT(),
                                InGlue).getValue(1);
     InGlue = Chain.getValue(2);
@@ -620,87 +1119,71 @@ SDValue TriCoreTargetLowering::LowerFormalArguments(SDValue Chain,
 		const SmallVectorImpl<ISD::InputArg> &Ins, SDLoc dl, SelectionDAG &DAG,
 		SmallVectorImpl<SDValue> &InVals) const {
 	MachineFunction &MF = DAG.getMachineFunction();
+	MachineFrameInfo *MFI = MF.getFrameInfo();
 	MachineRegisterInfo &RegInfo = MF.getRegInfo();
-
-	assert(!isVarArg && "VarArg not supported");
+	TriCoreFunctionInfo *FuncInfo = MF.getInfo<TriCoreFunctionInfo>();
 
 	// Assign locations to all of the incoming arguments.
 	SmallVector<CCValAssign, 16> ArgLocs;
-
-	//get incoming arguments information
-	CCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), ArgLocs,
-			*DAG.getContext());
-
-	StringRef funName = DAG.getMachineFunction().getFunction()->getName();
-
-//  DAG.getMachineFunction().getFunction()
+	TriCoreCCState CCInfo(CallConv, isVarArg, MF, ArgLocs, *DAG.getContext());
 	CCInfo.AnalyzeFormalArguments(Ins, CC_TriCore);
 
+	// FCALL pushes the return address below the caller's argument area.
+	const unsigned ArgOffset =
+			CallConv == CallingConv::Fast && Subtarget.hasFCall() ? 4 : 0;
 
-	CCValAssign VA;
-	TCCH.init();
-
-	for (uint32_t i = 0; i < ArgLocs.size(); i++) {
-
-		VA = ArgLocs[i];
-
-		SDValue ArgIn;
-		unsigned AddrReg;
-		if (TCCH.isRegValPtrType(MF)) {
-			//Is there any address register available?
-			AddrReg = TCCH.getNextAddrRegs(funName);
-			if (AddrReg != UNKNOWN_REG)
-				VA.convertToReg(AddrReg);
-		  }
-		else if (TCCH.isRegVali64Type(MF)) {
-			unsigned ExtReg = TCCH.getNextExtRegs(funName);
-			if (ExtReg != UNKNOWN_REG)
-				VA.convertToReg(ExtReg);
-		}
-		else {
-			unsigned DataReg = TCCH.getNextDataRegs(funName);
-			if (DataReg != UNKNOWN_REG)
-				VA.convertToReg(DataReg);
-		}
+	for (unsigned i = 0, e = ArgLocs.size(); i != e; ++i) {
+		CCValAssign &VA = ArgLocs[i];
+		ISD::ArgFlagsTy Flags = Ins[i].Flags;
 
 		if (VA.isRegLoc()) {
 			// Arguments passed in registers
 			EVT RegVT = VA.getLocVT();
-			assert( (RegVT.getSimpleVT().SimpleTy == MVT::i32 ||
-					   RegVT.getSimpleVT().SimpleTy == MVT::i64)
-							&& "supports MVT::i32 and  MVT::i64  register passing");
-
+			unsigned LocReg = VA.getLocReg();
 			unsigned VReg;
+			SDValue ArgIn;
 
-			// If the argument is a pointer type then create a AddrRegsClass
-			// Virtual register.
-			if (TCCH.isRegValPtrType(MF)) {
-				VA.setValVT(MVT(MVT::iPTR));
+			// If the argument was assigned an address register then create a
+			// AddrRegsClass virtual register and mark the value as a pointer.
+			if (TriCore::AddrRegsRegClass.contains(LocReg)) {
 				VReg = RegInfo.createVirtualRegister(&TriCore::AddrRegsRegClass);
-				RegInfo.addLiveIn(VA.getLocReg(), VReg); //mark the register is inuse
-				TCCH.saveRegRecord(funName, VA.getLocReg(), true);
-				TCCH++;
+				RegInfo.addLiveIn(LocReg, VReg); //mark the register is inuse
 				ArgIn = DAG.getCopyFromReg(Chain, dl, VReg, RegVT, MVT::iPTR);
 			}
-			else if (TCCH.isRegVali64Type(MF))  {
+			else if (TriCore::ExtRegsRegClass.contains(LocReg))  {
 				VReg = RegInfo.createVirtualRegister(&TriCore::ExtRegsRegClass);
-				RegInfo.addLiveIn(VA.getLocReg(), VReg); //mark the register is inuse
-				TCCH.saveRegRecord(funName, VA.getLocReg(), false);
+				RegInfo.addLiveIn(LocReg, VReg); //mark the register is inuse
 				ArgIn = DAG.getCopyFromReg(Chain, dl, VReg, RegVT, MVT::i64);
-				TCCH++;
+			}
+			else if (TriCore::FPRegsRegClass.contains(LocReg))  {
+				VReg = RegInfo.createVirtualRegister(&TriCore::FPRegsRegClass);
+				RegInfo.addLiveIn(LocReg, VReg); //mark the register is inuse
+				ArgIn = DAG.getCopyFromReg(Chain, dl, VReg, RegVT);
 			}
 			// else place it inside a data register.
 			else {
+				assert(RegVT == MVT::i32 && "Unexpected argument type");
 				VReg = RegInfo.createVirtualRegister(&TriCore::DataRegsRegClass);
-				RegInfo.addLiveIn(VA.getLocReg(), VReg); //mark the register is inuse
-				TCCH.saveRegRecord(funName, VA.getLocReg(), false);
+				RegInfo.addLiveIn(LocReg, VReg); //mark the register is inuse
 				ArgIn = DAG.getCopyFromReg(Chain, dl, VReg, RegVT, MVT::i32);
-				TCCH++;
 			}
 
+			// Arguments promoted to i32 by the caller are truncated back, keeping
+			// the knowledge about their upper bits.
+			if (VA.getLocInfo() == CCValAssign::SExt)
+				ArgIn = DAG.getNode(ISD::AssertSext, dl, RegVT, ArgIn,
+				                    DAG.getValueType(VA.getValVT()));
+			else if (VA.getLocInfo() == CCValAssign::ZExt)
+				ArgIn = DAG.getNode(ISD::AssertZext, dl, RegVT, ArgIn,
+				                    DAG.getValueType(VA.getValVT()));
+			if (VA.getLocInfo() != CCValAssign::Full)
+				ArgIn = DAG.getNode(ISD::TRUNCATE, dl, VA.getValVT(), ArgIn);
+
+			// The EABI returns the sret pointer in A2, so keep hold of it.
+			if (Flags.isSRet())
+				FuncInfo->setSRetReturnReg(VReg);
 
 			InVals.push_back(ArgIn);
-			TCCH.incrArgPos();
 			continue;
 		}
 
@@ -708,31 +1191,43 @@ SDValue TriCoreTargetLowering::LowerFormalArguments(SDValue Chain,
 				VA.isMemLoc()
 						&& "Can only pass arguments as either registers or via the stack");
 
-		const unsigned Offset = VA.getLocMemOffset();
+		const unsigned Offset = VA.getLocMemOffset() + ArgOffset;
 
-		// create stack offset it the input argument is placed in memory
-
-		uint64_t size = 4;
-		if (VA.getValVT() == MVT::i64)
-			size = 8;
+		// Aggregates passed by value were copied into the caller's argument
+		// area, the argument is simply the address of that copy.
+		if (Flags.isByVal()) {
+			int FI = MFI->CreateFixedObject(Flags.getByValSize(), Offset, true);
+			InVals.push_back(DAG.getFrameIndex(FI, getPointerTy(DAG.getDataLayout())));
+			continue;
+		}
 
-		const int FI = MF.getFrameInfo()->CreateFixedObject(size, Offset, true);
+		// create stack offset it the input argument is placed in memory
+		EVT LocVT = VA.getLocVT();
+		const int FI = MFI->CreateFixedObject(LocVT.getStoreSize(), Offset, true);
 		EVT PtrTy = getPointerTy(DAG.getDataLayout());
 		SDValue FIPtr = DAG.getFrameIndex(FI, PtrTy);
 
-//		assert(
-//				VA.getValVT() == MVT::i32 && "Only support passing arguments as i32");
-
 		//create a load node for the created frame object
-		SDValue Load = DAG.getLoad(VA.getValVT(), dl, Chain, FIPtr,
-				MachinePointerInfo(), false, false, false, 0);
+		SDValue Load;
+		if (VA.getLocInfo() == CCValAssign::Full)
+			Load = DAG.getLoad(VA.getValVT(), dl, Chain, FIPtr,
+					MachinePointerInfo::getFixedStack(FI), false, false, false, 0);
+		else
+			Load = DAG.getExtLoad(ISD::EXTLOAD, dl, LocVT, Chain, FIPtr,
+					MachinePointerInfo::getFixedStack(FI), VA.getValVT(),
+					false, false, false, 0);
+		if (VA.getLocInfo() != CCValAssign::Full)
+			Load = DAG.getNode(ISD::TRUNCATE, dl, VA.getValVT(), Load);
 
 		InVals.push_back(Load);
-		TCCH.incrArgPos();
 	}
 
-	TCCH.setCurPos(0);
-	//TCCH.printRegRecord();
+	// The unnamed arguments of a variadic function follow the named stack
+	// arguments. Remember where they start for va_start.
+	if (isVarArg)
+		FuncInfo->setVarArgsFrameIndex(
+				MFI->CreateFixedObject(4, CCInfo.getNextStackOffset() + ArgOffset,
+				                       true));
 
 	return Chain;
 }
@@ -745,7 +1240,7 @@ bool TriCoreTargetLowering::CanLowerReturn(
     CallingConv::ID CallConv, MachineFunction &MF, bool isVarArg,
     const SmallVectorImpl<ISD::OutputArg> &Outs, LLVMContext &Context) const {
   SmallVector<CCValAssign, 16> RVLocs;
-  CCState CCInfo(CallConv, isVarArg, MF, RVLocs, Context);
+  TriCoreCCState CCInfo(CallConv, isVarArg, MF, RVLocs, Context);
   if (!CCInfo.CheckReturn(Outs, RetCC_TriCore)) {
     return false;
   }
@@ -761,21 +1256,17 @@ TriCoreTargetLowering::LowerReturn(SDValue Chain, CallingConv::ID CallConv,
                                const SmallVectorImpl<ISD::OutputArg> &Outs,
                                const SmallVectorImpl<SDValue> &OutVals,
                                SDLoc dl, SelectionDAG &DAG) const {
-  if (isVarArg) {
-    report_fatal_error("VarArg not supported");
-  }
-
   // CCValAssign - represent the assignment of
   // the return value to a location
   SmallVector<CCValAssign, 16> RVLocs;
 
-  Type* t= DAG.getMachineFunction().getFunction()->getReturnType();
-
   // CCState - Info about the registers and stack slot.
-  CCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), RVLocs,
-                 *DAG.getContext());
+  TriCoreCCState CCInfo(CallConv, isVarArg, DAG.getMachineFunction(), RVLocs,
+                        *DAG.getContext());
 
-  CCInfo.AnalyzeReturn(Outs, RetCC_TriCore);
+  // Pointers are returned in A2, so the CCState needs the IR return type.
+  CCInfo.AnalyzeReturn(Outs, RetCC_TriCore,
+                       DAG.getMachineFunction().getFunction()->getReturnType());
 
   SDValue Flag;
   SmallVector<SDValue, 4> RetOps(1, Chain);
@@ -784,10 +1275,6 @@ TriCoreTargetLowering::LowerReturn(SDValue Chain, CallingConv::ID CallConv,
   for (unsigned i = 0, e = RVLocs.size(); i < e; ++i) {
     CCValAssign &VA = RVLocs[i];
 
-    // if it is a pointer, we have to store in A2
-    if (t->isPointerTy())
-    	VA.convertToReg(TriCore::A2);
-
     assert(VA.isRegLoc() && "Can only return in registers!");
 
     Chain = DAG.getCopyToReg(Chain, dl, VA.getLocReg(), OutVals[i], Flag);
@@ -796,6 +1283,19 @@ TriCoreTargetLowering::LowerReturn(SDValue Chain, CallingConv::ID CallConv,
     RetOps.push_back(DAG.getRegister(VA.getLocReg(), VA.getLocVT()));
   }
 
+  // Functions returning a structure through sret hand the pointer back to
+  // the caller in A2.
+  MachineFunction &MF = DAG.getMachineFunction();
+  if (unsigned SRetReg = MF.getInfo<TriCoreFunctionInfo>()->getSRetReturnReg()) {
+    assert(RVLocs.empty() && "sret function with a return value");
+    SDValue Val = DAG.getCopyFromReg(Chain, dl, SRetReg,
+                                     getPointerTy(DAG.getDataLayout()));
+    Chain = DAG.getCopyToReg(Chain, dl, TriCore::A2, Val, Flag);
+    Flag = Chain.getValue(1);
+    RetOps.push_back(DAG.getRegister(TriCore::A2,
+                                     getPointerTy(DAG.getDataLayout())));
+  }
+
   RetOps[0] = Chain; // Update chain.
 
   // Add the flag if we have it.
@@ -803,5 +1303,605 @@ TriCoreTargetLowering::LowerReturn(SDValue Chain, CallingConv::ID CallConv,
     RetOps.push_back(Flag);
   }
 
+  // Interrupt handlers leave with RFE, which also restores the interrupted
+  // priority and interrupt enable.
+  if (TriCoreFrameLowering::isInterruptHandler(MF)) {
+    if (!Outs.empty())
+      report_fatal_error("interrupt handlers cannot return a value");
+    return DAG.getNode(TriCoreISD::RFE_FLAG, dl, MVT::Other, RetOps);
+  }
+
+  // fastcc functions jump back through A11, or pop it again with FRET.
+  if (CallConv == CallingConv::Fast)
+    return DAG.getNode(TriCoreISD::RET_FAST, dl, MVT::Other, RetOps);
+
   return DAG.getNode(TriCoreISD::RET_FLAG, dl, MVT::Other, RetOps);
 }
+
+//===----------------------------------------------------------------------===//
+//                          DAG Combine
+//===----------------------------------------------------------------------===//
+
+// Match smin(smax(X, Lo), Hi) or smax(smin(X, Hi), Lo) with constant bounds.
+static bool isSignedClamp(SDValue N, SDValue &X, int64_t &Lo, int64_t &Hi) {
+  unsigned Opc = N.getOpcode();
+  if (Opc != ISD::SMIN && Opc != ISD::SMAX)
+    return false;
+  unsigned InnerOpc = Opc == ISD::SMIN ? ISD::SMAX : ISD::SMIN;
+  SDValue Inner = N.getOperand(0);
+  if (Inner.getOpcode() != InnerOpc)
+    return false;
+
+  ConstantSDNode *Outer = dyn_cast<ConstantSDNode>(N.getOperand(1));
+  ConstantSDNode *InnerC = dyn_cast<ConstantSDNode>(Inner.getOperand(1));
+  if (!Outer || !InnerC)
+    return false;
+
+  X = Inner.getOperand(0);
+  Lo = Opc == ISD::SMIN ? InnerC->getSExtValue() : Outer->getSExtValue();
+  Hi = Opc == ISD::SMIN ? Outer->getSExtValue() : InnerC->getSExtValue();
+  return true;
+}
+
+// Look through an extension of a 32-bit value to 64 bits.
+static SDValue getExtendedOperand(SDValue N, unsigned ExtOpc) {
+  if (N.getOpcode() == ExtOpc && N.getOperand(0).getValueType() == MVT::i32)
+    return N.getOperand(0);
+  return SDValue();
+}
+
+// clamp(X, [-128, 127]) -> SAT.B, umin(X, 255) -> SAT.BU, and the same for
+// halfwords.
+static SDValue PerformMinMaxCombine(SDNode *N, SelectionDAG &DAG) {
+  if (N->getValueType(0) != MVT::i32)
+    return SDValue();
+  SDLoc dl(N);
+
+  if (N->getOpcode() == ISD::UMIN) {
+    ConstantSDNode *C = dyn_cast<ConstantSDNode>(N->getOperand(1));
+    if (!C)
+      return SDValue();
+    if (C->getZExtValue() == 0xff)
+      return DAG.getNode(TriCoreISD::SAT_BU, dl, MVT::i32, N->getOperand(0));
+    if (C->getZExtValue() == 0xffff)
+      return DAG.getNode(TriCoreISD::SAT_HU, dl, MVT::i32, N->getOperand(0));
+    return SDValue();
+  }
+
+  SDValue X;
+  int64_t Lo, Hi;
+  if (!isSignedClamp(SDValue(N, 0), X, Lo, Hi))
+    return SDValue();
+  if (Lo == INT8_MIN && Hi == INT8_MAX)
+    return DAG.getNode(TriCoreISD::SAT_B, dl, MVT::i32, X);
+  if (Lo == INT16_MIN && Hi == INT16_MAX)
+    return DAG.getNode(TriCoreISD::SAT_H, dl, MVT::i32, X);
+  return SDValue();
+}
+
+// A 32-bit add or subtract done in 64 bits and clamped back to the 32-bit
+// range is what ADDS, ADDS.U, SUBS and SUBS.U compute directly:
+//   trunc(clamp(sext(a) +/- sext(b), INT32_MIN, INT32_MAX)) -> ADDS/SUBS
+//   trunc(umin(zext(a) + zext(b), UINT32_MAX))              -> ADDS.U
+//   trunc(smax(zext(a) - zext(b), 0))                       -> SUBS.U
+// The Q31 product (int32)(((int64)a * b) >> 31) is MUL.Q. Only the low word
+// of the shift is used, so it may have been turned into a logical one.
+static SDValue PerformTruncateCombine(SDNode *N, SelectionDAG &DAG) {
+  SDValue Op = N->getOperand(0);
+  if (N->getValueType(0) != MVT::i32 || Op.getValueType() != MVT::i64)
+    return SDValue();
+  SDLoc dl(N);
+
+  if ((Op.getOpcode() == ISD::SRA || Op.getOpcode() == ISD::SRL) &&
+      Op.getOperand(0).getOpcode() == ISD::MUL) {
+    ConstantSDNode *Amt = dyn_cast<ConstantSDNode>(Op.getOperand(1));
+    SDValue Mul = Op.getOperand(0);
+    SDValue A = getExtendedOperand(Mul.getOperand(0), ISD::SIGN_EXTEND);
+    SDValue B = getExtendedOperand(Mul.getOperand(1), ISD::SIGN_EXTEND);
+    if (Amt && Amt->getZExtValue() == 31 && A.getNode() && B.getNode())
+      return DAG.getNode(TriCoreISD::MUL_Q, dl, MVT::i32, A, B);
+    return SDValue();
+  }
+
+  SDValue X;
+  int64_t Lo, Hi;
+  if (isSignedClamp(Op, X, Lo, Hi)) {
+    if (Lo != INT32_MIN || Hi != INT32_MAX)
+      return SDValue();
+    if (X.getOpcode() != ISD::ADD && X.getOpcode() != ISD::SUB)
+      return SDValue();
+    SDValue A = getExtendedOperand(X.getOperand(0), ISD::SIGN_EXTEND);
+    SDValue B = getExtendedOperand(X.getOperand(1), ISD::SIGN_EXTEND);
+    if (!A.getNode() || !B.getNode())
+      return SDValue();
+    unsigned Opc = X.getOpcode() == ISD::ADD ? TriCoreISD::ADDS
+                                             : TriCoreISD::SUBS;
+    return DAG.getNode(Opc, dl, MVT::i32, A, B);
+  }
+
+  ConstantSDNode *C = Op.getNumOperands() == 2 ?
+                      dyn_cast<ConstantSDNode>(Op.getOperand(1)) : nullptr;
+  if (!C)
+    return SDValue();
+  X = Op.getOperand(0);
+
+  unsigned Opc;
+  if (Op.getOpcode() == ISD::UMIN && X.getOpcode() == ISD::ADD &&
+      C->getZExtValue() == UINT32_MAX)
+    Opc = TriCoreISD::ADDS_U;
+  else if (Op.getOpcode() == ISD::SMAX && X.getOpcode() == ISD::SUB &&
+           C->isNullValue())
+    Opc = TriCoreISD::SUBS_U;
+  else
+    return SDValue();
+
+  SDValue A = getExtendedOperand(X.getOperand(0), ISD::ZERO_EXTEND);
+  SDValue B = getExtendedOperand(X.getOperand(1), ISD::ZERO_EXTEND);
+  if (!A.getNode() || !B.getNode())
+    return SDValue();
+  return DAG.getNode(Opc, dl, MVT::i32, A, B);
+}
+
+// The generic combiner rewrites abs(X) as xor(add(X, Y), Y) with
+// Y = sra(X, 31). Turn that into ABS, or ABSDIF when X is a difference that
+// cannot wrap, since ABSDIF does not wrap either.
+static SDValue PerformXORCombine(SDNode *N, SelectionDAG &DAG) {
+  if (N->getValueType(0) != MVT::i32)
+    return SDValue();
+
+  SDValue Add = N->getOperand(0);
+  SDValue Sign = N->getOperand(1);
+  if (Add.getOpcode() != ISD::ADD)
+    std::swap(Add, Sign);
+  if (Add.getOpcode() != ISD::ADD || Sign.getOpcode() != ISD::SRA)
+    return SDValue();
+
+  SDValue X = Sign.getOperand(0);
+  ConstantSDNode *Amt = dyn_cast<ConstantSDNode>(Sign.getOperand(1));
+  if (!Amt || Amt->getZExtValue() != 31)
+    return SDValue();
+  if (!((Add.getOperand(0) == X && Add.getOperand(1) == Sign) ||
+        (Add.getOperand(1) == X && Add.getOperand(0) == Sign)))
+    return SDValue();
+
+  SDLoc dl(N);
+  if ((X.getOpcode() == ISD::SUB || X.getOpcode() == ISD::ADD) &&
+      cast<BinaryWithFlagsSDNode>(X.getNode())->Flags.hasNoSignedWrap()) {
+    SDValue A = X.getOperand(0);
+    SDValue B = X.getOperand(1);
+    if (X.getOpcode() == ISD::ADD) {
+      // sub nsw a, C arrives here as add nsw a, -C.
+      ConstantSDNode *C = dyn_cast<ConstantSDNode>(B);
+      if (!C || C->getAPIntValue().isMinSignedValue())
+        return DAG.getNode(TriCoreISD::ABS, dl, MVT::i32, X);
+      B = DAG.getConstant(-C->getSExtValue(), dl, MVT::i32);
+    }
+    return DAG.getNode(TriCoreISD::ABSDIF, dl, MVT::i32, A, B);
+  }
+  return DAG.getNode(TriCoreISD::ABS, dl, MVT::i32, X);
+}
+
+// Split V into (X, n) if it is bit n of X moved down to bit 0, or take it
+// as bit 0 of itself.
+static void getBitSource(SDValue V, SDValue &X, unsigned &Bit) {
+  X = V;
+  Bit = 0;
+  if (V.getOpcode() != ISD::SRL)
+    return;
+  ConstantSDNode *Amt = dyn_cast<ConstantSDNode>(V.getOperand(1));
+  if (Amt && Amt->getZExtValue() < 32) {
+    X = V.getOperand(0);
+    Bit = Amt->getZExtValue();
+  }
+}
+
+// and(op(A, B), 1) with op one of AND/OR/XOR combines bit 0 of A and B,
+// which AND.T/OR.T/XOR.T do directly on any bit. The generic combiner has
+// already hoisted the "& 1" out of the two single-bit operands.
+static SDValue PerformBitLogicCombine(SDNode *N, SelectionDAG &DAG) {
+  ConstantSDNode *One = dyn_cast<ConstantSDNode>(N->getOperand(1));
+  if (N->getValueType(0) != MVT::i32 || !One || One->getZExtValue() != 1)
+    return SDValue();
+
+  SDValue Op = N->getOperand(0);
+  unsigned Opc;
+  switch (Op.getOpcode()) {
+  default: return SDValue();
+  case ISD::AND: Opc = TriCoreISD::AND_T; break;
+  case ISD::OR:  Opc = TriCoreISD::OR_T;  break;
+  case ISD::XOR: Opc = TriCoreISD::XOR_T; break;
+  }
+
+  SDValue A, B;
+  unsigned PosA, PosB;
+  getBitSource(Op.getOperand(0), A, PosA);
+  getBitSource(Op.getOperand(1), B, PosB);
+  // Without a shift on either side the plain 32-bit op does as well.
+  if (!PosA && !PosB)
+    return SDValue();
+
+  SDLoc dl(N);
+  return DAG.getNode(Opc, dl, MVT::i32, A, DAG.getConstant(PosA, dl, MVT::i32),
+                     B, DAG.getConstant(PosB, dl, MVT::i32));
+}
+
+static bool isNot(SDValue V) {
+  return V.getOpcode() == ISD::XOR && isa<ConstantSDNode>(V.getOperand(1)) &&
+         cast<ConstantSDNode>(V.getOperand(1))->isAllOnesValue();
+}
+
+// or(and(X, ~(1 << p)), Bit) where Bit is a single bit of Y placed at p:
+//   and(Y, 1 << p)                 -> INS.T  X, p, Y, p
+//   and(not(Y), 1 << p)            -> INSN.T X, p, Y, p
+//   and(srl(Y, k), 1 << p)         -> INS.T  X, p, Y, p + k
+//   shl(and(srl(Y, q), 1), p)      -> INS.T  X, p, Y, q
+static SDValue PerformInsertBitCombine(SDNode *N, SelectionDAG &DAG) {
+  if (N->getValueType(0) != MVT::i32)
+    return SDValue();
+
+  for (unsigned i = 0; i < 2; ++i) {
+    SDValue Keep = N->getOperand(i);
+    SDValue Ins = N->getOperand(1 - i);
+    ConstantSDNode *KeepMask = Keep.getOpcode() == ISD::AND ?
+        dyn_cast<ConstantSDNode>(Keep.getOperand(1)) : nullptr;
+    if (!KeepMask)
+      continue;
+    uint32_t Hole = ~(uint32_t)KeepMask->getZExtValue();
+    if (!isPowerOf2_32(Hole))
+      continue;
+    unsigned Pos = Log2_32(Hole);
+
+    SDValue Y;
+    unsigned YPos;
+    unsigned Opc = TriCoreISD::INS_T;
+    if (Ins.getOpcode() == ISD::AND && isa<ConstantSDNode>(Ins.getOperand(1)) &&
+        cast<ConstantSDNode>(Ins.getOperand(1))->getZExtValue() == Hole) {
+      Y = Ins.getOperand(0);
+      YPos = Pos;
+      // The bit may come from further up Y, as in (Y >> k) & (1 << p), and
+      // the complement may be taken before or after that shift.
+      if (isNot(Y)) {
+        Y = Y.getOperand(0);
+        Opc = TriCoreISD::INSN_T;
+      }
+      SDValue Src;
+      unsigned Shift;
+      getBitSource(Y, Src, Shift);
+      if (Pos + Shift < 32) {
+        Y = Src;
+        YPos += Shift;
+      }
+      if (Opc == TriCoreISD::INS_T && isNot(Y)) {
+        Y = Y.getOperand(0);
+        Opc = TriCoreISD::INSN_T;
+      }
+    } else if (Ins.getOpcode() == ISD::SHL &&
+               isa<ConstantSDNode>(Ins.getOperand(1)) &&
+               cast<ConstantSDNode>(Ins.getOperand(1))->getZExtValue() == Pos &&
+               Ins.getOperand(0).getOpcode() == ISD::AND &&
+               isa<ConstantSDNode>(Ins.getOperand(0).getOperand(1)) &&
+               cast<ConstantSDNode>(Ins.getOperand(0).getOperand(1))
+                   ->getZExtValue() == 1) {
+      getBitSource(Ins.getOperand(0).getOperand(0), Y, YPos);
+    } else
+      continue;
+
+    SDLoc dl(N);
+    return DAG.getNode(Opc, dl, MVT::i32, Keep.getOperand(0),
+                       DAG.getConstant(Pos, dl, MVT::i32), Y,
+                       DAG.getConstant(YPos, dl, MVT::i32));
+  }
+  return SDValue();
+}
+
+// Fold a logic operation on a compare into an accumulating compare, which
+// combines the compare result with bit 0 of its other operand:
+//   or(X, cmp(a, b))          -> OR.cc  X, a, b
+//   xor(X, cmp(a, b))         -> XOR.cc X, a, b
+//   and(X, cmp(a, b))         -> AND.cc X, a, b   if X is 0 or 1
+//   or(SH(X, 1), cmp(a, b))   -> SH.cc  X, a, b
+// Chained conditions such as a < b && c == d turn into one compare followed
+// by accumulating ones.
+static SDValue PerformLogicCmpCombine(SDNode *N, SelectionDAG &DAG) {
+  if (N->getValueType(0) != MVT::i32)
+    return SDValue();
+
+  TriCoreCC::LogicCodes Logic;
+  switch (N->getOpcode()) {
+  default: llvm_unreachable("Unexpected logic opcode!");
+  case ISD::AND: Logic = TriCoreCC::LOGIC_AND; break;
+  case ISD::OR:  Logic = TriCoreCC::LOGIC_OR;  break;
+  case ISD::XOR: Logic = TriCoreCC::LOGIC_XOR; break;
+  }
+
+  for (unsigned i = 0; i < 2; ++i) {
+    SDValue Acc = N->getOperand(i);
+    SDValue Cmp = N->getOperand(1 - i);
+    if (Cmp.getOpcode() != TriCoreISD::CMP || !Cmp.hasOneUse())
+      continue;
+
+    TriCoreCC::LogicCodes L = Logic;
+    ConstantSDNode *Amt = Acc.getOpcode() == TriCoreISD::SH ?
+        dyn_cast<ConstantSDNode>(Acc.getOperand(1)) : nullptr;
+    if (L == TriCoreCC::LOGIC_OR && Amt && Amt->getSExtValue() == 1) {
+      Acc = Acc.getOperand(0);
+      L = TriCoreCC::LOGIC_SH;
+    } else if (L == TriCoreCC::LOGIC_AND && !isBoolean(Acc, DAG))
+      continue;
+
+    TriCoreCC::CondCodes CC = (TriCoreCC::CondCodes)
+        cast<ConstantSDNode>(Cmp.getOperand(2))->getZExtValue();
+    SDLoc dl(N);
+    SDVTList VTs = DAG.getVTList(MVT::i32, MVT::Glue);
+    SDValue Ops[] = {Acc, Cmp.getOperand(0), Cmp.getOperand(1),
+                     DAG.getConstant(TriCoreCC::getLogicCmpCode(L, CC), dl,
+                                     MVT::i32)};
+    return DAG.getNode(TriCoreISD::LOGICCMP, dl, VTs, Ops);
+  }
+  return SDValue();
+}
+
+// Branches and selects test their condition with cmp(X, 0, ne). When X is
+// already a 0/1 compare result, use it directly; cmp(cmp(a, b), 0, eq) is
+// the inverted compare.
+static SDValue PerformCMPCombine(SDNode *N,
+                                 TargetLowering::DAGCombinerInfo &DCI) {
+  SelectionDAG &DAG = DCI.DAG;
+  SDValue X = N->getOperand(0);
+  ConstantSDNode *Zero = dyn_cast<ConstantSDNode>(N->getOperand(1));
+  if (!Zero || !Zero->isNullValue())
+    return SDValue();
+
+  unsigned XOpc = X.getOpcode();
+  if (XOpc != TriCoreISD::CMP && XOpc != TriCoreISD::LOGICCMP)
+    return SDValue();
+  // Only one node can take X's glue.
+  if (!SDValue(X.getNode(), 1).use_empty())
+    return SDValue();
+
+  unsigned CC = cast<ConstantSDNode>(N->getOperand(2))->getZExtValue();
+  if (CC == TriCoreCC::COND_NE && isBoolean(X, DAG))
+    return DCI.CombineTo(N, X, SDValue(X.getNode(), 1));
+
+  if (CC == TriCoreCC::COND_EQ && XOpc == TriCoreISD::CMP && X.hasOneUse()) {
+    unsigned Inv;
+    switch (cast<ConstantSDNode>(X.getOperand(2))->getZExtValue()) {
+    default: llvm_unreachable("Invalid TriCore condition!");
+    case TriCoreCC::COND_EQ:  Inv = TriCoreCC::COND_NE;  break;
+    case TriCoreCC::COND_NE:  Inv = TriCoreCC::COND_EQ;  break;
+    case TriCoreCC::COND_GE:  Inv = TriCoreCC::COND_LT;  break;
+    case TriCoreCC::COND_LT:  Inv = TriCoreCC::COND_GE;  break;
+    case TriCoreCC::COND_GEU: Inv = TriCoreCC::COND_LTU; break;
+    case TriCoreCC::COND_LTU: Inv = TriCoreCC::COND_GEU; break;
+    }
+    SDLoc dl(N);
+    SDValue Ops[] = {X.getOperand(0), X.getOperand(1),
+                     DAG.getConstant(Inv, dl, MVT::i32)};
+    return DAG.getNode(TriCoreISD::CMP, dl, N->getVTList(), Ops);
+  }
+  return SDValue();
+}
+
+// A volatile read-modify-write of a word that only sets and clears constant
+// bits, as peripheral register updates do, turns into one masked store that
+// the bus cannot split:
+//   store(or(and(load p, K), C), p)  ->  LDMST p, (~K | C) << 32 | C
+// The value/mask pair usually fits a single IMASK. When a single bit changes
+// at an absolute address ST.T can reach, that bit is stored on its own:
+//   store(or(load A, 1 << n), A)     ->  ST.T A + n / 8, n % 8, 1
+static SDValue PerformVolatileRMWCombine(SDNode *N, SelectionDAG &DAG) {
+  StoreSDNode *ST = cast<StoreSDNode>(N);
+  SDValue Val = ST->getValue();
+  if (!ST->isVolatile() || !ST->isUnindexed() || ST->isTruncatingStore() ||
+      Val.getValueType() != MVT::i32 || !Val.hasOneUse())
+    return SDValue();
+
+  // Peel at most an and and an or with constants, innermost last.
+  SmallVector<SDValue, 2> Logic;
+  SDValue V = Val;
+  while (Logic.size() < 2 && (V.getOpcode() == ISD::OR ||
+                              V.getOpcode() == ISD::AND) &&
+         isa<ConstantSDNode>(V.getOperand(1)) && V.hasOneUse()) {
+    Logic.push_back(V);
+    V = V.getOperand(0);
+  }
+
+  LoadSDNode *Ld = dyn_cast<LoadSDNode>(V);
+  if (Logic.empty() || !Ld || !Ld->isVolatile() || !Ld->isUnindexed() ||
+      Ld->getExtensionType() != ISD::NON_EXTLOAD ||
+      Ld->getMemoryVT() != MVT::i32 || !V.hasOneUse() ||
+      Ld->getBasePtr() != ST->getBasePtr() ||
+      ST->getChain() != SDValue(Ld, 1) || !SDValue(Ld, 1).hasOneUse())
+    return SDValue();
+
+  // LDMST traps on an address that is not word aligned. A volatile field of
+  // a packed structure keeps its plain load and store.
+  if (Ld->getAlignment() < 4 || ST->getAlignment() < 4)
+    return SDValue();
+
+  // The word becomes (L & Keep) | Set.
+  uint32_t Keep = ~0u, Set = 0;
+  for (auto I = Logic.rbegin(), E = Logic.rend(); I != E; ++I) {
+    uint32_t Imm = cast<ConstantSDNode>(I->getOperand(1))->getZExtValue();
+    if (I->getOpcode() == ISD::OR) {
+      Set |= Imm;
+    } else {
+      Keep &= Imm;
+      Set &= Imm;
+    }
+  }
+  uint32_t Mask = ~Keep | Set;
+  if (!Mask)
+    return SDValue();
+
+  MachineFunction &MF = DAG.getMachineFunction();
+  unsigned Flags = MachineMemOperand::MOLoad | MachineMemOperand::MOStore |
+                   MachineMemOperand::MOVolatile;
+  SDLoc dl(N);
+
+  // ST.T encodes address bits 31-28 and 13-0, and rewrites only one byte.
+  ConstantSDNode *Addr = dyn_cast<ConstantSDNode>(ST->getBasePtr());
+  if (Addr && isPowerOf2_32(Mask)) {
+    unsigned Bit = countTrailingZeros(Mask);
+    uint32_t ByteAddr = Addr->getZExtValue() + Bit / 8;
+    if ((ByteAddr & 0x0FFFC000) == 0) {
+      MachineMemOperand *MMO = MF.getMachineMemOperand(
+          ST->getPointerInfo().getWithOffset(Bit / 8), Flags, 1, 1);
+      SDValue Ops[] = { Ld->getChain(),
+                        DAG.getTargetConstant(ByteAddr, dl, MVT::i32),
+                        DAG.getTargetConstant(Bit % 8, dl, MVT::i32),
+                        DAG.getTargetConstant((Set >> Bit) & 1, dl, MVT::i32) };
+      return DAG.getMemIntrinsicNode(TriCoreISD::ST_T, dl,
+                                     DAG.getVTList(MVT::Other), Ops, MVT::i8,
+                                     MMO);
+    }
+  }
+
+  MachineMemOperand *MMO = MF.getMachineMemOperand(
+      ST->getPointerInfo(), Flags, 4, ST->getAlignment());
+  SDValue Ops[] = { Ld->getChain(), ST->getBasePtr(),
+                    DAG.getConstant((uint64_t)Mask << 32 | Set, dl, MVT::i64) };
+  return DAG.getMemIntrinsicNode(TriCoreISD::LDMST, dl,
+                                 DAG.getVTList(MVT::Other), Ops, MVT::i32, MMO);
+}
+
+/// getFetchBufferSize - The bytes of code the core buffers ahead of
+/// execution. A loop that fits runs from the buffer once it is aligned.
+static unsigned getFetchBufferSize(const TriCoreSubtarget &ST) {
+  switch (ST.getProcFamily()) {
+  case TriCoreSubtarget::TC16P:
+  case TriCoreSubtarget::TC18:
+    return 32;
+  default:
+    return 16;
+  }
+}
+
+unsigned TriCoreTargetLowering::getPrefLoopAlignment(MachineLoop *ML) const {
+  unsigned Align = TargetLowering::getPrefLoopAlignment(ML);
+  if (!Align || !ML || !AlignSmallLoops)
+    return Align;
+
+  const TriCoreInstrInfo *TII = Subtarget.getInstrInfo();
+  unsigned LoopSize = 0;
+  for (auto I = ML->block_begin(), E = ML->block_end(); I != E; ++I)
+    for (const MachineInstr &MI : **I)
+      LoopSize += TII->GetInstSizeInBytes(&MI);
+
+  // The padding costs a fetch on every entry, a loop that has to be fetched
+  // again on each iteration anyway gains little from it.
+  return LoopSize <= getFetchBufferSize(Subtarget) ? Align : 0;
+}
+
+void TriCoreTargetLowering::computeKnownBitsForTargetNode(
+    const SDValue Op, APInt &KnownZero, APInt &KnownOne,
+    const SelectionDAG &DAG, unsigned Depth) const {
+  unsigned BitWidth = KnownZero.getBitWidth();
+  KnownZero = KnownOne = APInt(BitWidth, 0);
+  if (Op.getResNo() != 0)
+    return;
+
+  switch (Op.getOpcode()) {
+  default: break;
+  case TriCoreISD::CMP:
+    KnownZero = APInt::getHighBitsSet(BitWidth, BitWidth - 1);
+    break;
+  case TriCoreISD::LOGICCMP: {
+    // Bits 31-1 come from the accumulator, shifted up by one for SH.cc.
+    DAG.computeKnownBits(Op.getOperand(0), KnownZero, KnownOne, Depth + 1);
+    unsigned Code = cast<ConstantSDNode>(Op.getOperand(3))->getZExtValue();
+    if (Code / 8 == TriCoreCC::LOGIC_SH) {
+      KnownZero = KnownZero.shl(1);
+      KnownOne = KnownOne.shl(1);
+    }
+    KnownZero.clearBit(0);
+    KnownOne.clearBit(0);
+    break;
+  }
+  }
+}
+
+SDValue TriCoreTargetLowering::PerformDAGCombine(SDNode *N,
+                                                 DAGCombinerInfo &DCI) const {
+  SelectionDAG &DAG = DCI.DAG;
+  switch (N->getOpcode()) {
+  default: break;
+  case ISD::SMIN:
+  case ISD::SMAX:
+  case ISD::UMIN:     return PerformMinMaxCombine(N, DAG);
+  case ISD::TRUNCATE: return PerformTruncateCombine(N, DAG);
+  case ISD::XOR:
+    if (SDValue Res = PerformXORCombine(N, DAG))
+      return Res;
+    break;
+  case ISD::SADDO:
+  case ISD::SSUBO:
+  case ISD::SMULO:
+    // The legalizer visits users before their operands, so a branch on the
+    // overflow flag would be lowered before the flag is. Expose PSW.V now
+    // and the branch tests that bit with JZ.T/JNZ.T.
+    if (N->getValueType(0) == MVT::i32)
+      return LowerXALUO(SDValue(N, 0), DAG);
+    break;
+  }
+
+  // Compares only exist as TriCoreISD::CMP once SETCC has been lowered.
+  // The single-bit forms look for right shifts, which are gone by then.
+  if (!DCI.isBeforeLegalizeOps()) {
+    switch (N->getOpcode()) {
+    default: break;
+    case ISD::AND:
+    case ISD::OR:
+    case ISD::XOR:           return PerformLogicCmpCombine(N, DAG);
+    case TriCoreISD::CMP:    return PerformCMPCombine(N, DCI);
+    }
+    return SDValue();
+  }
+  switch (N->getOpcode()) {
+  default: break;
+  case ISD::AND:      return PerformBitLogicCombine(N, DAG);
+  case ISD::OR:       return PerformInsertBitCombine(N, DAG);
+  case ISD::STORE:    return PerformVolatileRMWCombine(N, DAG);
+  }
+  return SDValue();
+}
+
+//===----------------------------------------------------------------------===//
+//                       Inline Assembly Support
+//===----------------------------------------------------------------------===//
+
+TargetLowering::ConstraintType
+TriCoreTargetLowering::getConstraintType(StringRef Constraint) const {
+  if (Constraint.size() == 1) {
+    switch (Constraint[0]) {
+    default:
+      break;
+    case 'a':
+    case 'd':
+      return C_RegisterClass;
+    }
+  }
+  return TargetLowering::getConstraintType(Constraint);
+}
+
+std::pair<unsigned, const TargetRegisterClass *>
+TriCoreTargetLowering::getRegForInlineAsmConstraint(
+    const TargetRegisterInfo *TRI, StringRef Constraint, MVT VT) const {
+  if (Constraint.size() == 1) {
+    switch (Constraint[0]) {
+    default:
+      break;
+    case 'd':
+    case 'r':
+      // A 64-bit value takes an even/odd pair, %e2 for %d2 and %d3.
+      if (VT == MVT::i64)
+        return std::make_pair(0U, &TriCore::ExtRegsRegClass);
+      if (VT == MVT::f32)
+        return std::make_pair(0U, &TriCore::FPRegsRegClass);
+      return std::make_pair(0U, &TriCore::DataRegsRegClass);
+    case 'a':
+      return std::make_pair(0U, &TriCore::AddrRegsRegClass);
+    }
+  }
+  return TargetLowering::getRegForInlineAsmConstraint(TRI, Constraint, VT);
+}
@@ -30,11 +30,17 @@ enum NodeType {
   // Start the numbering where the builtin ops and target ops leave off.
   FIRST_NUMBER = ISD::BUILTIN_OP_END,
   RET_FLAG,
+  // Return from an interrupt handler with RFE.
+  RFE_FLAG,
+  // Return from a fastcc function with JI A11 or FRET.
+  RET_FAST,
   // This loads the symbol (e.g. global address) into a register.
   LOAD_SYM,
   // This loads a 32-bit immediate into a register.
   MOVEi32,
   CALL,
+  // Call a fastcc function with JL or FCALL.
+  CALL_FAST,
 	// TriCore has a different way of lowering branch conditions.
 	BR_CC,
 	// This loads the comparison type, as Tricore doesn't support all
@@ -52,7 +58,39 @@ enum NodeType {
 	SELECT_CC,
 	LOGICCMP,
 	IMASK,
-	EXTR
+	EXTR,
+	// Saturating add/subtract, signed and unsigned.
+	ADDS,
+	ADDS_U,
+	SUBS,
+	SUBS_U,
+	// Saturate to the signed/unsigned byte and halfword ranges.
+	SAT_B,
+	SAT_BU,
+	SAT_H,
+	SAT_HU,
+	// Absolute value and absolute difference.
+	ABS,
+	ABSDIF,
+	// Q31 multiply: upper word of the product shifted left by one.
+	MUL_Q,
+	// Branch on one bit of a register (JZ.T/JNZ.T).
+	BR_BIT,
+	// Single-bit logic and insertion (AND.T, OR.T, XOR.T, INS.T, INSN.T).
+	AND_T,
+	OR_T,
+	XOR_T,
+	INS_T,
+	INSN_T,
+	// Add, subtract and multiply that also return PSW, read by MFCR.
+	ADDV,
+	SUBV,
+	MULV,
+	// Masked word updates, which need to carry a memory operand.
+	SWAPMSK = ISD::FIRST_TARGET_MEMORY_OPCODE,
+	LDMST,
+	// Store a single bit to an absolute address.
+	ST_T
 	};
 }
 
@@ -61,7 +99,8 @@ enum NodeType {
 //===--------------------------------------------------------------------===//
 class TriCoreTargetLowering : public TargetLowering {
 public:
-  explicit TriCoreTargetLowering(TriCoreTargetMachine &TM);
+  TriCoreTargetLowering(TriCoreTargetMachine &TM,
+                        const TriCoreSubtarget &STI);
 
   /// LowerOperation - Provide custom lowering hooks for some operations.
   virtual SDValue LowerOperation(SDValue Op, SelectionDAG &DAG) const;
@@ -70,6 +109,31 @@ public:
   //  DAG node.
   virtual const char *getTargetNodeName(unsigned Opcode) const;
 
+  /// PerformDAGCombine - Fold clamp idioms into saturating operations.
+  SDValue PerformDAGCombine(SDNode *N, DAGCombinerInfo &DCI) const override;
+
+  /// shouldExpandAtomicRMWInIR - Turn the read-modify-write operations
+  /// without an instruction of their own into CMPSWAP.W loops.
+  AtomicRMWExpansionKind
+  shouldExpandAtomicRMWInIR(AtomicRMWInst *AI) const override;
+
+  /// computeKnownBitsForTargetNode - Compare results are 0 or 1.
+  void computeKnownBitsForTargetNode(const SDValue Op, APInt &KnownZero,
+                                     APInt &KnownOne, const SelectionDAG &DAG,
+                                     unsigned Depth = 0) const override;
+
+  /// getPrefLoopAlignment - With -tricore-align-small-loops, leave the loops
+  /// that do not fit the fetch buffer unaligned.
+  unsigned getPrefLoopAlignment(MachineLoop *ML) const override;
+
+  /// getConstraintType - 'd' asks for a data register, 'a' for an address
+  /// register.
+  ConstraintType getConstraintType(StringRef Constraint) const override;
+
+  std::pair<unsigned, const TargetRegisterClass *>
+  getRegForInlineAsmConstraint(const TargetRegisterInfo *TRI,
+                               StringRef Constraint, MVT VT) const override;
+
 private:
   const TriCoreSubtarget &Subtarget;
 
@@ -91,7 +155,8 @@ private:
                           CallingConv::ID CallConv, bool isVarArg,
                           const SmallVectorImpl<ISD::InputArg> &Ins, SDLoc dl,
                           SelectionDAG &DAG,
-                          SmallVectorImpl<SDValue> &InVals) const;
+                          SmallVectorImpl<SDValue> &InVals,
+                          Type *RetTy) const;
 
   bool CanLowerReturn(CallingConv::ID CallConv, MachineFunction &MF,
                       bool isVarArg,
@@ -112,8 +177,36 @@ private:
 
   SDValue LowerSETCC(SDValue Op, SelectionDAG &DAG) const;
 
+  // Lower va_start
+  SDValue LowerVASTART(SDValue Op, SelectionDAG &DAG) const;
+
+  // Lower llvm.frameaddress
+  SDValue LowerFRAMEADDR(SDValue Op, SelectionDAG &DAG) const;
+
   // Lower Shift Instruction
   SDValue LowerShifts(SDValue Op, SelectionDAG &DAG) const;
+
+  // Lower byte swaps without SHUFFLE
+  SDValue LowerBSWAP(SDValue Op, SelectionDAG &DAG) const;
+
+  // Lower rotates to the left rotates DEXTR selects
+  SDValue LowerRotate(SDValue Op, SelectionDAG &DAG) const;
+
+  // Lower 64-bit min/max that did not fold into a saturating operation
+  SDValue LowerMinMax(SDValue Op, SelectionDAG &DAG) const;
+
+  // Lower signed overflow intrinsics onto PSW.V
+  SDValue LowerXALUO(SDValue Op, SelectionDAG &DAG) const;
+
+  // Keep the word atomics the instructions cover, map and/or onto the masked
+  // updates
+  SDValue LowerATOMIC(SDValue Op, SelectionDAG &DAG) const;
+
+  // Call the __sync routine for an atomic no instruction covers
+  SDValue LowerATOMICLibCall(SDValue Op, SelectionDAG &DAG) const;
+
+  // Split extending loads to i64 into a 32-bit load and an extension
+  SDValue LowerLOAD(SDValue Op, SelectionDAG &DAG) const;
 };
 }
 
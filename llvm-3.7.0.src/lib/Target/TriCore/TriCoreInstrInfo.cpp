@@ -23,10 +23,12 @@
 #include "llvm/CodeGen/MachineRegisterInfo.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Function.h"
+#include "llvm/MC/MCAsmInfo.h"
 #include "llvm/MC/MCContext.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/TargetRegistry.h"
+#include "llvm/Target/TargetMachine.h"
 
 #define GET_INSTRINFO_CTOR_DTOR
 #include "TriCoreGenInstrInfo.inc"
@@ -49,6 +51,15 @@ TriCoreInstrInfo::TriCoreInstrInfo()
 unsigned
 TriCoreInstrInfo::isLoadFromStackSlot(const MachineInstr *MI, int &FrameIndex)
                                           const{
+	switch (MI->getOpcode()) {
+	default:
+		return 0;
+	case TriCore::LDWbo:
+	case TriCore::LDWbo_f:
+	case TriCore::LDDbo:
+	case TriCore::LDAbo:
+		break;
+	}
 
 	if ((MI->getOperand(1).isFI()) && (MI->getOperand(2).isImm())
 			&& (MI->getOperand(2).getImm() == 0)) {
@@ -57,9 +68,6 @@ TriCoreInstrInfo::isLoadFromStackSlot(const MachineInstr *MI, int &FrameIndex)
 	}
 
 	return 0;
-
-//  assert(0 && "Unimplemented");
-//  return 0;
 }
   
   /// isStoreToStackSlot - If the specified machine instruction is a direct
@@ -69,18 +77,24 @@ TriCoreInstrInfo::isLoadFromStackSlot(const MachineInstr *MI, int &FrameIndex)
   /// any side effects other than storing to the stack slot.
 unsigned TriCoreInstrInfo::isStoreToStackSlot(const MachineInstr *MI,
 		int &FrameIndex) const {
+	switch (MI->getOpcode()) {
+	default:
+		return 0;
+	case TriCore::STWbo:
+	case TriCore::STWbo_f:
+	case TriCore::STDbo:
+	case TriCore::STAbo:
+		break;
+	}
 
-	if ((MI->getOperand(0).isFI()) && (MI->getOperand(1).isImm())
-			&& (MI->getOperand(1).getImm() == 0)) {
-		FrameIndex = MI->getOperand(0).getIndex();
-		return MI->getOperand(2).getReg();
+	// Stores take the value first, then the memsrc pair.
+	if ((MI->getOperand(1).isFI()) && (MI->getOperand(2).isImm())
+			&& (MI->getOperand(2).getImm() == 0)) {
+		FrameIndex = MI->getOperand(1).getIndex();
+		return MI->getOperand(0).getReg();
 	}
 
 	return 0;
-
-//  assert(0 && "Unimplemented");
-//  return 0;
-
 }
 
 void TriCoreInstrInfo::copyPhysReg(MachineBasicBlock &MBB,
@@ -88,6 +102,11 @@ void TriCoreInstrInfo::copyPhysReg(MachineBasicBlock &MBB,
 		unsigned DestReg, unsigned SrcReg,
 		bool KillSrc) const {
 
+	// The floating point registers are names for the data registers.
+	if (TriCore::FPRegsRegClass.contains(DestReg))
+		DestReg = RI.getSubReg(DestReg, TriCore::subreg_even);
+	if (TriCore::FPRegsRegClass.contains(SrcReg))
+		SrcReg = RI.getSubReg(SrcReg, TriCore::subreg_even);
 
 	bool DataRegsDest = TriCore::DataRegsRegClass.contains(DestReg);
 	bool DataRegsSrc = TriCore::DataRegsRegClass.contains(SrcReg);
@@ -115,6 +134,16 @@ void TriCoreInstrInfo::copyPhysReg(MachineBasicBlock &MBB,
 		return;
 	}
 
+	// Register pairs are copied one half at a time. The pairs are aligned,
+	// so the halves never overlap.
+	if (TriCore::ExtRegsRegClass.contains(DestReg, SrcReg)) {
+		for (unsigned SubIdx : {TriCore::subreg_even, TriCore::subreg_odd})
+			BuildMI(MBB, I, DL, get(TriCore::MOVrr), RI.getSubReg(DestReg, SubIdx))
+				.addReg(RI.getSubReg(SrcReg, SubIdx), getKillRegState(KillSrc));
+		return;
+	}
+
+	llvm_unreachable("Impossible reg-to-reg copy");
 }
 
 void TriCoreInstrInfo::storeRegToStackSlot(MachineBasicBlock &MBB,
@@ -136,7 +165,19 @@ void TriCoreInstrInfo::storeRegToStackSlot(MachineBasicBlock &MBB,
 					MFI.getObjectAlignment(FrameIndex));
 
 
-	BuildMI(MBB, I, I->getDebugLoc(), get(TriCore::STWbo))
+	unsigned Opc;
+	if (TriCore::DataRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::STWbo;
+	else if (TriCore::AddrRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::STAbo;
+	else if (TriCore::ExtRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::STDbo;
+	else if (TriCore::FPRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::STWbo_f;
+	else
+		llvm_unreachable("Cannot store this register to a stack slot!");
+
+	BuildMI(MBB, I, DL, get(Opc))
 	.addReg(SrcReg, getKillRegState(isKill))
 	.addFrameIndex(FrameIndex).addImm(0).addMemOperand(MMO);
 }
@@ -152,8 +193,6 @@ void TriCoreInstrInfo::loadRegFromStackSlot(MachineBasicBlock &MBB,
 	MachineFunction &MF = *MBB.getParent();
 	MachineFrameInfo &MFI = *MF.getFrameInfo();
 
-	// issues the machine instruction “ld $r, offset($sp)”
-	// to load incoming arguments from stack frame offset
 	MachineMemOperand *MMO =
 			MF.getMachineMemOperand(MachinePointerInfo::getFixedStack(FrameIndex),
 					MachineMemOperand::MOLoad,
@@ -161,7 +200,19 @@ void TriCoreInstrInfo::loadRegFromStackSlot(MachineBasicBlock &MBB,
 					MFI.getObjectAlignment(FrameIndex));
 
 
-	BuildMI(MBB, I, I->getDebugLoc(), get(TriCore::LDWbo), DestReg)
+	unsigned Opc;
+	if (TriCore::DataRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::LDWbo;
+	else if (TriCore::AddrRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::LDAbo;
+	else if (TriCore::ExtRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::LDDbo;
+	else if (TriCore::FPRegsRegClass.hasSubClassEq(RC))
+		Opc = TriCore::LDWbo_f;
+	else
+		llvm_unreachable("Cannot load this register from a stack slot!");
+
+	BuildMI(MBB, I, DL, get(Opc), DestReg)
       .addFrameIndex(FrameIndex).addImm(0).addMemOperand(MMO);
 }
 
@@ -437,6 +488,19 @@ void TriCoreInstrInfo::splitRegs(unsigned Reg, unsigned &LoReg, unsigned &HiReg)
 	HiReg = RI.getSubReg(Reg, TriCore::subreg_odd);
 }
 
+/// GetInstSizeInBytes - Return the number of bytes of code the specified
+/// instruction may be. This returns the maximum number of bytes.
+unsigned TriCoreInstrInfo::GetInstSizeInBytes(const MachineInstr *MI) const {
+	const MachineFunction *MF = MI->getParent()->getParent();
+	const MCAsmInfo *MAI = MF->getTarget().getMCAsmInfo();
+
+	switch (MI->getOpcode()) {
+	default:
+		return MI->getDesc().getSize();
+	case TargetOpcode::INLINEASM:
+		return getInlineAsmLength(MI->getOperand(0).getSymbolName(), *MAI);
+	}
+}
 
 bool TriCoreInstrInfo::expandPostRAPseudo(MachineBasicBlock::iterator MI) const
 {
@@ -562,6 +626,13 @@ bool TriCoreInstrInfo::expandPostRAPseudo(MachineBasicBlock::iterator MI) const
 				OpHi = TriCore::ORrc;
 			}
 
+			// ANDN, ORN and XNOR take the complement of the negative halves.
+			if (OpLo == TriCore::ANDNrc || OpLo == TriCore::ORNrc ||
+			    OpLo == TriCore::XNORrc) {
+				lowByte = ~lowByte;
+				highByte = ~highByte;
+			}
+
 			BuildMI(MBB, MI, DL, get(OpLo))
 				.addReg(DstLoReg, RegState::Define | getDeadRegState(DstIsDead))
 				.addReg(Src0LoReg, getKillRegState(Src0IsKill))
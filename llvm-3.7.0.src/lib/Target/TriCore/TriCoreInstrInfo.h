@@ -28,14 +28,23 @@ namespace TriCoreCC {
 		COND_NE, // Not equal
 		COND_GE, // Greater than or equal
 		COND_LT, // Less than
+		COND_GEU, // Greater than or equal, unsigned
+		COND_LTU, // Less than, unsigned
 		COND_INVALID
 	};
 
 	enum LogicCodes {
 			LOGIC_AND, // AND
 			LOGIC_OR,  // OR
+			LOGIC_XOR, // XOR
+			LOGIC_SH,  // Shift left and insert
 			LOGIC_INVALID
 		};
+
+	// The code operand of TriCoreISD::LOGICCMP.
+	inline unsigned getLogicCmpCode(LogicCodes Logic, CondCodes CC) {
+		return Logic * 8 + CC;
+	}
 }
 
 class TriCoreInstrInfo : public TriCoreGenInstrInfo {
@@ -89,6 +98,10 @@ public:
 
   void splitRegs(unsigned Reg, unsigned &LoReg, unsigned &HiReg) const;
 
+  /// GetInstSizeInBytes - Return the number of bytes of code the specified
+  /// instruction may be. This returns the maximum number of bytes.
+  unsigned GetInstSizeInBytes(const MachineInstr *MI) const;
+
    virtual bool expandPostRAPseudo(MachineBasicBlock::iterator MI) const
      override;
 
@@ -0,0 +1,229 @@
+//===-- TriCoreLoopLatch.cpp - Form JNED/JNEI loop latches ----------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This pass folds the counter step, compare and conditional branch at the end
+// of a block into a single JNEI or JNED, which compare the counter against a
+// bound, branch if they differ and then step the counter by one:
+//
+//   add  %d4, 1                  jnei %d4, 5, .LBB0_1
+//   ne   %d5, %d4, 6       =>    j    .LBB0_2
+//   jnz  %d5, .LBB0_1
+//   j    .LBB0_2
+//
+// It runs after register allocation: the counter is defined by the terminator
+// itself, which PHI elimination cannot handle as it copies values out of a
+// block before its first terminator.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCore.h"
+#include "TriCoreInstrInfo.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/CodeGen/MachineFunctionPass.h"
+#include "llvm/CodeGen/MachineInstrBuilder.h"
+#include "llvm/CodeGen/MachineRegisterInfo.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Target/TargetRegisterInfo.h"
+#include "llvm/Target/TargetSubtargetInfo.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-loop-latch"
+
+STATISTIC(NumCounterBranches, "Number of JNED/JNEI loop latches formed");
+
+namespace {
+  struct TriCoreLoopLatch : public MachineFunctionPass {
+    static char ID;
+    TriCoreLoopLatch() : MachineFunctionPass(ID) {}
+
+    bool runOnMachineFunction(MachineFunction &MF) override;
+
+    const char *getPassName() const override {
+      return "TriCore Loop Latch Branches";
+    }
+
+  private:
+    const TargetInstrInfo *TII;
+    const TargetRegisterInfo *TRI;
+
+    bool formCounterBranch(MachineBasicBlock &MBB);
+    bool isLiveOut(MachineBasicBlock &MBB, unsigned Reg) const;
+  };
+  char TriCoreLoopLatch::ID = 0;
+}
+
+/// createTriCoreLoopLatchPass - returns an instance of the loop latch pass.
+FunctionPass *llvm::createTriCoreLoopLatchPass() {
+  return new TriCoreLoopLatch();
+}
+
+/// getCounterStep - Return +1 or -1 if MI steps Reg by one in place, and 0
+/// otherwise.
+static int getCounterStep(const MachineInstr &MI, unsigned Reg) {
+  switch (MI.getOpcode()) {
+  default:
+    return 0;
+  case TriCore::ADDsrc:
+  case TriCore::ADDrc:
+    break;
+  }
+  if (MI.getOperand(0).getReg() != Reg || MI.getOperand(1).getReg() != Reg ||
+      !MI.getOperand(2).isImm())
+    return 0;
+  int64_t Imm = MI.getOperand(2).getImm();
+  return (Imm == 1 || Imm == -1) ? Imm : 0;
+}
+
+bool TriCoreLoopLatch::isLiveOut(MachineBasicBlock &MBB, unsigned Reg) const {
+  for (MachineBasicBlock *Succ : MBB.successors())
+    for (MCRegAliasIterator AI(Reg, TRI, true); AI.isValid(); ++AI)
+      if (Succ->isLiveIn(*AI))
+        return true;
+  return false;
+}
+
+bool TriCoreLoopLatch::formCounterBranch(MachineBasicBlock &MBB) {
+  MachineBasicBlock::iterator Br = MBB.getFirstTerminator();
+  if (Br == MBB.end())
+    return false;
+
+  unsigned BrOpc = Br->getOpcode();
+  if (BrOpc != TriCore::JNZsbr && BrOpc != TriCore::JZsbr)
+    return false;
+
+  MachineBasicBlock *Taken = Br->getOperand(0).getMBB();
+  unsigned CondReg = Br->getOperand(1).getReg();
+
+  // The other successor is only reachable for retargeting through an explicit
+  // trailing jump.
+  MachineBasicBlock::iterator Jmp = std::next(Br);
+  if (Jmp != MBB.end() && Jmp->getOpcode() != TriCore::Jb)
+    return false;
+
+  // The flag is folded away, so nothing else may observe it.
+  if (isLiveOut(MBB, CondReg))
+    return false;
+
+  // Find the compare feeding the branch.
+  MachineBasicBlock::iterator Cmp = Br;
+  do {
+    if (Cmp == MBB.begin())
+      return false;
+    --Cmp;
+    if (Cmp->readsRegister(CondReg, TRI) &&
+        !Cmp->modifiesRegister(CondReg, TRI))
+      return false;
+  } while (!Cmp->modifiesRegister(CondReg, TRI));
+
+  bool CmpNE;
+  bool IsImm;
+  switch (Cmp->getOpcode()) {
+  default:
+    return false;
+  case TriCore::NErc: CmpNE = true;  IsImm = true;  break;
+  case TriCore::EQrc: CmpNE = false; IsImm = true;  break;
+  case TriCore::NErr: CmpNE = true;  IsImm = false; break;
+  case TriCore::EQrr: CmpNE = false; IsImm = false; break;
+  }
+
+  // Both register compares are commutative, so the counter may be either
+  // operand. Pick the one stepped by one before the compare.
+  unsigned CntIdx = 1;
+  MachineBasicBlock::iterator Step;
+  int StepBy = 0;
+  for (unsigned Idx = 1; Idx <= (IsImm ? 1u : 2u) && !StepBy; ++Idx) {
+    unsigned Reg = Cmp->getOperand(Idx).getReg();
+    if (Reg == CondReg)
+      continue;
+    for (Step = Cmp; Step != MBB.begin();) {
+      --Step;
+      if (Step->modifiesRegister(Reg, TRI)) {
+        StepBy = getCounterStep(*Step, Reg);
+        CntIdx = Idx;
+        break;
+      }
+    }
+  }
+  if (!StepBy)
+    return false;
+
+  unsigned Counter = Cmp->getOperand(CntIdx).getReg();
+  const MachineOperand &Bound = Cmp->getOperand(3 - CntIdx);
+  if (IsImm ? !Bound.isImm() : Bound.getReg() == Counter)
+    return false;
+
+  // The step moves down to the branch, so the counter must not be touched
+  // between its old and new position apart from the compare being folded.
+  for (MachineBasicBlock::iterator I = std::next(Step); I != Br; ++I)
+    if (I != Cmp && (I->readsRegister(Counter, TRI) ||
+                     I->modifiesRegister(Counter, TRI)))
+      return false;
+
+  // JNEI/JNED compare the counter before stepping it, so (i + s != n) becomes
+  // (i != n - s).
+  int64_t NewBound = 0;
+  if (IsImm) {
+    NewBound = Bound.getImm() - StepBy;
+    if (!isInt<4>(NewBound))
+      return false;
+  }
+
+  // The new branch is taken when the counter misses the bound. For the
+  // inverted senses swap the targets with the trailing jump.
+  MachineBasicBlock *Target = Taken;
+  bool BranchOnNE = CmpNE == (BrOpc == TriCore::JNZsbr);
+  if (!BranchOnNE) {
+    if (Jmp == MBB.end())
+      return false;
+    Target = Jmp->getOperand(0).getMBB();
+    if (Target == Taken)
+      return false;
+    Jmp->getOperand(0).setMBB(Taken);
+  }
+
+  DebugLoc DL = Br->getDebugLoc();
+  unsigned Opc;
+  if (IsImm) {
+    Opc = StepBy > 0 ? TriCore::JNEIbrc : TriCore::JNEDbrc;
+    BuildMI(MBB, Br, DL, TII->get(Opc), Counter)
+        .addReg(Counter)
+        .addImm(NewBound)
+        .addMBB(Target);
+  } else {
+    // The dead flag register holds the adjusted bound.
+    BuildMI(MBB, Cmp, Cmp->getDebugLoc(), TII->get(TriCore::ADDrc), CondReg)
+        .addReg(Bound.getReg(), getKillRegState(Bound.isKill()))
+        .addImm(-StepBy);
+    Opc = StepBy > 0 ? TriCore::JNEIbrr : TriCore::JNEDbrr;
+    BuildMI(MBB, Br, DL, TII->get(Opc), Counter)
+        .addReg(Counter)
+        .addReg(CondReg, RegState::Kill)
+        .addMBB(Target);
+  }
+
+  Step->eraseFromParent();
+  Cmp->eraseFromParent();
+  Br->eraseFromParent();
+  ++NumCounterBranches;
+  return true;
+}
+
+bool TriCoreLoopLatch::runOnMachineFunction(MachineFunction &MF) {
+  if (!MF.getRegInfo().tracksLiveness())
+    return false;
+
+  TII = MF.getSubtarget().getInstrInfo();
+  TRI = MF.getSubtarget().getRegisterInfo();
+
+  bool Changed = false;
+  for (MachineBasicBlock &MBB : MF)
+    Changed |= formCounterBranch(MBB);
+  return Changed;
+}
@@ -25,10 +25,26 @@ class Function;
 /// TriCoreFunctionInfo - This class is derived from MachineFunction private
 /// TriCore target-specific information for each MachineFunction.
 class TriCoreFunctionInfo : public MachineFunctionInfo {
+  /// VarArgsFrameIndex - FrameIndex for start of varargs area.
+  int VarArgsFrameIndex;
+
+  /// SRetReturnReg - Holds the virtual register into which the sret
+  /// argument is passed. The EABI returns it again in A2.
+  unsigned SRetReturnReg;
+
 public:
-  TriCoreFunctionInfo() {}
+  TriCoreFunctionInfo() : VarArgsFrameIndex(0), SRetReturnReg(0) {}
+
+  explicit TriCoreFunctionInfo(MachineFunction &MF)
+    : VarArgsFrameIndex(0), SRetReturnReg(0) {}
 
   ~TriCoreFunctionInfo() {}
+
+  int getVarArgsFrameIndex() const { return VarArgsFrameIndex; }
+  void setVarArgsFrameIndex(int Index) { VarArgsFrameIndex = Index; }
+
+  unsigned getSRetReturnReg() const { return SRetReturnReg; }
+  void setSRetReturnReg(unsigned Reg) { SRetReturnReg = Reg; }
 };
 } // End llvm namespace
 
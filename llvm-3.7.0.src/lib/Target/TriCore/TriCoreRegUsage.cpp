@@ -0,0 +1,170 @@
+//===-- TriCoreRegUsage.cpp - Interprocedural register usage --------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// A call clobbers the whole lower context as far as the calling convention
+// is concerned, while a small callee rarely touches more than a few of its
+// registers. These passes let a caller keep values in the registers its
+// callees leave alone:
+//
+//  - The call graph order pass makes the code generator visit the functions
+//    of a module bottom-up, so callees are compiled before their callers.
+//  - The collector runs last and records the registers a finished function
+//    preserves, i.e. those it never writes plus those its convention saves.
+//  - The propagator runs before register allocation and replaces the regmask
+//    of every direct call to an already compiled function with its record.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TriCore.h"
+#include "TriCoreFrameLowering.h"
+#include "TriCoreTargetMachine.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/CallGraphSCCPass.h"
+#include "llvm/CodeGen/MachineFunctionPass.h"
+#include "llvm/CodeGen/MachineInstr.h"
+#include "llvm/CodeGen/MachineRegisterInfo.h"
+#include "llvm/IR/Function.h"
+#include "llvm/InitializePasses.h"
+#include "llvm/Target/TargetRegisterInfo.h"
+#include "llvm/Target/TargetSubtargetInfo.h"
+using namespace llvm;
+
+#define DEBUG_TYPE "tricore-reg-usage"
+
+STATISTIC(NumCallsTightened, "Number of call regmasks taken from the callee");
+
+namespace {
+  struct TriCoreCallGraphOrder : public CallGraphSCCPass {
+    static char ID;
+    TriCoreCallGraphOrder() : CallGraphSCCPass(ID) {
+      // llc only registers the code generator's own passes.
+      initializeCallGraphWrapperPassPass(*PassRegistry::getPassRegistry());
+    }
+
+    // The pass itself does nothing, the function passes added after it run
+    // nested in its SCC walk.
+    bool runOnSCC(CallGraphSCC &SCC) override { return false; }
+
+    void getAnalysisUsage(AnalysisUsage &AU) const override {
+      AU.setPreservesAll();
+    }
+
+    const char *getPassName() const override {
+      return "TriCore Call Graph Order";
+    }
+  };
+  char TriCoreCallGraphOrder::ID = 0;
+
+  struct TriCoreRegUsageCollector : public MachineFunctionPass {
+    static char ID;
+    explicit TriCoreRegUsageCollector(TriCoreTargetMachine &TM)
+        : MachineFunctionPass(ID), TM(TM) {}
+
+    bool doInitialization(Module &M) override {
+      TM.clearRegUsage();
+      return false;
+    }
+
+    bool runOnMachineFunction(MachineFunction &MF) override;
+
+    const char *getPassName() const override {
+      return "TriCore Register Usage Collector";
+    }
+
+  private:
+    TriCoreTargetMachine &TM;
+  };
+  char TriCoreRegUsageCollector::ID = 0;
+
+  struct TriCoreRegUsagePropagate : public MachineFunctionPass {
+    static char ID;
+    explicit TriCoreRegUsagePropagate(TriCoreTargetMachine &TM)
+        : MachineFunctionPass(ID), TM(TM) {}
+
+    bool runOnMachineFunction(MachineFunction &MF) override;
+
+    const char *getPassName() const override {
+      return "TriCore Register Usage Propagation";
+    }
+
+  private:
+    TriCoreTargetMachine &TM;
+  };
+  char TriCoreRegUsagePropagate::ID = 0;
+}
+
+/// createTriCoreCallGraphOrderPass - returns an instance of the pass that
+/// makes code generation run bottom-up over the call graph.
+Pass *llvm::createTriCoreCallGraphOrderPass() {
+  return new TriCoreCallGraphOrder();
+}
+
+/// createTriCoreRegUsageCollectorPass - returns an instance of the register
+/// usage collector.
+FunctionPass *
+llvm::createTriCoreRegUsageCollectorPass(TriCoreTargetMachine &TM) {
+  return new TriCoreRegUsageCollector(TM);
+}
+
+/// createTriCoreRegUsagePropagatePass - returns an instance of the register
+/// usage propagation pass.
+FunctionPass *
+llvm::createTriCoreRegUsagePropagatePass(TriCoreTargetMachine &TM) {
+  return new TriCoreRegUsagePropagate(TM);
+}
+
+bool TriCoreRegUsageCollector::runOnMachineFunction(MachineFunction &MF) {
+  const Function *F = MF.getFunction();
+
+  // Only the definition compiled here is known to be the one called. Nobody
+  // calls an interrupt handler.
+  if (F->mayBeOverridden() || TriCoreFrameLowering::isInterruptHandler(MF))
+    return false;
+
+  const TargetRegisterInfo *TRI = MF.getSubtarget().getRegisterInfo();
+  const MachineRegisterInfo &MRI = MF.getRegInfo();
+  unsigned NumRegs = TRI->getNumRegs();
+
+  // Start from what the convention promises, spills of callee-saved
+  // registers count as writes otherwise.
+  const uint32_t *CCMask = TRI->getCallPreservedMask(MF, F->getCallingConv());
+  std::vector<uint32_t> Mask(CCMask, CCMask + (NumRegs + 31) / 32);
+
+  // isPhysRegModified also takes in the clobbers of the calls made here.
+  for (unsigned PReg = 1; PReg < NumRegs; ++PReg)
+    if (!MRI.isPhysRegModified(PReg))
+      Mask[PReg / 32] |= 1u << (PReg % 32);
+
+  TM.setRegUsage(F, std::move(Mask));
+  return false;
+}
+
+bool TriCoreRegUsagePropagate::runOnMachineFunction(MachineFunction &MF) {
+  bool Changed = false;
+  for (MachineBasicBlock &MBB : MF)
+    for (MachineInstr &MI : MBB) {
+      if (!MI.isCall() || !MI.getOperand(0).isGlobal())
+        continue;
+      const auto *Callee = dyn_cast<Function>(MI.getOperand(0).getGlobal());
+      const uint32_t *Mask = Callee ? TM.getRegUsage(Callee) : nullptr;
+      if (!Mask)
+        continue;
+
+      for (unsigned i = 0, e = MI.getNumOperands(); i != e; ++i) {
+        if (!MI.getOperand(i).isRegMask())
+          continue;
+        MI.RemoveOperand(i);
+        MI.addOperand(MF, MachineOperand::CreateRegMask(Mask));
+        ++NumCallsTightened;
+        Changed = true;
+        break;
+      }
+    }
+  return Changed;
+}
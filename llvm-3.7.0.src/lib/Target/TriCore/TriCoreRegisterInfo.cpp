@@ -16,6 +16,7 @@
 #include "TriCoreFrameLowering.h"
 #include "TriCoreInstrInfo.h"
 #include "TriCoreMachineFunctionInfo.h"
+#include "TriCoreSubtarget.h"
 #include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/CodeGen/MachineFrameInfo.h"
@@ -43,9 +44,14 @@ TriCoreRegisterInfo::TriCoreRegisterInfo() : TriCoreGenRegisterInfo(TriCore::A11
 
 const uint16_t *
 TriCoreRegisterInfo::getCalleeSavedRegs(const MachineFunction *MF) const {
-  static const uint16_t CalleeSavedRegs[] =
-  { 0 };
-  return CalleeSavedRegs;
+  // Interrupt handlers that do not save the lower context spill only the part
+  // of it they use. The allocator tries the free upper context first.
+  if (MF && TriCoreFrameLowering::isInterruptHandler(*MF) &&
+      !getFrameLowering(*MF)->savesLowerContext(*MF))
+    return CSR_Interrupt_SaveList;
+  if (MF && TriCoreFrameLowering::isFastCall(*MF))
+    return CSR_FastCC_A11_SaveList;
+  return CSR_TriCore_SaveList;
 }
 
 BitVector TriCoreRegisterInfo::getReservedRegs(const MachineFunction &MF) const {
@@ -57,11 +63,26 @@ BitVector TriCoreRegisterInfo::getReservedRegs(const MachineFunction &MF) const
   Reserved.set(TriCore::A11);
   Reserved.set(TriCore::PSW);
   Reserved.set(TriCore::FCX);
+  // The EABI keeps A0, A1, A8 and A9 as system-wide global address registers
+  // (small data base pointers), which compiled code must not overwrite.
+  Reserved.set(TriCore::A0);
+  Reserved.set(TriCore::A1);
+  Reserved.set(TriCore::A8);
+  Reserved.set(TriCore::A9);
+  if (getFrameLowering(MF)->hasFP(MF))
+    Reserved.set(TriCore::A14);
   return Reserved;
 }
 
 const uint32_t *TriCoreRegisterInfo::getCallPreservedMask(const MachineFunction &MF,
-                                                      CallingConv::ID) const {
+                                                      CallingConv::ID CC) const {
+  // JL leaves the return address in A11, FCALL keeps the caller's on the
+  // stack.
+  if (CC == CallingConv::Fast) {
+    if (MF.getSubtarget<TriCoreSubtarget>().hasFCall())
+      return CSR_FastCC_A11_RegMask;
+    return CSR_FastCC_RegMask;
+  }
   return CC_Save_RegMask;
 }
 
@@ -70,13 +91,18 @@ TriCoreRegisterInfo::requiresRegisterScavenging(const MachineFunction &MF) const
   return true;
 }
 
+bool
+TriCoreRegisterInfo::requiresFrameIndexScavenging(const MachineFunction &MF) const {
+  return true;
+}
+
 bool
 TriCoreRegisterInfo::trackLivenessAfterRegAlloc(const MachineFunction &MF) const {
   return true;
 }
 
 bool TriCoreRegisterInfo::useFPForScavengingIndex(const MachineFunction &MF) const {
-  return false;
+  return true;
 }
 
 //const TargetRegisterClass *
@@ -86,60 +112,85 @@ bool TriCoreRegisterInfo::useFPForScavengingIndex(const MachineFunction &MF) con
 //}
 
 
+// Only the BOL forms take a 16-bit displacement, everything else addressing
+// memory through memsrc is BO with a 10-bit one.
+static bool hasLongOffset(unsigned Opcode) {
+	switch (Opcode) {
+	case TriCore::LDWbo:
+	case TriCore::LDWbo_f:
+	case TriCore::LEAbol:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void TriCoreRegisterInfo::eliminateFrameIndex(MachineBasicBlock::iterator II,
 		int SPAdj, unsigned FIOperandNum, RegScavenger *RS) const {
 	MachineInstr &MI = *II;
-	const MachineFunction &MF = *MI.getParent()->getParent();
+	MachineFunction &MF = *MI.getParent()->getParent();
 	DebugLoc dl = MI.getDebugLoc();
 	MachineBasicBlock &MBB = *MI.getParent();
 	const MachineFrameInfo *MFI = MF.getFrameInfo();
-	MachineOperand &FIOp = MI.getOperand(FIOperandNum);
-	unsigned FI = FIOp.getIndex();
+	const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
 	const TargetFrameLowering *TFI = MF.getSubtarget().getFrameLowering();
-	unsigned BasePtr = (TFI->hasFP(MF) ? TriCore::A14 : TriCore::A10);
-	// Determine if we can eliminate the index from this kind of instruction.
-	unsigned ImmOpIdx = 0;
-	//MI.dump();
+	int FI = MI.getOperand(FIOperandNum).getIndex();
+	unsigned BasePtr = getFrameRegister(MF);
 
-	if (MI.getOpcode() == TriCore::ADDrc) {
-		//MF.dump();
-		int Offset = MFI->getObjectOffset(FI);
-		//Offset += MF.getFrameInfo()->getStackSize();
-		//Offset += MI.getOperand(FIOperandNum + 1).getImm();
-		Offset = -Offset;
-//		outs().changeColor(raw_ostream::GREEN, 1) << "Offset: " << Offset << "\n";
-//		outs().changeColor(raw_ostream::WHITE, 0);
-		const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
-		MI.setDesc(TII.get(TriCore::MOVDrr));
-		MI.getOperand(FIOperandNum).ChangeToRegister(BasePtr, false);
+	// Object offsets are relative to the incoming stack pointer, which is
+	// where the frame pointer points. Without one, rebase onto A10.
+	int64_t Offset = MFI->getObjectOffset(FI) +
+	                 MI.getOperand(FIOperandNum + 1).getImm();
+	if (!TFI->hasFP(MF))
+		Offset += MFI->getStackSize() + SPAdj;
 
-		if (Offset == 0)
-			return;
+	int64_t Lo = SignExtend64<16>(Offset);
+	int64_t Hi = ((Offset - Lo) >> 16) & 0xffff;
 
-		// We need to materialize the offset via add instruction.
+	if (MI.getOpcode() == TriCore::ADDrc) {
+		// The address of a stack object is wanted in a data register. Copy the
+		// base and add the offset with ADD, ADDI or ADDIH + ADDI.
 		unsigned DstReg = MI.getOperand(0).getReg();
-		if (Offset < 0) {
-			BuildMI(MBB, std::next(II), dl, TII.get(TriCore::ADDrc), DstReg).addReg(
-					DstReg).addImm(Offset);
-		} else
-			BuildMI(MBB, std::next(II), dl, TII.get(TriCore::ADDrc), DstReg).addReg(
-					DstReg).addImm(-Offset);
+		MachineBasicBlock::iterator Next = std::next(II);
+		MI.setDesc(TII.get(TriCore::MOVDrr));
+		MI.getOperand(FIOperandNum).ChangeToRegister(BasePtr, false);
+		MI.RemoveOperand(FIOperandNum + 1);
+
+		if (Hi)
+			BuildMI(MBB, Next, dl, TII.get(TriCore::ADDIHrlc), DstReg)
+					.addReg(DstReg).addImm(Hi);
+		if (Lo && isInt<9>(Lo))
+			BuildMI(MBB, Next, dl, TII.get(TriCore::ADDrc), DstReg)
+					.addReg(DstReg).addImm(Lo);
+		else if (Lo)
+			BuildMI(MBB, Next, dl, TII.get(TriCore::ADDIrlc), DstReg)
+					.addReg(DstReg).addImm(Lo);
+		return;
+	}
 
+	unsigned OffsetBits = hasLongOffset(MI.getOpcode()) ? 16 : 10;
+	if (isIntN(OffsetBits, Offset)) {
+		MI.getOperand(FIOperandNum).ChangeToRegister(BasePtr, false);
+		MI.getOperand(FIOperandNum + 1).ChangeToImmediate(Offset);
 		return;
 	}
 
-	//outs() << "FIOperandNum: " << FIOperandNum <<"\n";
-	ImmOpIdx = FIOperandNum + 1;
-
-	// FIXME: check the size of offset.
-	MachineOperand &ImmOp = MI.getOperand(ImmOpIdx);
-//  outs() << "getObjectOffset: " << MFI->getObjectOffset(FI) << "\n";
-//  outs() << "getStackSize: " << MFI->getStackSize() << "\n";
-//  outs() << "ImmOp.getImm(): " << ImmOp.getImm() << "\n";
-	int Offset = MFI->getObjectOffset(FI);
-	//int Offset = MFI->getObjectOffset(FI) + MFI->getStackSize() + ImmOp.getImm();
-	FIOp.ChangeToRegister(BasePtr, false);
-	ImmOp.setImm(Offset);
+	// The displacement does not fit. Form the address in a virtual address
+	// register, which the scavenger replaces once frame indices are gone.
+	MachineRegisterInfo &MRI = MF.getRegInfo();
+	const TargetRegisterClass *RC = &TriCore::AddrRegsRegClass;
+	unsigned SrcReg = BasePtr;
+	if (Hi) {
+		unsigned HiReg = MRI.createVirtualRegister(RC);
+		BuildMI(MBB, II, dl, TII.get(TriCore::ADDIHArlc), HiReg)
+				.addReg(BasePtr).addImm(Hi);
+		SrcReg = HiReg;
+	}
+	unsigned AddrReg = MRI.createVirtualRegister(RC);
+	BuildMI(MBB, II, dl, TII.get(TriCore::LEAbol), AddrReg)
+			.addReg(SrcReg, getKillRegState(SrcReg != BasePtr)).addImm(Lo);
+	MI.getOperand(FIOperandNum).ChangeToRegister(AddrReg, false, false, true);
+	MI.getOperand(FIOperandNum + 1).ChangeToImmediate(0);
 }
 
 
@@ -38,6 +38,8 @@ public:
 
   bool requiresRegisterScavenging(const MachineFunction &MF) const override;
 
+  bool requiresFrameIndexScavenging(const MachineFunction &MF) const override;
+
   bool trackLivenessAfterRegAlloc(const MachineFunction &MF) const override;
 
   bool useFPForScavengingIndex(const MachineFunction &MF) const override;
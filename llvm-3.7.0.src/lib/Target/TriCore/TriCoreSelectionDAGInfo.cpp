@@ -12,8 +12,69 @@
 //===----------------------------------------------------------------------===//
 
 #include "TriCoreSelectionDAGInfo.h"
+#include "llvm/CodeGen/SelectionDAG.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/Target/TargetLowering.h"
 using namespace llvm;
 
 #define DEBUG_TYPE "tricore-selectiondag-info"
 
 TriCoreSelectionDAGInfo::~TriCoreSelectionDAGInfo() {}
+
+/// emitMemLibCall - Call \p LC with \p Dst and the second operand \p Src
+/// typed as \p SrcTy. Dst is always a pointer and Size an integer.
+static SDValue emitMemLibCall(SelectionDAG &DAG, SDLoc dl, SDValue Chain,
+                              RTLIB::Libcall LC, SDValue Dst, SDValue Src,
+                              Type *SrcTy, SDValue Size) {
+  const TargetLowering &TLI = DAG.getTargetLoweringInfo();
+  LLVMContext &C = *DAG.getContext();
+  Type *PtrTy = Type::getInt8PtrTy(C);
+
+  TargetLowering::ArgListTy Args;
+  TargetLowering::ArgListEntry Entry;
+  Entry.Node = Dst; Entry.Ty = PtrTy;
+  Args.push_back(Entry);
+  Entry.Node = Src; Entry.Ty = SrcTy;
+  Args.push_back(Entry);
+  Entry.Node = Size; Entry.Ty = DAG.getDataLayout().getIntPtrType(C);
+  Args.push_back(Entry);
+
+  TargetLowering::CallLoweringInfo CLI(DAG);
+  CLI.setDebugLoc(dl)
+      .setChain(Chain)
+      .setCallee(TLI.getLibcallCallingConv(LC), Type::getVoidTy(C),
+                 DAG.getExternalSymbol(TLI.getLibcallName(LC),
+                                       TLI.getPointerTy(DAG.getDataLayout())),
+                 std::move(Args), 0)
+      .setDiscardResult();
+
+  return TLI.LowerCallTo(CLI).second;
+}
+
+SDValue TriCoreSelectionDAGInfo::EmitTargetCodeForMemcpy(
+    SelectionDAG &DAG, SDLoc dl, SDValue Chain, SDValue Dst, SDValue Src,
+    SDValue Size, unsigned Align, bool isVolatile, bool AlwaysInline,
+    MachinePointerInfo DstPtrInfo, MachinePointerInfo SrcPtrInfo) const {
+  // Leave an inline expansion to the generic loads and stores.
+  if (AlwaysInline)
+    return SDValue();
+  return emitMemLibCall(DAG, dl, Chain, RTLIB::MEMCPY, Dst, Src,
+                        Type::getInt8PtrTy(*DAG.getContext()), Size);
+}
+
+SDValue TriCoreSelectionDAGInfo::EmitTargetCodeForMemmove(
+    SelectionDAG &DAG, SDLoc dl, SDValue Chain, SDValue Dst, SDValue Src,
+    SDValue Size, unsigned Align, bool isVolatile,
+    MachinePointerInfo DstPtrInfo, MachinePointerInfo SrcPtrInfo) const {
+  return emitMemLibCall(DAG, dl, Chain, RTLIB::MEMMOVE, Dst, Src,
+                        Type::getInt8PtrTy(*DAG.getContext()), Size);
+}
+
+SDValue TriCoreSelectionDAGInfo::EmitTargetCodeForMemset(
+    SelectionDAG &DAG, SDLoc dl, SDValue Chain, SDValue Dst, SDValue Src,
+    SDValue Size, unsigned Align, bool isVolatile,
+    MachinePointerInfo DstPtrInfo) const {
+  return emitMemLibCall(DAG, dl, Chain, RTLIB::MEMSET, Dst, Src,
+                        Src.getValueType().getTypeForEVT(*DAG.getContext()),
+                        Size);
+}
@@ -21,6 +21,27 @@ namespace llvm {
 class TriCoreSelectionDAGInfo : public TargetSelectionDAGInfo {
 public:
   ~TriCoreSelectionDAGInfo();
+
+  // The generic libcalls pass the pointer operands as integers, which the
+  // EABI would put in data registers. Emit the calls with pointer types so
+  // that they travel in address registers instead.
+  SDValue EmitTargetCodeForMemcpy(SelectionDAG &DAG, SDLoc dl, SDValue Chain,
+                                  SDValue Dst, SDValue Src, SDValue Size,
+                                  unsigned Align, bool isVolatile,
+                                  bool AlwaysInline,
+                                  MachinePointerInfo DstPtrInfo,
+                                  MachinePointerInfo SrcPtrInfo) const override;
+
+  SDValue EmitTargetCodeForMemmove(SelectionDAG &DAG, SDLoc dl, SDValue Chain,
+                                   SDValue Dst, SDValue Src, SDValue Size,
+                                   unsigned Align, bool isVolatile,
+                                   MachinePointerInfo DstPtrInfo,
+                                   MachinePointerInfo SrcPtrInfo) const override;
+
+  SDValue EmitTargetCodeForMemset(SelectionDAG &DAG, SDLoc dl, SDValue Chain,
+                                  SDValue Dst, SDValue Src, SDValue Size,
+                                  unsigned Align, bool isVolatile,
+                                  MachinePointerInfo DstPtrInfo) const override;
 };
 }
 
@@ -32,10 +32,21 @@ static cl::opt<bool> UseSmallSectionOpt
 
 TriCoreSubtarget::TriCoreSubtarget(const Triple &TT, StringRef CPU, StringRef FS,
                            TriCoreTargetMachine &TM)
-    : TriCoreGenSubtargetInfo(TT, CPU, FS),
+    : TriCoreGenSubtargetInfo(TT, CPU, FS), TriCoreProcFamily(Others),
+      HasFPU(false), HasDIV(false),
+      HasCRC32(false), HasCmpSwap(false), HasPOPCNT(false), HasFCall(false),
+      HasTC16(false), HasTC162(false),
       DL("e-m:e-p:32:32-i64:32-a:0:32-n32"),
-      InstrInfo(), TLInfo(TM), TSInfo(), FrameLowering() {
+      InstrInfo(), TLInfo(TM, initializeSubtargetDependencies(CPU, FS)),
+      TSInfo(), FrameLowering() {
 
 	 UseSmallSection = UseSmallSectionOpt;
 
 }
+
+TriCoreSubtarget &
+TriCoreSubtarget::initializeSubtargetDependencies(StringRef CPU, StringRef FS) {
+  std::string CPUName = CPU.empty() ? "generic" : CPU;
+  ParseSubtargetFeatures(CPUName, FS);
+  return *this;
+}
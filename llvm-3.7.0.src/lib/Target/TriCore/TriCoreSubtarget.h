@@ -33,7 +33,39 @@ class StringRef;
 class TriCoreSubtarget : public TriCoreGenSubtargetInfo {
   virtual void anchor();
 
+public:
+  enum TriCoreProcFamilyEnum {
+    Others, TC13, TC16E, TC16P, TC18
+  };
+
 private:
+  // TriCoreProcFamily - The core the code is tuned for.
+  TriCoreProcFamilyEnum TriCoreProcFamily;
+
+  // HasFPU - Single precision floating point instructions.
+  bool HasFPU;
+
+  // HasDIV - DIV and DIV.U, added in TriCore 1.6.
+  bool HasDIV;
+
+  // HasCRC32 - The CRC32 instruction, added in TriCore 1.6.
+  bool HasCRC32;
+
+  // HasCmpSwap - CMPSWAP.W and SWAPMSK.W.
+  bool HasCmpSwap;
+
+  // HasPOPCNT - POPCNT.W.
+  bool HasPOPCNT;
+
+  // HasFCall - FCALL and FRET, which save only the return address.
+  bool HasFCall;
+
+  // HasTC16 - TriCore 1.6 instruction set.
+  bool HasTC16;
+
+  // HasTC162 - SHUFFLE and the other TriCore 1.6.2 additions.
+  bool HasTC162;
+
   const DataLayout DL;       // Calculates type size & alignment.
   TriCoreInstrInfo InstrInfo;
   TriCoreTargetLowering TLInfo;
@@ -71,6 +103,23 @@ public:
   }
 
   bool useSmallSection() const { return UseSmallSection; }
+  TriCoreProcFamilyEnum getProcFamily() const { return TriCoreProcFamily; }
+  bool hasFPU() const { return HasFPU; }
+  bool hasDIV() const { return HasDIV; }
+  bool hasCRC32() const { return HasCRC32; }
+  bool hasCmpSwap() const { return HasCmpSwap; }
+  bool hasPOPCNT() const { return HasPOPCNT; }
+  bool hasFCall() const { return HasFCall; }
+  bool hasTC16() const { return HasTC16; }
+  bool hasTC162() const { return HasTC162; }
+
+  /// enableMachineScheduler - Schedule with the model of the selected core.
+  bool enableMachineScheduler() const override { return true; }
+
+  /// initializeSubtargetDependencies - Parse the feature string before the
+  /// lowering objects that depend on it are built.
+  TriCoreSubtarget &initializeSubtargetDependencies(StringRef CPU,
+                                                    StringRef FS);
 
   /// ParseSubtargetFeatures - Parses features string setting specified
   /// subtarget options.  Definition of function is auto generated by tblgen.
@@ -16,14 +16,24 @@
 #include "TriCoreInstrInfo.h"
 #include "TriCoreISelLowering.h"
 #include "TriCoreSelectionDAGInfo.h"
+#include "TriCoreTargetObjectFile.h"
+#include "TriCoreTargetTransformInfo.h"
 #include "llvm/CodeGen/Passes.h"
 #include "llvm/CodeGen/TargetLoweringObjectFileImpl.h"
+#include "llvm/IR/Attributes.h"
+#include "llvm/IR/Function.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/TargetRegistry.h"
 
 using namespace llvm;
 
+static cl::opt<bool>
+EnableRegUsage("tricore-ipra", cl::Hidden, cl::init(true),
+               cl::desc("Give calls the clobbers of their callee rather than "
+                        "of the calling convention"));
+
 /*
 *  @brief This function calculates the data layout of TriCore architecture.
 */
@@ -59,22 +69,60 @@ TriCoreTargetMachine::TriCoreTargetMachine(const Target &T, const Triple &TT,
       TT, CPU, FS,
       Options, RM, CM, OL),
       Subtarget(TT, CPU, FS, *this),
-      TLOF(make_unique<TargetLoweringObjectFileELF>()) {
+      TLOF(make_unique<TriCoreTargetObjectFile>()) {
   initAsmInfo();
 }
 
+/// getSubtargetImpl - Functions may pick their own core through the
+/// target-cpu and target-features attributes, so that each core of a
+/// multicore part gets its own features and tuning.
+const TriCoreSubtarget *
+TriCoreTargetMachine::getSubtargetImpl(const Function &F) const {
+  Attribute CPUAttr = F.getFnAttribute("target-cpu");
+  Attribute FSAttr = F.getFnAttribute("target-features");
+
+  std::string CPU = !CPUAttr.hasAttribute(Attribute::None)
+                        ? CPUAttr.getValueAsString().str()
+                        : TargetCPU;
+  std::string FS = !FSAttr.hasAttribute(Attribute::None)
+                       ? FSAttr.getValueAsString().str()
+                       : TargetFS;
+  if (CPU == TargetCPU && FS == TargetFS)
+    return &Subtarget;
+
+  auto &I = SubtargetMap[CPU + FS];
+  if (!I) {
+    resetTargetOptions(F);
+    auto &TM = const_cast<TriCoreTargetMachine &>(*this);
+    I = llvm::make_unique<TriCoreSubtarget>(TargetTriple, CPU, FS, TM);
+  }
+  return I.get();
+}
+
+TargetIRAnalysis TriCoreTargetMachine::getTargetIRAnalysis() {
+  return TargetIRAnalysis([this](Function &F) {
+    return TargetTransformInfo(TriCoreTTIImpl(this, F));
+  });
+}
+
 namespace {
 /// TriCore Code Generator Pass Configuration Options.
 class TriCorePassConfig : public TargetPassConfig {
 public:
   TriCorePassConfig(TriCoreTargetMachine *TM, legacy::PassManagerBase &PM)
-      : TargetPassConfig(TM, PM) {}
+      : TargetPassConfig(TM, PM) {
+    // The prologue only moves the stack pointer, so it can be sunk to the
+    // blocks that actually touch the frame.
+    EnableShrinkWrap = true;
+  }
 
   TriCoreTargetMachine &getTriCoreTargetMachine() const {
     return getTM<TriCoreTargetMachine>();
   }
 
+  virtual void addIRPasses() override;
   virtual bool addPreISel() override;
+  virtual void addPreRegAlloc() override;
   virtual bool addInstSelector() override;
   virtual void addPreEmitPass() override;
 };
@@ -84,14 +132,43 @@ TargetPassConfig *TriCoreTargetMachine::createPassConfig(legacy::PassManagerBase
   return new TriCorePassConfig(this, PM);
 }
 
-bool TriCorePassConfig::addPreISel() { return false; }
+void TriCorePassConfig::addIRPasses() {
+  addPass(createAtomicExpandPass(&getTriCoreTargetMachine()));
+  // Also runs at -O0, where it only takes fastcc away again.
+  addPass(createTriCoreFastCallPass(getOptLevel()));
+  // Needs to know which calls ended up as JL/FCALL.
+  addPass(createTriCoreCSADepthPass());
+  TargetPassConfig::addIRPasses();
+}
+
+bool TriCorePassConfig::addPreISel() {
+  // Compile callees before their callers, for the register usage passes.
+  // Nothing after this point may be a module pass.
+  if (EnableRegUsage && getOptLevel() != CodeGenOpt::None)
+    addPass(createTriCoreCallGraphOrderPass());
+  return false;
+}
 
 bool TriCorePassConfig::addInstSelector() {
   addPass(createTriCoreISelDag(getTriCoreTargetMachine(), getOptLevel()));
   return false;
 }
 
-void TriCorePassConfig::addPreEmitPass() {}
+void TriCorePassConfig::addPreRegAlloc() {
+  if (EnableRegUsage && getOptLevel() != CodeGenOpt::None)
+    addPass(createTriCoreRegUsagePropagatePass(getTriCoreTargetMachine()));
+}
+
+void TriCorePassConfig::addPreEmitPass() {
+  if (getOptLevel() != CodeGenOpt::None)
+    addPass(createTriCoreLoopLatchPass());
+  // Needed at every level, the short branch forms picked by instruction
+  // selection cannot reach backwards.
+  addPass(createTriCoreBranchRelaxPass());
+  // Last, nothing may touch a register after its usage has been recorded.
+  if (EnableRegUsage && getOptLevel() != CodeGenOpt::None)
+    addPass(createTriCoreRegUsageCollectorPass(getTriCoreTargetMachine()));
+}
 
 // Force static initialization.
 extern "C" void LLVMInitializeTriCoreTarget() {
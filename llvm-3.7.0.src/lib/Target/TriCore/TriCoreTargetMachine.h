@@ -20,6 +20,8 @@
 #include "TriCoreInstrInfo.h"
 #include "TriCoreSelectionDAGInfo.h"
 #include "TriCoreSubtarget.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/Target/TargetMachine.h"
 
@@ -32,6 +34,11 @@ namespace llvm {
 class TriCoreTargetMachine : public LLVMTargetMachine {
   TriCoreSubtarget Subtarget;
   std::unique_ptr<TargetLoweringObjectFile> TLOF;
+  // Subtargets of functions with their own target-cpu/target-features.
+  mutable StringMap<std::unique_ptr<TriCoreSubtarget>> SubtargetMap;
+  // Registers left intact by the functions compiled so far, see
+  // TriCoreRegUsage.cpp.
+  DenseMap<const Function *, std::vector<uint32_t>> RegUsage;
 
 public:
   TriCoreTargetMachine(const Target &T, const Triple &TT, StringRef CPU,
@@ -42,10 +49,20 @@ public:
     return &Subtarget;
   }
   
-  virtual const TargetSubtargetInfo *
-  getSubtargetImpl(const Function &) const override {
-    return &Subtarget;
+  const TriCoreSubtarget *getSubtargetImpl(const Function &F) const override;
+
+  /// getRegUsage - The regmask of the registers a call to F preserves, or
+  /// null if F has not been compiled yet.
+  const uint32_t *getRegUsage(const Function *F) const {
+    auto I = RegUsage.find(F);
+    return I != RegUsage.end() ? I->second.data() : nullptr;
   }
+  void setRegUsage(const Function *F, std::vector<uint32_t> Mask) {
+    RegUsage[F] = std::move(Mask);
+  }
+  void clearRegUsage() { RegUsage.clear(); }
+
+  TargetIRAnalysis getTargetIRAnalysis() override;
 
   /// Pass Pipeline Configuration
   virtual TargetPassConfig *createPassConfig(legacy::PassManagerBase &PM) override;
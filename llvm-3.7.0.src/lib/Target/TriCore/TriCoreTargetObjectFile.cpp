@@ -104,3 +104,10 @@ TriCoreTargetObjectFile::SelectSectionForGlobal(const GlobalValue *GV,
   // Otherwise, we work the same as ELF.
   return TargetLoweringObjectFileELF::SelectSectionForGlobal(GV, Kind, Mang,TM);
 }
+
+MCSection *
+TriCoreTargetObjectFile::getInterruptVectorSection(unsigned Priority) const {
+  return getContext().getELFSection((".inttab.intvec." + Twine(Priority)).str(),
+                                    ELF::SHT_PROGBITS,
+                                    ELF::SHF_ALLOC | ELF::SHF_EXECINSTR);
+}
@@ -39,6 +39,11 @@ class TriCoreTargetMachine;
     MCSection *SelectSectionForGlobal(const GlobalValue *GV, SectionKind Kind,
                                       Mangler &Mang,
                                       const TargetMachine &TM) const override;
+
+    /// getInterruptVectorSection - The section holding the interrupt vector
+    /// entry of the given priority, which the linker places at BIV plus
+    /// 32 times the priority.
+    MCSection *getInterruptVectorSection(unsigned Priority) const;
   };
 } // end namespace llvm
 
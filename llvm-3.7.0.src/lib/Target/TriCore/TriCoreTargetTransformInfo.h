@@ -0,0 +1,66 @@
+//===-- TriCoreTargetTransformInfo.h - TriCore specific TTI -----*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+/// \file
+/// This file implements a TargetTransformInfo::Concept conforming object
+/// specific to the TriCore target machine. It charges calls for the context
+/// save and restore of CALL and RET, and leaves the rest to the target
+/// independent and default TTI implementations.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_LIB_TARGET_TRICORE_TRICORETARGETTRANSFORMINFO_H
+#define LLVM_LIB_TARGET_TRICORE_TRICORETARGETTRANSFORMINFO_H
+
+#include "TriCore.h"
+#include "TriCoreTargetMachine.h"
+#include "llvm/Analysis/TargetTransformInfo.h"
+#include "llvm/CodeGen/BasicTTIImpl.h"
+#include "llvm/Target/TargetLowering.h"
+
+namespace llvm {
+
+class TriCoreTTIImpl : public BasicTTIImplBase<TriCoreTTIImpl> {
+  typedef BasicTTIImplBase<TriCoreTTIImpl> BaseT;
+  typedef TargetTransformInfo TTI;
+  friend BaseT;
+
+  const TriCoreSubtarget *ST;
+  const TriCoreTargetLowering *TLI;
+
+  const TriCoreSubtarget *getST() const { return ST; }
+  const TriCoreTargetLowering *getTLI() const { return TLI; }
+
+public:
+  explicit TriCoreTTIImpl(const TriCoreTargetMachine *TM, Function &F)
+      : BaseT(TM, F.getParent()->getDataLayout()),
+        ST(TM->getSubtargetImpl(F)), TLI(ST->getTargetLowering()) {}
+
+  // Provide value semantics. MSVC requires that we spell all of these out.
+  TriCoreTTIImpl(const TriCoreTTIImpl &Arg)
+      : BaseT(static_cast<const BaseT &>(Arg)), ST(Arg.ST), TLI(Arg.TLI) {}
+  TriCoreTTIImpl(TriCoreTTIImpl &&Arg)
+      : BaseT(std::move(static_cast<BaseT &>(Arg))), ST(std::move(Arg.ST)),
+        TLI(std::move(Arg.TLI)) {}
+
+  using BaseT::getCallCost;
+
+  /// CALL stores the 16 words of the upper context to a CSA and RET loads
+  /// them back, which takes a few cycles more than any plain instruction.
+  unsigned getCallCost(FunctionType *FTy, int NumArgs) {
+    return BaseT::getCallCost(FTy, NumArgs) + TTI::TCC_Expensive;
+  }
+
+  /// The CSA traffic of a CALL/RET pair is worth about eight instructions of
+  /// inlined code, and inlining also keeps a CSA frame off the free list.
+  unsigned getInlineCallOverhead() { return 8; }
+};
+
+} // end namespace llvm
+
+#endif
@@ -393,7 +393,8 @@ static std::error_code getRelocationValueString(const ELFObjectFile<ELFT> *Obj,
       res = "Unknown";
     }
     break;
-  case ELF::EM_AARCH64: {
+  case ELF::EM_AARCH64:
+  case ELF::EM_TRICORE: {
     std::string fmtbuf;
     raw_string_ostream fmt(fmtbuf);
     fmt << Target;
@@ -0,0 +1,2134 @@
+//===-- llvm-tricore-sim.cpp - TriCore instruction set simulator ----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This program runs TriCore object files from llc -filetype=obj without
+// hardware. The inputs are linked into one flat image, each instruction is
+// decoded by the TriCore MC disassembler and executed on a model of the
+// architectural state, and at exit the run is summarised: dynamic instruction
+// counts, a cycle estimate per function and the memory traffic, that of the
+// context save area (CSA) included.
+//
+// The cycle estimate comes from the machine model of the processor picked with
+// -mcpu. Up to IssueWidth instructions issue in order each cycle, the result of
+// a load is ready after LoadLatency cycles and that of a divide after
+// HighLatency, a taken branch ends the issue group and a conditional branch
+// that goes against static backward-taken prediction costs MispredictPenalty.
+// CALL, RET and the other context operations add the time the CSA transfer
+// takes.
+//
+// Functions the inputs do not define are given a stub; calls to the common C
+// library and compiler runtime routines are carried out by the host.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/ADT/Triple.h"
+#include "llvm/MC/MCAsmBackend.h"
+#include "llvm/MC/MCAsmInfo.h"
+#include "llvm/MC/MCContext.h"
+#include "llvm/MC/MCDisassembler.h"
+#include "llvm/MC/MCFixup.h"
+#include "llvm/MC/MCFixupKindInfo.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCInstPrinter.h"
+#include "llvm/MC/MCInstrInfo.h"
+#include "llvm/MC/MCObjectFileInfo.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/MCSubtargetInfo.h"
+#include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/ELF.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Signals.h"
+#include "llvm/Support/TargetRegistry.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+using namespace llvm;
+using namespace object;
+
+extern "C" void LLVMInitializeTriCoreTargetInfo();
+extern "C" void LLVMInitializeTriCoreTargetMC();
+extern "C" void LLVMInitializeTriCoreDisassembler();
+
+static cl::list<std::string>
+InputFilenames(cl::Positional, cl::desc("<input object files>"),
+               cl::OneOrMore);
+
+static cl::opt<std::string>
+EntryName("entry", cl::desc("Function to run (default = main)"),
+          cl::value_desc("symbol"), cl::init("main"));
+
+static cl::list<int>
+EntryArgs("arg", cl::desc("Integer argument of the entry function, in order"),
+          cl::value_desc("value"), cl::ZeroOrMore);
+
+static cl::opt<std::string>
+MCPU("mcpu", cl::desc("Processor whose scheduling model times the run"),
+     cl::value_desc("cpu-name"), cl::init(""));
+
+static cl::opt<unsigned>
+MaxInsts("max-insts",
+         cl::desc("Give up after this many instructions (default = 1e9)"),
+         cl::init(1000000000));
+
+static cl::opt<unsigned>
+StackSize("stack-size", cl::desc("Bytes of stack (default = 65536)"),
+          cl::init(65536));
+
+static cl::opt<unsigned>
+HeapSize("heap-size", cl::desc("Bytes of heap for malloc (default = 1MB)"),
+         cl::init(1 << 20));
+
+// The default matches the pool TriCoreCSADepth checks the call graph against.
+static cl::opt<unsigned>
+CSAFrames("csa-frames",
+          cl::desc("Context save areas on the free list (default = 64)"),
+          cl::init(64));
+
+static cl::opt<bool>
+Trace("trace", cl::desc("Print every instruction as it executes"));
+
+static cl::opt<bool>
+OpcodeCounts("opcode-counts",
+             cl::desc("Print how often each opcode was executed"));
+
+static StringRef ToolName;
+
+static bool error(const Twine &Message) {
+  errs() << ToolName << ": " << Message << "\n";
+  return false;
+}
+
+static std::string hex(uint32_t Value) {
+  return "0x" + utohexstr(Value, /*LowerCase=*/true);
+}
+
+// Where the image, the heap and the CSA with the stack live. The CSA has to sit
+// in a segment a link word can name; the data scratch-pad is where it is on
+// the real parts.
+static const uint32_t ImageBase = 0x80000000;
+static const uint32_t HeapBase = 0x90000000;
+static const uint32_t DSPRBase = 0xD0000000;
+
+// A CALL or RET moves the 16 words of the upper context. The TTI takes a
+// CALL/RET pair to be worth about eight instructions, so each half is charged
+// four cycles.
+static const unsigned ContextCycles = 4;
+
+namespace {
+
+// The register file: D0-D15, A0-A15 and PSW. Extended registers are the slot
+// of their even half and the next one, F registers share the D slots.
+enum : uint8_t {
+  SlotD0 = 0,
+  SlotD15 = 15,
+  SlotA0 = 16,
+  SlotA2 = 18,
+  SlotA4 = 20,
+  SlotA10 = 26,
+  SlotA11 = 27,
+  SlotPSW = 32,
+  SlotOther = 33,
+  NumSlots = 34
+};
+
+static const uint32_t PSW_C = 1u << 31;
+static const uint32_t PSW_V = 1u << 30;
+static const uint32_t PSW_SV = 1u << 29;
+static const uint32_t PSW_AV = 1u << 28;
+static const uint32_t PSW_SAV = 1u << 27;
+
+// PCXI and FCX hold a CSA link in their low 20 bits, PCXI.UL tells an upper
+// context from a lower one.
+static const uint32_t LinkMask = 0xFFFFF;
+static const uint32_t PCXI_UL = 1u << 20;
+
+// The words of a context after the PCXI link, in CSA order.
+static const uint8_t UpperContext[15] = {
+  SlotPSW, SlotA10, SlotA11, SlotD0 + 8, SlotD0 + 9, SlotD0 + 10, SlotD0 + 11,
+  SlotA0 + 12, SlotA0 + 13, SlotA0 + 14, SlotA0 + 15,
+  SlotD0 + 12, SlotD0 + 13, SlotD0 + 14, SlotD15 };
+
+static const uint8_t LowerContext[15] = {
+  SlotA11, SlotA2, SlotA2 + 1, SlotD0, SlotD0 + 1, SlotD0 + 2, SlotD0 + 3,
+  SlotA4, SlotA4 + 1, SlotA4 + 2, SlotA4 + 3,
+  SlotD0 + 4, SlotD0 + 5, SlotD0 + 6, SlotD0 + 7 };
+
+/// What an instruction does. The kinds up to K_LastALU compute their result
+/// from the operands after the first and write it to the first.
+enum OpKind : uint8_t {
+  K_Unknown,
+  K_Add, K_AddA, K_AddX, K_AddC, K_AddS, K_AddSU, K_AddHi,
+  K_Sub, K_SubA, K_SubX, K_SubC, K_SubS, K_SubSU, K_RSub,
+  K_Mul, K_Mul64, K_MulU64, K_MulQ, K_MulRQ, K_Div, K_DivU,
+  K_And, K_Or, K_Xor, K_Nand, K_Nor, K_Xnor, K_AndN, K_OrN, K_Not,
+  K_Abs, K_AbsDif, K_Min, K_Max, K_MinU, K_MaxU, K_Cmp,
+  K_Sh, K_Sha, K_Clz, K_Clo, K_Cls, K_Popcnt, K_Sat,
+  K_Mov, K_MovHi, K_Lea, K_Shuffle, K_Crc32, K_AddF,
+  K_LastALU = K_AddF,
+
+  K_AccCmp, K_MAddQ, K_Extr, K_Dextr, K_Imask, K_BitOp, K_Mfcr, K_SubSP,
+  K_Load, K_Store, K_StoreBit, K_Swap, K_CmpSwap, K_SwapMsk, K_Ldmst,
+  K_J, K_JZ, K_JZT, K_JCmp, K_JNED, K_JNEI, K_JI, K_JIRet, K_JL, K_JLI,
+  K_Call, K_CallI, K_FCall, K_FCallI, K_Ret, K_FRet,
+  K_Svlcx, K_Rslcx, K_Bisr, K_Nop
+};
+
+enum Cond : uint8_t { C_EQ, C_NE, C_LT, C_LTU, C_GE, C_GEU };
+
+// The accumulation of AND.EQ, OR.EQ, XOR.EQ and SH.EQ and their relatives,
+// in the high half of Aux.
+enum : uint8_t { Acc_And, Acc_Or, Acc_Xor, Acc_Sh };
+
+// Bit operations, MADD.Q/MSUB.Q variants and SAT widths in Aux.
+enum : uint8_t { Bit_And, Bit_Or, Bit_Xor, Bit_Ins, Bit_InsN };
+enum : uint8_t { Q_Sub = 1, Q_Sat = 2, Q_Round = 4 };
+enum : uint8_t { Sat_B, Sat_BU, Sat_H, Sat_HU };
+
+// Addressing modes of a load or store, in Aux above the access size and the
+// signed flag.
+enum : uint8_t { M_Offset, M_Post, M_Pre };
+
+struct OpInfo {
+  OpKind Kind;
+  uint8_t Aux;
+  // The width of the immediate field the decoder leaves as raw bits, negative
+  // if it is sign extended; 0 if the operand is used as it is.
+  int8_t Imm;
+};
+
+/// A decoded instruction together with the registers the timing model tracks.
+struct Decoded {
+  MCInst Inst;
+  OpInfo Info;
+  uint8_t Size;
+  uint8_t DataDefs; // Slots in Defs written by the first operand.
+  SmallVector<uint8_t, 4> Uses, Defs;
+};
+
+/// A function of the image and what the run spent in it.
+struct Function {
+  std::string Name;
+  uint32_t Start, End;
+  bool Host;
+  uint64_t Calls, Insts, Cycles, LoadBytes, StoreBytes;
+
+  Function(StringRef Name, uint32_t Start, uint32_t End, bool Host)
+      : Name(Name), Start(Start), End(End), Host(Host), Calls(0), Insts(0),
+        Cycles(0), LoadBytes(0), StoreBytes(0) {}
+};
+
+/// The routines of the C library and the compiler runtime the host carries
+/// out in place of an undefined function.
+enum HostFn {
+  HF_Missing,
+  HF_Malloc, HF_Calloc, HF_Realloc, HF_Free,
+  HF_Memcpy, HF_Memmove, HF_Memset, HF_Strlen,
+  HF_Putchar, HF_Puts, HF_Printf, HF_Abort, HF_Exit,
+  HF_DivSI, HF_UDivSI, HF_ModSI, HF_UModSI,
+  HF_DivDI, HF_UDivDI, HF_ModDI, HF_UModDI, HF_MulDI,
+  HF_AshlDI, HF_LshrDI, HF_AshrDI
+};
+
+struct Stub {
+  std::string Name;
+  HostFn Fn;
+};
+
+struct Region {
+  uint32_t Base;
+  std::vector<uint8_t> Bytes;
+};
+
+class Simulator {
+  const MCRegisterInfo &MRI;
+  const MCInstrInfo &MII;
+  const MCSubtargetInfo &STI;
+  const MCDisassembler &Dis;
+  MCInstPrinter &IP;
+  const MCSchedModel &SM;
+
+  std::vector<OpInfo> Infos;
+  std::vector<uint8_t> RegSlot;
+  std::vector<bool> RegPair;
+
+  // Memory.
+  Region Image, Heap, DSPR;
+  uint32_t TextEnd, StubBase, ExitAddr, SmallDataBase, HeapTop;
+  StringMap<uint32_t> Globals, Commons, StubAddrs;
+  std::vector<Stub> Stubs;
+  std::vector<Function> Functions;
+  Function Unknown;
+  Function *Cur;
+  std::vector<std::unique_ptr<Decoded>> Cache;
+
+  // Architectural state.
+  uint32_t R[NumSlots];
+  uint32_t PC, NextPC, PCXI, FCX, LCX, ICR;
+
+  // Timing.
+  uint64_t Cycle;
+  unsigned Slots;
+  uint64_t Ready[NumSlots];
+
+  // Statistics.
+  uint64_t Insts, Loads, Stores, LoadBytes, StoreBytes;
+  uint64_t ContextSaves, ContextRestores, TakenBranches, Mispredicts;
+  unsigned Depth, MaxDepth;
+  std::vector<uint64_t> OpcodeCount;
+
+  std::string Fault;
+  bool Done;
+  uint32_t ExitValue;
+
+  void fault(const Twine &Message) {
+    if (Fault.empty())
+      Fault = Message.str();
+  }
+
+  // Linking.
+  bool symbolAddress(const SymbolRef &Sym,
+                     const DenseMap<uintptr_t, uint32_t> &SectionAddr,
+                     uint32_t &Addr);
+
+  // Memory.
+  uint8_t *translate(uint32_t Addr, unsigned Size);
+  uint32_t read(uint32_t Addr, unsigned Size);
+  void write(uint32_t Addr, unsigned Size, uint32_t Value);
+  void noteLoad(unsigned Size);
+  void noteStore(unsigned Size);
+  std::string readString(uint32_t Addr);
+
+  // Registers.
+  uint32_t reg(const MCOperand &MO) const { return R[RegSlot[MO.getReg()]]; }
+  uint64_t reg64(const MCOperand &MO) const {
+    unsigned S = RegSlot[MO.getReg()];
+    return R[S] | uint64_t(R[S + 1]) << 32;
+  }
+  void setReg(const MCOperand &MO, uint32_t Value) {
+    R[RegSlot[MO.getReg()]] = Value;
+  }
+  void setReg64(const MCOperand &MO, uint64_t Value) {
+    unsigned S = RegSlot[MO.getReg()];
+    R[S] = Value;
+    R[S + 1] = Value >> 32;
+  }
+  uint64_t pair(unsigned Slot) const {
+    return R[Slot] | uint64_t(R[Slot + 1]) << 32;
+  }
+  void setPair(unsigned Slot, uint64_t Value) {
+    R[Slot] = Value;
+    R[Slot + 1] = Value >> 32;
+  }
+  uint32_t value(const Decoded &D, unsigned Idx) const;
+
+  // Execution.
+  Function *functionAt(uint32_t Addr);
+  void countCall(uint32_t Target);
+  const Decoded *decode(uint32_t Addr);
+  void addSlots(SmallVectorImpl<uint8_t> &List, unsigned Reg) const;
+  uint32_t arith(int64_t Wide, bool Saturate = false);
+  uint64_t alu(const OpInfo &I, uint32_t A, uint32_t B);
+  uint32_t readCSFR(unsigned Addr) const;
+  bool saveContext(bool Upper);
+  bool restoreContext(bool Upper);
+  void execute(const Decoded &D);
+  void callHost();
+
+public:
+  Simulator(const MCRegisterInfo &MRI, const MCInstrInfo &MII,
+            const MCSubtargetInfo &STI, const MCDisassembler &Dis,
+            MCInstPrinter &IP);
+
+  bool link(ArrayRef<const ObjectFile *> Objs, const MCAsmBackend &MAB);
+  bool lookup(StringRef Name, uint32_t &Addr) const;
+  bool run(uint32_t Entry, ArrayRef<int> Args);
+  void report(raw_ostream &OS, StringRef CPU) const;
+  const std::string &getFault() const { return Fault; }
+};
+
+} // end anonymous namespace
+
+/// lowBits - A mask of the low Width bits.
+static uint32_t lowBits(unsigned Width) {
+  return Width >= 32 ? ~0u : (1u << Width) - 1;
+}
+
+static OpInfo op(OpKind Kind, unsigned Aux = 0, int Imm = 0) {
+  OpInfo I = { Kind, uint8_t(Aux), int8_t(Imm) };
+  return I;
+}
+
+static OpInfo cmp(unsigned Cond, bool Reg) {
+  return op(K_Cmp, Cond, Reg ? 0 : Cond == C_LTU || Cond == C_GEU ? 9 : -9);
+}
+
+static OpInfo acc(unsigned Acc, unsigned Cond, bool Reg) {
+  OpInfo I = cmp(Cond, Reg);
+  return op(K_AccCmp, Acc << 4 | Cond, I.Imm);
+}
+
+/// classifyMemory - Loads and stores are LD<type> or ST<type> with a suffix
+/// for the addressing mode: bo, _post or _pre.
+static bool classifyMemory(StringRef Name, OpInfo &I) {
+  bool IsLoad = Name.startswith("LD");
+  if (!IsLoad && !Name.startswith("ST"))
+    return false;
+
+  unsigned Mode;
+  StringRef Type = Name.drop_front(2);
+  if (Type.endswith("bo")) {
+    Mode = M_Offset;
+    Type = Type.drop_back(2);
+  } else if (Type.endswith("_post")) {
+    Mode = M_Post;
+    Type = Type.drop_back(5);
+  } else if (Type.endswith("_pre")) {
+    Mode = M_Pre;
+    Type = Type.drop_back(4);
+  } else {
+    return false;
+  }
+
+  unsigned Size = StringSwitch<unsigned>(Type)
+    .Cases("B", "BU", 1)
+    .Cases("H", "HU", 2)
+    .Cases("W", "A", 4)
+    .Case("D", 8)
+    .Default(0);
+  if (!Size)
+    return false;
+  bool Signed = Type == "B" || Type == "H";
+  I = op(IsLoad ? K_Load : K_Store, Mode << 5 | Signed << 4 | Size);
+  return true;
+}
+
+/// classify - The semantics of the instruction called Name.
+static OpInfo classify(StringRef Name) {
+  OpInfo I;
+  if (classifyMemory(Name, I))
+    return I;
+
+  return StringSwitch<OpInfo>(Name)
+    // Arithmetic.
+    .Cases("ADDrr", "ADDsrr", op(K_Add))
+    .Case("ADDrc", op(K_Add, 0, -9))
+    .Case("ADDsrc", op(K_Add, 0, -4))
+    .Case("ADDIrlc", op(K_Add, 0, -16))
+    .Cases("ADDIHrlc", "ADDIHArlc", op(K_AddHi, 0, 16))
+    .Case("ADDArr", op(K_AddA))
+    .Case("ADDXrr", op(K_AddX))
+    .Case("ADDXrc", op(K_AddX, 0, -9))
+    .Case("ADDCrr", op(K_AddC))
+    .Case("ADDCrc", op(K_AddC, 0, -9))
+    .Case("ADDSrr", op(K_AddS))
+    .Case("ADDSUrr", op(K_AddSU))
+    .Cases("SUBrr", "SUBsrr", op(K_Sub))
+    .Case("SUBArr", op(K_SubA))
+    .Case("SUBXrr", op(K_SubX))
+    .Case("SUBCrr", op(K_SubC))
+    .Case("SUBSrr", op(K_SubS))
+    .Case("SUBSUrr", op(K_SubSU))
+    .Case("RSUBrc", op(K_RSub, 0, -9))
+    .Case("RSUBsr", op(K_RSub))
+    .Cases("MULrr2", "MULsrr", op(K_Mul))
+    .Case("MULrc", op(K_Mul, 0, -9))
+    .Case("MULrr64", op(K_Mul64))
+    .Case("MULUrr2", op(K_MulU64))
+    .Case("MULQrr1", op(K_MulQ))
+    .Case("MULRQrr1", op(K_MulRQ))
+    .Case("MADDQrrr1", op(K_MAddQ))
+    .Case("MADDSQrrr1", op(K_MAddQ, Q_Sat))
+    .Case("MADDRQrrr1", op(K_MAddQ, Q_Round))
+    .Case("MADDRSQrrr1", op(K_MAddQ, Q_Round | Q_Sat))
+    .Case("MSUBQrrr1", op(K_MAddQ, Q_Sub))
+    .Case("MSUBSQrrr1", op(K_MAddQ, Q_Sub | Q_Sat))
+    .Case("MSUBRQrrr1", op(K_MAddQ, Q_Sub | Q_Round))
+    .Case("MSUBRSQrrr1", op(K_MAddQ, Q_Sub | Q_Round | Q_Sat))
+    .Case("DIVrr", op(K_Div))
+    .Case("DIVUrr", op(K_DivU))
+    .Case("ABSrr", op(K_Abs))
+    .Case("ABSDIFrr", op(K_AbsDif))
+    .Case("ABSDIFrc", op(K_AbsDif, 0, -9))
+    .Case("MINrr", op(K_Min))
+    .Case("MINrc", op(K_Min, 0, -9))
+    .Case("MAXrr", op(K_Max))
+    .Case("MAXrc", op(K_Max, 0, -9))
+    .Case("MINUrr", op(K_MinU))
+    .Case("MINUrc", op(K_MinU, 0, 9))
+    .Case("MAXUrr", op(K_MaxU))
+    .Case("MAXUrc", op(K_MaxU, 0, 9))
+    .Case("SATBrr", op(K_Sat, Sat_B))
+    .Case("SATBUrr", op(K_Sat, Sat_BU))
+    .Case("SATHrr", op(K_Sat, Sat_H))
+    .Case("SATHUrr", op(K_Sat, Sat_HU))
+    .Case("ADDFrrr", op(K_AddF))
+    // Logic. ANDsc and ORsc work on D15.
+    .Cases("ANDrr", "ANDsrr", op(K_And))
+    .Case("ANDrc", op(K_And, 0, 9))
+    .Case("ANDsc", op(K_And, 0, 8))
+    .Cases("ORrr", "ORsrr", op(K_Or))
+    .Case("ORrc", op(K_Or, 0, 9))
+    .Case("ORsc", op(K_Or, 0, 8))
+    .Cases("XORrr", "XORsrr", op(K_Xor))
+    .Case("XORrc", op(K_Xor, 0, 9))
+    .Case("NANDrr", op(K_Nand))
+    .Case("NANDrc", op(K_Nand, 0, 9))
+    .Case("NORrr", op(K_Nor))
+    .Case("NORrc", op(K_Nor, 0, 9))
+    .Case("XNORrc", op(K_Xnor, 0, 9))
+    .Case("ANDNrc", op(K_AndN, 0, 9))
+    .Case("ORNrc", op(K_OrN, 0, 9))
+    .Case("NOTsr", op(K_Not))
+    // Comparisons.
+    .Case("EQrr", cmp(C_EQ, true))
+    .Case("EQrc", cmp(C_EQ, false))
+    .Case("NErr", cmp(C_NE, true))
+    .Case("NErc", cmp(C_NE, false))
+    .Case("LTrr", cmp(C_LT, true))
+    .Case("LTrc", cmp(C_LT, false))
+    .Case("LT_Urr", cmp(C_LTU, true))
+    .Case("LT_Urc", cmp(C_LTU, false))
+    .Case("GErr", cmp(C_GE, true))
+    .Case("GErc", cmp(C_GE, false))
+    .Case("GE_Urr", cmp(C_GEU, true))
+    .Case("GE_Urc", cmp(C_GEU, false))
+    .Case("AND_EQrr", acc(Acc_And, C_EQ, true))
+    .Case("AND_EQrc", acc(Acc_And, C_EQ, false))
+    .Case("AND_NErr", acc(Acc_And, C_NE, true))
+    .Case("AND_NErc", acc(Acc_And, C_NE, false))
+    .Case("AND_LTrr", acc(Acc_And, C_LT, true))
+    .Case("AND_LTrc", acc(Acc_And, C_LT, false))
+    .Case("AND_LT_Urr", acc(Acc_And, C_LTU, true))
+    .Case("AND_LT_Urc", acc(Acc_And, C_LTU, false))
+    .Case("AND_GErr", acc(Acc_And, C_GE, true))
+    .Case("AND_GErc", acc(Acc_And, C_GE, false))
+    .Case("AND_GE_Urr", acc(Acc_And, C_GEU, true))
+    .Case("AND_GE_Urc", acc(Acc_And, C_GEU, false))
+    .Case("OR_EQrr", acc(Acc_Or, C_EQ, true))
+    .Case("OR_EQrc", acc(Acc_Or, C_EQ, false))
+    .Case("OR_NErr", acc(Acc_Or, C_NE, true))
+    .Case("OR_NErc", acc(Acc_Or, C_NE, false))
+    .Case("OR_LTrr", acc(Acc_Or, C_LT, true))
+    .Case("OR_LTrc", acc(Acc_Or, C_LT, false))
+    .Case("OR_LT_Urr", acc(Acc_Or, C_LTU, true))
+    .Case("OR_LT_Urc", acc(Acc_Or, C_LTU, false))
+    .Case("OR_GErr", acc(Acc_Or, C_GE, true))
+    .Case("OR_GErc", acc(Acc_Or, C_GE, false))
+    .Case("OR_GE_Urr", acc(Acc_Or, C_GEU, true))
+    .Case("OR_GE_Urc", acc(Acc_Or, C_GEU, false))
+    .Case("XOR_EQrr", acc(Acc_Xor, C_EQ, true))
+    .Case("XOR_EQrc", acc(Acc_Xor, C_EQ, false))
+    .Case("XOR_NErr", acc(Acc_Xor, C_NE, true))
+    .Case("XOR_NErc", acc(Acc_Xor, C_NE, false))
+    .Case("XOR_LTrr", acc(Acc_Xor, C_LT, true))
+    .Case("XOR_LTrc", acc(Acc_Xor, C_LT, false))
+    .Case("XOR_LT_Urr", acc(Acc_Xor, C_LTU, true))
+    .Case("XOR_LT_Urc", acc(Acc_Xor, C_LTU, false))
+    .Case("XOR_GErr", acc(Acc_Xor, C_GE, true))
+    .Case("XOR_GErc", acc(Acc_Xor, C_GE, false))
+    .Case("XOR_GE_Urr", acc(Acc_Xor, C_GEU, true))
+    .Case("XOR_GE_Urc", acc(Acc_Xor, C_GEU, false))
+    .Case("SH_EQrr", acc(Acc_Sh, C_EQ, true))
+    .Case("SH_EQrc", acc(Acc_Sh, C_EQ, false))
+    .Case("SH_NErr", acc(Acc_Sh, C_NE, true))
+    .Case("SH_NErc", acc(Acc_Sh, C_NE, false))
+    .Case("SH_LTrr", acc(Acc_Sh, C_LT, true))
+    .Case("SH_LTrc", acc(Acc_Sh, C_LT, false))
+    .Case("SH_LT_Urr", acc(Acc_Sh, C_LTU, true))
+    .Case("SH_LT_Urc", acc(Acc_Sh, C_LTU, false))
+    .Case("SH_GErr", acc(Acc_Sh, C_GE, true))
+    .Case("SH_GErc", acc(Acc_Sh, C_GE, false))
+    .Case("SH_GE_Urr", acc(Acc_Sh, C_GEU, true))
+    .Case("SH_GE_Urc", acc(Acc_Sh, C_GEU, false))
+    // Shifts and bit fields.
+    .Cases("SHrr", "SHrc", op(K_Sh))
+    .Cases("SHArr", "SHArc", op(K_Sha))
+    .Case("CLZrr", op(K_Clz))
+    .Case("CLOrr", op(K_Clo))
+    .Case("CLSrr", op(K_Cls))
+    .Case("POPCNTWrr", op(K_Popcnt))
+    .Case("EXTRrrpw", op(K_Extr, 1))
+    .Case("EXTRUrrpw", op(K_Extr, 0))
+    .Cases("DEXTRrrpw", "DEXTRrrrr", op(K_Dextr))
+    .Case("IMASKrcpw", op(K_Imask))
+    .Case("ANDTbit", op(K_BitOp, Bit_And))
+    .Case("ORTbit", op(K_BitOp, Bit_Or))
+    .Case("XORTbit", op(K_BitOp, Bit_Xor))
+    .Case("INSTbit", op(K_BitOp, Bit_Ins))
+    .Case("INSNTbit", op(K_BitOp, Bit_InsN))
+    .Case("SHUFFLErc", op(K_Shuffle, 0, 9))
+    .Case("CRC32rr", op(K_Crc32))
+    // Moves.
+    .Cases("MOVrr", "MOVAArr", "MOVAAsrr", "MOVArr", "MOVDrr", op(K_Mov))
+    .Case("MOVsrc", op(K_Mov, 0, -4))
+    .Case("MOVrlc", op(K_Mov, 0, -16))
+    .Case("MOVUrlc", op(K_Mov, 0, 16))
+    .Cases("MOVHrlc", "MOVHArlc", op(K_MovHi, 0, 16))
+    .Case("LEAbol", op(K_Lea))
+    .Case("SUBAsc", op(K_SubSP, 0, 8))
+    .Case("MFCRrlc", op(K_Mfcr))
+    // Memory operations other than the plain loads and stores.
+    .Case("STTabsb", op(K_StoreBit))
+    .Case("SWAPWbo", op(K_Swap))
+    .Case("CMPSWAPWbo", op(K_CmpSwap))
+    .Case("SWAPMSKWbo", op(K_SwapMsk))
+    .Case("LDMSTbo", op(K_Ldmst))
+    // Control flow.
+    .Cases("Jb", "Jsb", op(K_J))
+    .Cases("JZsb", "JZsbr", op(K_JZ, 0))
+    .Cases("JNZsb", "JNZsbr", op(K_JZ, 1))
+    .Cases("JZTbrn", "JZTsbrn", op(K_JZT, 0))
+    .Cases("JNZTbrn", "JNZTsbrn", op(K_JZT, 1))
+    .Cases("JEQbrc", "JEQbrr", op(K_JCmp, C_EQ, -4))
+    .Cases("JNEbrc", "JNEbrr", op(K_JCmp, C_NE, -4))
+    .Cases("JGEbrc", "JGEbrr", op(K_JCmp, C_GE, -4))
+    .Cases("JGE_Ubrc", "JGE_Ubrr", op(K_JCmp, C_GEU, 4))
+    .Cases("JLTbrc", "JLTbrr", op(K_JCmp, C_LT, -4))
+    .Cases("JLT_Ubrc", "JLT_Ubrr", op(K_JCmp, C_LTU, 4))
+    .Case("JNEDbrr", op(K_JNED))
+    .Case("JNEDbrc", op(K_JNED, 0, -4))
+    .Case("JNEIbrr", op(K_JNEI))
+    .Case("JNEIbrc", op(K_JNEI, 0, -4))
+    .Case("JIsr", op(K_JI))
+    .Case("JIRETsr", op(K_JIRet))
+    .Case("JLb", op(K_JL))
+    .Case("JLIrr", op(K_JLI))
+    .Case("CALLb", op(K_Call))
+    .Case("CALLIrr", op(K_CallI))
+    .Case("FCALLb", op(K_FCall))
+    .Case("FCALLIrr", op(K_FCallI))
+    .Cases("RETsr", "RFEsr", op(K_Ret))
+    .Case("FRETsr", op(K_FRet))
+    .Case("SVLCX", op(K_Svlcx))
+    .Case("RSLCX", op(K_Rslcx))
+    .Case("BISRrc", op(K_Bisr, 0, 9))
+    .Cases("NOPsr", "NOPsys", "DSYNC", "ISYNC", op(K_Nop))
+    .Default(op(K_Unknown));
+}
+
+static HostFn classifyHost(StringRef Name) {
+  return StringSwitch<HostFn>(Name)
+    .Case("malloc", HF_Malloc)
+    .Case("calloc", HF_Calloc)
+    .Case("realloc", HF_Realloc)
+    .Case("free", HF_Free)
+    .Case("memcpy", HF_Memcpy)
+    .Case("memmove", HF_Memmove)
+    .Case("memset", HF_Memset)
+    .Case("strlen", HF_Strlen)
+    .Case("putchar", HF_Putchar)
+    .Case("puts", HF_Puts)
+    .Case("printf", HF_Printf)
+    .Case("abort", HF_Abort)
+    .Case("exit", HF_Exit)
+    .Case("__divsi3", HF_DivSI)
+    .Case("__udivsi3", HF_UDivSI)
+    .Case("__modsi3", HF_ModSI)
+    .Case("__umodsi3", HF_UModSI)
+    .Case("__divdi3", HF_DivDI)
+    .Case("__udivdi3", HF_UDivDI)
+    .Case("__moddi3", HF_ModDI)
+    .Case("__umoddi3", HF_UModDI)
+    .Case("__muldi3", HF_MulDI)
+    .Case("__ashldi3", HF_AshlDI)
+    .Case("__lshrdi3", HF_LshrDI)
+    .Case("__ashrdi3", HF_AshrDI)
+    .Default(HF_Missing);
+}
+
+Simulator::Simulator(const MCRegisterInfo &MRI, const MCInstrInfo &MII,
+                     const MCSubtargetInfo &STI, const MCDisassembler &Dis,
+                     MCInstPrinter &IP)
+    : MRI(MRI), MII(MII), STI(STI), Dis(Dis), IP(IP),
+      SM(STI.getSchedModel()), Unknown("<unknown>", 0, 0, false),
+      Cur(nullptr), PC(0), NextPC(0), PCXI(0), FCX(0), LCX(0), ICR(0),
+      Cycle(0), Slots(0), Insts(0), Loads(0), Stores(0), LoadBytes(0),
+      StoreBytes(0), ContextSaves(0), ContextRestores(0), TakenBranches(0),
+      Mispredicts(0), Depth(0), MaxDepth(0), Done(false), ExitValue(0) {
+  for (unsigned Opc = 0, E = MII.getNumOpcodes(); Opc != E; ++Opc)
+    Infos.push_back(classify(MII.getName(Opc)));
+  OpcodeCount.resize(MII.getNumOpcodes());
+
+  // Map the registers onto the slots by name, D3, E2, F7, A10 and PSW.
+  RegSlot.assign(MRI.getNumRegs(), SlotOther);
+  RegPair.assign(MRI.getNumRegs(), false);
+  for (unsigned Reg = 1, E = MRI.getNumRegs(); Reg != E; ++Reg) {
+    StringRef Name = MRI.getName(Reg);
+    unsigned N;
+    if (Name == "PSW") {
+      RegSlot[Reg] = SlotPSW;
+      continue;
+    }
+    if (Name.size() < 2 || Name.substr(1).getAsInteger(10, N) || N > 15)
+      continue;
+    switch (Name[0]) {
+    case 'E':
+      RegPair[Reg] = true;
+      // Fall through.
+    case 'D':
+    case 'F':
+      RegSlot[Reg] = SlotD0 + N;
+      break;
+    case 'A':
+      RegSlot[Reg] = SlotA0 + N;
+      break;
+    }
+  }
+
+  std::fill(std::begin(R), std::end(R), 0);
+  std::fill(std::begin(Ready), std::end(Ready), 0);
+}
+
+//===----------------------------------------------------------------------===//
+// Linking
+//===----------------------------------------------------------------------===//
+
+static bool isSmallDataSection(StringRef Name) {
+  return Name.startswith(".sdata") || Name.startswith(".sbss");
+}
+
+/// symbolAddress - The address of Sym in the image: a global or common by
+/// name if it is undefined here, else its section plus its value.
+bool Simulator::symbolAddress(const SymbolRef &Sym,
+                              const DenseMap<uintptr_t, uint32_t> &SectionAddr,
+                              uint32_t &Addr) {
+  uint32_t Flags = Sym.getFlags();
+  if (Flags & (SymbolRef::SF_Undefined | SymbolRef::SF_Common)) {
+    ErrorOr<StringRef> Name = Sym.getName();
+    if (!Name)
+      return error(Name.getError().message());
+    for (const StringMap<uint32_t> *Map : { &Globals, &Commons, &StubAddrs }) {
+      auto I = Map->find(*Name);
+      if (I != Map->end()) {
+        Addr = I->second;
+        return true;
+      }
+    }
+    return error("undefined symbol '" + *Name + "'");
+  }
+
+  section_iterator Sec = Sym.getObject()->section_end();
+  if (std::error_code EC = Sym.getSection(Sec))
+    return error(EC.message());
+  Addr = Sym.getValue();
+  if (Sec == Sym.getObject()->section_end())
+    return true;
+  auto I = SectionAddr.find(Sec->getRawDataRefImpl().p);
+  if (I == SectionAddr.end())
+    return error("symbol in a section that is not loaded");
+  Addr += I->second;
+  return true;
+}
+
+/// link - Lay the sections of Objs out from ImageBase, code first, resolve
+/// their symbols, give every undefined symbol a stub and apply the
+/// relocations with the fixup code of the assembler backend.
+bool Simulator::link(ArrayRef<const ObjectFile *> Objs,
+                     const MCAsmBackend &MAB) {
+  // Code, other data, small data, small bss and other bss, in that order: the
+  // decoder only looks at the first range and A0 reaches the small sections
+  // with a 16-bit offset.
+  enum { Code, Data, SmallData, SmallBSS, BSS, NumClasses };
+  DenseMap<uintptr_t, uint32_t> SectionAddr;
+  uint64_t Size = 0;
+  SmallDataBase = ImageBase;
+  for (unsigned Class = 0; Class != NumClasses; ++Class) {
+    if (Class == SmallData)
+      SmallDataBase = ImageBase + Size;
+    for (const ObjectFile *Obj : Objs)
+      for (const SectionRef &Sec : Obj->sections()) {
+        StringRef Name;
+        if (!(ELFSectionRef(Sec).getFlags() & ELF::SHF_ALLOC) ||
+            !Sec.getSize() || Sec.getName(Name))
+          continue;
+        unsigned SecClass = Sec.isText() ? Code : Sec.isBSS() ? BSS : Data;
+        if (isSmallDataSection(Name) && SecClass != Code)
+          SecClass = SecClass == BSS ? SmallBSS : SmallData;
+        if (SecClass != Class)
+          continue;
+        Size = RoundUpToAlignment(Size, std::max<uint64_t>(Sec.getAlignment(),
+                                                           2));
+        SectionAddr[Sec.getRawDataRefImpl().p] = ImageBase + Size;
+        Size += Sec.getSize();
+      }
+    if (Class == Code)
+      TextEnd = ImageBase + Size;
+  }
+  // The small data base sits in the middle of the 64K its offsets reach.
+  SmallDataBase += 0x8000;
+
+  // Defined symbols. Functions are kept for the profile, globals by name.
+  StringMap<bool> Weak;
+  for (const ObjectFile *Obj : Objs)
+    for (const SymbolRef &Sym : Obj->symbols()) {
+      uint32_t Flags = Sym.getFlags();
+      if (Flags & (SymbolRef::SF_Undefined | SymbolRef::SF_Common |
+                   SymbolRef::SF_FormatSpecific))
+        continue;
+      ErrorOr<StringRef> Name = Sym.getName();
+      if (!Name)
+        return error(Name.getError().message());
+      uint32_t Addr;
+      if (Name->empty() || !symbolAddress(Sym, SectionAddr, Addr))
+        continue;
+
+      ELFSymbolRef ESym(Sym);
+      if (ESym.getELFType() == ELF::STT_FUNC)
+        Functions.push_back(Function(*Name, Addr, Addr + ESym.getSize(),
+                                     false));
+      if (!(Flags & SymbolRef::SF_Global))
+        continue;
+      bool IsWeak = Flags & SymbolRef::SF_Weak;
+      auto I = Globals.find(*Name);
+      if (I == Globals.end() || (Weak[*Name] && !IsWeak)) {
+        Globals[*Name] = Addr;
+        Weak[*Name] = IsWeak;
+      } else if (!IsWeak && !Weak[*Name]) {
+        return error("duplicate symbol '" + *Name + "'");
+      }
+    }
+
+  // Common symbols go after the bss, one object per name.
+  for (const ObjectFile *Obj : Objs)
+    for (const SymbolRef &Sym : Obj->symbols()) {
+      if (!(Sym.getFlags() & SymbolRef::SF_Common))
+        continue;
+      ErrorOr<StringRef> Name = Sym.getName();
+      if (!Name)
+        return error(Name.getError().message());
+      if (Globals.count(*Name) || Commons.count(*Name))
+        continue;
+      Size = RoundUpToAlignment(Size, std::max<uint32_t>(Sym.getAlignment(), 1));
+      Commons[*Name] = ImageBase + Size;
+      Size += Sym.getCommonSize();
+    }
+
+  // A stub for every symbol that is still undefined, then the address the
+  // entry function returns to.
+  Size = RoundUpToAlignment(Size, 4);
+  StubBase = ImageBase + Size;
+  for (const ObjectFile *Obj : Objs)
+    for (const SymbolRef &Sym : Obj->symbols()) {
+      if (!(Sym.getFlags() & SymbolRef::SF_Undefined))
+        continue;
+      ErrorOr<StringRef> Name = Sym.getName();
+      if (!Name)
+        return error(Name.getError().message());
+      if (Name->empty() || Globals.count(*Name) || Commons.count(*Name) ||
+          StubAddrs.count(*Name))
+        continue;
+      uint32_t Addr = ImageBase + Size;
+      StubAddrs[*Name] = Addr;
+      Stub S = { *Name, classifyHost(*Name) };
+      Stubs.push_back(S);
+      Functions.push_back(Function(*Name, Addr, Addr + 4, true));
+      Size += 4;
+    }
+  ExitAddr = ImageBase + Size;
+  Size += 4;
+
+  Image.Base = ImageBase;
+  Image.Bytes.assign(Size, 0);
+  for (const ObjectFile *Obj : Objs)
+    for (const SectionRef &Sec : Obj->sections()) {
+      auto I = SectionAddr.find(Sec.getRawDataRefImpl().p);
+      if (I == SectionAddr.end() || Sec.isBSS())
+        continue;
+      StringRef Contents;
+      if (std::error_code EC = Sec.getContents(Contents))
+        return error(EC.message());
+      std::copy(Contents.begin(), Contents.end(),
+                Image.Bytes.begin() + (I->second - ImageBase));
+    }
+
+  // The fixup kinds of the backend, by name.
+  StringMap<unsigned> FixupKinds;
+  for (unsigned K = FirstTargetFixupKind,
+                E = FirstTargetFixupKind + MAB.getNumFixupKinds();
+       K != E; ++K)
+    FixupKinds[MAB.getFixupKindInfo(MCFixupKind(K)).Name] = K;
+
+  for (const ObjectFile *Obj : Objs)
+    for (const SectionRef &RelSec : Obj->sections()) {
+      section_iterator Target = RelSec.getRelocatedSection();
+      if (Target == Obj->section_end())
+        continue;
+      auto TI = SectionAddr.find(Target->getRawDataRefImpl().p);
+      if (TI == SectionAddr.end())
+        continue;
+      uint32_t SecAddr = TI->second;
+      char *Data = reinterpret_cast<char *>(&Image.Bytes[SecAddr - ImageBase]);
+
+      for (const RelocationRef &Rel : RelSec.relocations()) {
+        uint32_t S = 0;
+        symbol_iterator Sym = Rel.getSymbol();
+        if (Sym != Obj->symbol_end() &&
+            !symbolAddress(*Sym, SectionAddr, S))
+          return false;
+        ErrorOr<int64_t> Addend = ELFRelocationRef(Rel).getAddend();
+        int64_t Value = int64_t(S) + (Addend ? *Addend : 0);
+        uint32_t P = SecAddr + Rel.getOffset();
+
+        const char *Fixup;
+        bool IsPCRel = false;
+        switch (Rel.getType()) {
+        default: {
+          SmallString<32> TypeName;
+          Rel.getTypeName(TypeName);
+          return error("unsupported relocation " + TypeName);
+        }
+        case ELF::R_TRICORE_32ABS:  Fixup = nullptr; break;
+        case ELF::R_TRICORE_16ABS:  Fixup = nullptr; break;
+        case ELF::R_TRICORE_8ABS:   Fixup = nullptr; break;
+        case ELF::R_TRICORE_32REL:  Fixup = nullptr; IsPCRel = true; break;
+        case ELF::R_TRICORE_24REL:
+          Fixup = "fixup_tricore_disp24"; IsPCRel = true; break;
+        case ELF::R_TRICORE_15REL:
+          Fixup = "fixup_tricore_disp15"; IsPCRel = true; break;
+        case ELF::R_TRICORE_8REL:
+          Fixup = "fixup_tricore_disp8";  IsPCRel = true; break;
+        case ELF::R_TRICORE_4REL:
+          Fixup = "fixup_tricore_disp4";  IsPCRel = true; break;
+        case ELF::R_TRICORE_HIADJ:  Fixup = "fixup_tricore_hiadj"; break;
+        case ELF::R_TRICORE_LO:     Fixup = "fixup_tricore_lo"; break;
+        case ELF::R_TRICORE_LO2:    Fixup = "fixup_tricore_lo2"; break;
+        case ELF::R_TRICORE_16SM:
+          Fixup = "fixup_tricore_sm16";
+          Value -= SmallDataBase;
+          break;
+        }
+        if (IsPCRel)
+          Value -= P;
+
+        unsigned Kind;
+        if (!Fixup) {
+          Kind = Rel.getType() == ELF::R_TRICORE_8ABS    ? FK_Data_1
+                 : Rel.getType() == ELF::R_TRICORE_16ABS ? FK_Data_2
+                                                         : FK_Data_4;
+        } else {
+          auto KI = FixupKinds.find(Fixup);
+          if (KI == FixupKinds.end())
+            return error(Twine("the backend has no ") + Fixup);
+          Kind = KI->second;
+        }
+        MAB.applyFixup(MCFixup::create(Rel.getOffset(), nullptr,
+                                       MCFixupKind(Kind)),
+                       Data, Target->getSize(), Value, IsPCRel);
+      }
+    }
+
+  // Functions without a size run up to the next one.
+  std::sort(Functions.begin(), Functions.end(),
+            [](const Function &A, const Function &B) {
+              return A.Start < B.Start;
+            });
+  for (unsigned i = 0, e = Functions.size(); i != e; ++i)
+    if (Functions[i].End == Functions[i].Start)
+      Functions[i].End = i + 1 != e ? Functions[i + 1].Start : TextEnd;
+
+  Cache.resize((TextEnd - ImageBase) / 2);
+  return true;
+}
+
+bool Simulator::lookup(StringRef Name, uint32_t &Addr) const {
+  auto I = Globals.find(Name);
+  if (I != Globals.end()) {
+    Addr = I->second;
+    return true;
+  }
+  for (const Function &F : Functions)
+    if (!F.Host && F.Name == Name) {
+      Addr = F.Start;
+      return true;
+    }
+  return false;
+}
+
+//===----------------------------------------------------------------------===//
+// Memory
+//===----------------------------------------------------------------------===//
+
+uint8_t *Simulator::translate(uint32_t Addr, unsigned Size) {
+  for (Region *M : { &Image, &Heap, &DSPR }) {
+    uint32_t Offset = Addr - M->Base;
+    if (Offset < M->Bytes.size() && M->Bytes.size() - Offset >= Size)
+      return &M->Bytes[Offset];
+  }
+  fault("access to unmapped memory at " + hex(Addr));
+  return nullptr;
+}
+
+uint32_t Simulator::read(uint32_t Addr, unsigned Size) {
+  const uint8_t *P = translate(Addr, Size);
+  if (!P)
+    return 0;
+  switch (Size) {
+  case 1:  return *P;
+  case 2:  return support::endian::read16le(P);
+  default: return support::endian::read32le(P);
+  }
+}
+
+void Simulator::write(uint32_t Addr, unsigned Size, uint32_t Value) {
+  uint8_t *P = translate(Addr, Size);
+  if (!P)
+    return;
+  switch (Size) {
+  case 1:  *P = Value; break;
+  case 2:  support::endian::write16le(P, Value); break;
+  default: support::endian::write32le(P, Value); break;
+  }
+}
+
+void Simulator::noteLoad(unsigned Size) {
+  ++Loads;
+  LoadBytes += Size;
+  Cur->LoadBytes += Size;
+}
+
+void Simulator::noteStore(unsigned Size) {
+  ++Stores;
+  StoreBytes += Size;
+  Cur->StoreBytes += Size;
+}
+
+std::string Simulator::readString(uint32_t Addr) {
+  std::string S;
+  while (Fault.empty()) {
+    char C = read(Addr++, 1);
+    if (!C)
+      break;
+    S += C;
+  }
+  return S;
+}
+
+//===----------------------------------------------------------------------===//
+// Execution
+//===----------------------------------------------------------------------===//
+
+Function *Simulator::functionAt(uint32_t Addr) {
+  if (Cur && Addr - Cur->Start < Cur->End - Cur->Start)
+    return Cur;
+  auto I = std::upper_bound(Functions.begin(), Functions.end(), Addr,
+                            [](uint32_t A, const Function &F) {
+                              return A < F.Start;
+                            });
+  if (I != Functions.begin() && Addr < std::prev(I)->End)
+    return Cur = &*std::prev(I);
+  return Cur = &Unknown;
+}
+
+void Simulator::countCall(uint32_t Target) {
+  Function *Caller = Cur;
+  Function *F = functionAt(Target);
+  if (F->Start == Target)
+    ++F->Calls;
+  Cur = Caller;
+}
+
+void Simulator::addSlots(SmallVectorImpl<uint8_t> &List, unsigned Reg) const {
+  List.push_back(RegSlot[Reg]);
+  if (RegPair[Reg])
+    List.push_back(RegSlot[Reg] + 1);
+}
+
+const Decoded *Simulator::decode(uint32_t Addr) {
+  uint32_t Offset = Addr - ImageBase;
+  if ((Addr & 1) || Offset >= TextEnd - ImageBase) {
+    fault("execution left the code at " + hex(Addr));
+    return nullptr;
+  }
+  std::unique_ptr<Decoded> &Entry = Cache[Offset / 2];
+  if (Entry)
+    return Entry.get();
+
+  std::unique_ptr<Decoded> D(new Decoded());
+  uint64_t Size;
+  ArrayRef<uint8_t> Bytes(&Image.Bytes[Offset], TextEnd - Addr);
+  if (Dis.getInstruction(D->Inst, Size, Bytes, Addr, nulls(), nulls()) !=
+      MCDisassembler::Success) {
+    fault("invalid instruction at " + hex(Addr));
+    return nullptr;
+  }
+  unsigned Opc = D->Inst.getOpcode();
+  const MCInstrDesc &Desc = MII.get(Opc);
+  if (!Desc.isVariadic() && D->Inst.getNumOperands() != Desc.getNumOperands()) {
+    fault(Twine("malformed ") + MII.getName(Opc) + " at " + hex(Addr));
+    return nullptr;
+  }
+  D->Info = Infos[Opc];
+  D->Size = Size;
+  D->DataDefs = 0;
+
+  // The registers read and written, for the scoreboard.
+  for (unsigned i = 0, e = D->Inst.getNumOperands(); i != e; ++i) {
+    const MCOperand &MO = D->Inst.getOperand(i);
+    if (!MO.isReg() || !MO.getReg())
+      continue;
+    if (i < Desc.getNumDefs()) {
+      addSlots(D->Defs, MO.getReg());
+      if (i == 0)
+        D->DataDefs = D->Defs.size();
+    } else {
+      addSlots(D->Uses, MO.getReg());
+    }
+  }
+  if (const uint16_t *ImpUses = Desc.getImplicitUses())
+    for (; *ImpUses; ++ImpUses)
+      addSlots(D->Uses, *ImpUses);
+  if (const uint16_t *ImpDefs = Desc.getImplicitDefs())
+    for (; *ImpDefs; ++ImpDefs)
+      addSlots(D->Defs, *ImpDefs);
+
+  Entry = std::move(D);
+  return Entry.get();
+}
+
+/// value - Operand Idx of D: a register's contents or an immediate extended
+/// as its field requires.
+uint32_t Simulator::value(const Decoded &D, unsigned Idx) const {
+  const MCOperand &MO = D.Inst.getOperand(Idx);
+  if (MO.isReg())
+    return reg(MO);
+  uint32_t Imm = MO.getImm();
+  int Bits = D.Info.Imm;
+  if (Bits < 0)
+    return SignExtend32(Imm, -Bits);
+  if (Bits > 0)
+    return Imm & lowBits(Bits);
+  return Imm;
+}
+
+/// arith - The low word of Wide, setting the overflow bits of PSW as the
+/// arithmetic instructions do. A saturating instruction clamps the value
+/// instead of wrapping it.
+uint32_t Simulator::arith(int64_t Wide, bool Saturate) {
+  uint32_t &PSW = R[SlotPSW];
+  bool Overflow = Wide != int64_t(int32_t(Wide));
+  if (Overflow && Saturate)
+    Wide = Wide < 0 ? INT32_MIN : INT32_MAX;
+  uint32_t Result = Wide;
+  bool Advance = ((Result >> 31) ^ (Result >> 30)) & 1;
+  PSW &= ~(PSW_V | PSW_AV);
+  if (Overflow)
+    PSW |= PSW_V | PSW_SV;
+  if (Advance)
+    PSW |= PSW_AV | PSW_SAV;
+  return Result;
+}
+
+static bool test(unsigned Cond, uint32_t A, uint32_t B) {
+  switch (Cond) {
+  case C_EQ:  return A == B;
+  case C_NE:  return A != B;
+  case C_LT:  return int32_t(A) < int32_t(B);
+  case C_LTU: return A < B;
+  case C_GE:  return int32_t(A) >= int32_t(B);
+  case C_GEU: return A >= B;
+  }
+  llvm_unreachable("Unknown condition!");
+}
+
+/// shift - SH and SHA: a left shift for a positive count, a right shift for a
+/// negative one. The count is the low six bits of B, sign extended.
+static uint32_t shift(uint32_t A, uint32_t B, bool Arithmetic) {
+  int Count = SignExtend32<6>(B);
+  if (Count >= 0)
+    return uint64_t(A) << Count;
+  if (Arithmetic)
+    return int64_t(int32_t(A)) >> -Count;
+  return uint64_t(A) >> -Count;
+}
+
+/// mulQ - MUL.Q, MULR.Q, MADD.Q and MSUB.Q with n = 1 and their saturating and
+/// rounding forms. The rounding forms multiply the low halfwords.
+static uint32_t mulQ(uint32_t Acc, uint32_t X, uint32_t Y, unsigned Flags) {
+  int64_t Product;
+  if (Flags & Q_Round) {
+    if ((X & 0xFFFF) == 0x8000 && (Y & 0xFFFF) == 0x8000)
+      Product = 0x7FFFFFFF;
+    else
+      Product = int64_t(int16_t(X)) * int16_t(Y) * 2;
+  } else {
+    if (X == 0x80000000 && Y == 0x80000000)
+      Product = 0x7FFFFFFF;
+    else
+      Product = (int64_t(int32_t(X)) * int32_t(Y) * 2) >> 32;
+  }
+
+  int64_t Sum = Flags & Q_Sub ? int64_t(int32_t(Acc)) - Product
+                              : int64_t(int32_t(Acc)) + Product;
+  if (Flags & Q_Round)
+    Sum += 0x8000;
+  if ((Flags & Q_Sat) && Sum != int64_t(int32_t(Sum)))
+    Sum = Sum < 0 ? INT32_MIN : INT32_MAX;
+  uint32_t Result = Sum;
+  return Flags & Q_Round ? Result & 0xFFFF0000 : Result;
+}
+
+/// alu - The result of the instructions up to K_LastALU from their sources A
+/// and B. Divides and 64-bit multiplies give a register pair.
+uint64_t Simulator::alu(const OpInfo &I, uint32_t A, uint32_t B) {
+  int32_t SA = A, SB = B;
+  uint32_t &PSW = R[SlotPSW];
+  uint32_t Carry = PSW >> 31;
+  switch (I.Kind) {
+  default:
+    llvm_unreachable("Not an ALU operation!");
+  case K_Add:   return arith(int64_t(SA) + SB);
+  case K_AddA:  return A + B;
+  case K_AddHi: return A + (B << 16);
+  case K_AddX:
+  case K_AddC: {
+    uint32_t In = I.Kind == K_AddC ? Carry : 0;
+    uint32_t Result = arith(int64_t(SA) + SB + In);
+    PSW = (PSW & ~PSW_C) | ((uint64_t(A) + B + In) >> 32 ? PSW_C : 0);
+    return Result;
+  }
+  case K_AddS:  return arith(int64_t(SA) + SB, true);
+  case K_AddSU: return std::min<uint64_t>(uint64_t(A) + B, UINT32_MAX);
+  case K_Sub:   return arith(int64_t(SA) - SB);
+  case K_SubA:  return A - B;
+  case K_SubX:
+  case K_SubC: {
+    // The carry is the inverted borrow: A + ~B + 1 for SUBX, + C for SUBC.
+    uint32_t In = I.Kind == K_SubC ? Carry : 1;
+    uint32_t Result = arith(int64_t(SA) - SB - 1 + In);
+    PSW = (PSW & ~PSW_C) | ((uint64_t(A) + uint32_t(~B) + In) >> 32 ? PSW_C : 0);
+    return Result;
+  }
+  case K_SubS:  return arith(int64_t(SA) - SB, true);
+  case K_SubSU: return A > B ? A - B : 0;
+  case K_RSub:  return arith(int64_t(SB) - SA);
+  case K_Mul:   return arith(int64_t(SA) * SB);
+  case K_Mul64: return uint64_t(int64_t(SA) * SB);
+  case K_MulU64: return uint64_t(A) * B;
+  case K_MulQ:  return mulQ(0, A, B, 0);
+  case K_MulRQ: return mulQ(0, A, B, Q_Round);
+  case K_Div: {
+    // The quotient goes to the even register, the remainder to the odd one.
+    if (!B)
+      return SA < 0 ? 0x80000000 : 0x7FFFFFFF;
+    if (A == 0x80000000 && SB == -1)
+      return 0x7FFFFFFF;
+    return uint32_t(SA / SB) | uint64_t(uint32_t(SA % SB)) << 32;
+  }
+  case K_DivU:
+    if (!B)
+      return 0xFFFFFFFF;
+    return (A / B) | uint64_t(A % B) << 32;
+  case K_And:   return A & B;
+  case K_Or:    return A | B;
+  case K_Xor:   return A ^ B;
+  case K_Nand:  return ~(A & B);
+  case K_Nor:   return ~(A | B);
+  case K_Xnor:  return ~(A ^ B);
+  case K_AndN:  return A & ~B;
+  case K_OrN:   return A | ~B;
+  case K_Not:   return ~A;
+  case K_Abs:   return arith(SA < 0 ? -int64_t(SA) : SA);
+  case K_AbsDif: {
+    int64_t Diff = int64_t(SA) - SB;
+    return arith(Diff < 0 ? -Diff : Diff);
+  }
+  case K_Min:   return std::min(SA, SB);
+  case K_Max:   return std::max(SA, SB);
+  case K_MinU:  return std::min(A, B);
+  case K_MaxU:  return std::max(A, B);
+  case K_Cmp:   return test(I.Aux, A, B);
+  case K_Sh:    return shift(A, B, false);
+  case K_Sha:   return shift(A, B, true);
+  case K_Clz:   return countLeadingZeros(A);
+  case K_Clo:   return countLeadingOnes(A);
+  case K_Cls:   return countLeadingZeros(A ^ uint32_t(SA >> 31)) - 1;
+  case K_Popcnt: return countPopulation(A);
+  case K_Sat:
+    switch (I.Aux) {
+    case Sat_B:  return std::min(std::max(SA, -0x80), 0x7F);
+    case Sat_BU: return std::min(A, 0xFFu);
+    case Sat_H:  return std::min(std::max(SA, -0x8000), 0x7FFF);
+    default:     return std::min(A, 0xFFFFu);
+    }
+  case K_Mov:   return A;
+  case K_MovHi: return A << 16;
+  case K_Lea:   return A + B;
+  case K_Shuffle: {
+    // Byte i of the result is byte B[2i+1:2i] of A; B[8] also reverses the
+    // bits within each byte.
+    uint32_t Result = 0;
+    for (unsigned i = 0; i != 4; ++i) {
+      uint8_t Byte = A >> (((B >> (2 * i)) & 3) * 8);
+      if (B & 0x100) {
+        uint8_t Rev = 0;
+        for (unsigned Bit = 0; Bit != 8; ++Bit)
+          Rev |= ((Byte >> Bit) & 1) << (7 - Bit);
+        Byte = Rev;
+      }
+      Result |= uint32_t(Byte) << (8 * i);
+    }
+    return Result;
+  }
+  case K_Crc32: {
+    // One step of the reflected IEEE 802.3 CRC-32 over the word in A,
+    // continuing from the checksum in B.
+    uint32_t Crc = B ^ A;
+    for (unsigned Bit = 0; Bit != 32; ++Bit)
+      Crc = (Crc >> 1) ^ (0xEDB88320 & (0 - (Crc & 1)));
+    return Crc;
+  }
+  case K_AddF:
+    return FloatToBits(BitsToFloat(A) + BitsToFloat(B));
+  }
+}
+
+/// readCSFR - MFCR, for the core special function registers the run keeps.
+uint32_t Simulator::readCSFR(unsigned Addr) const {
+  switch (Addr) {
+  case 0xFE00: return PCXI;
+  case 0xFE04: return R[SlotPSW];
+  case 0xFE08: return PC;
+  case 0xFE2C: return ICR;
+  case 0xFE38: return FCX;
+  case 0xFE3C: return LCX;
+  default:     return 0;
+  }
+}
+
+static uint32_t linkAddress(uint32_t Link) {
+  return ((Link & 0xF0000) << 12) | ((Link & 0xFFFF) << 6);
+}
+
+static uint32_t linkWord(uint32_t Addr) {
+  return ((Addr >> 28) << 16) | ((Addr >> 6) & 0xFFFF);
+}
+
+/// saveContext - Store the upper or lower context in the first CSA on the
+/// free list and link it to PCXI, as CALL, SVLCX and BISR do.
+bool Simulator::saveContext(bool Upper) {
+  if (!(FCX & LinkMask)) {
+    fault("free context list depleted (FCU trap) at " + hex(PC));
+    return false;
+  }
+  uint32_t EA = linkAddress(FCX);
+  uint32_t NewFCX = read(EA, 4);
+  const uint8_t *Context = Upper ? UpperContext : LowerContext;
+  write(EA, 4, PCXI);
+  for (unsigned i = 0; i != 15; ++i)
+    write(EA + 4 * (i + 1), 4, R[Context[i]]);
+
+  PCXI = (PCXI & ~(LinkMask | PCXI_UL)) | (Upper ? PCXI_UL : 0) |
+         (FCX & LinkMask);
+  FCX = (FCX & ~LinkMask) | (NewFCX & LinkMask);
+  ++ContextSaves;
+  MaxDepth = std::max(MaxDepth, ++Depth);
+  return true;
+}
+
+/// restoreContext - Reload the context PCXI links to and put its CSA back on
+/// the free list, as RET and RSLCX do.
+bool Simulator::restoreContext(bool Upper) {
+  if (!(PCXI & LinkMask)) {
+    fault("context list underflow (CSU trap) at " + hex(PC));
+    return false;
+  }
+  if (bool(PCXI & PCXI_UL) != Upper) {
+    fault("context type mismatch (CTYP trap) at " + hex(PC));
+    return false;
+  }
+  uint32_t EA = linkAddress(PCXI);
+  uint32_t NewPCXI = read(EA, 4);
+  const uint8_t *Context = Upper ? UpperContext : LowerContext;
+  for (unsigned i = 0; i != 15; ++i)
+    R[Context[i]] = read(EA + 4 * (i + 1), 4);
+  write(EA, 4, FCX);
+
+  FCX = (FCX & ~LinkMask) | (PCXI & LinkMask);
+  PCXI = NewPCXI;
+  ++ContextRestores;
+  --Depth;
+  return true;
+}
+
+void Simulator::execute(const Decoded &D) {
+  const MCInst &MI = D.Inst;
+  const OpInfo &I = D.Info;
+  unsigned N = MI.getNumOperands();
+  NextPC = PC + D.Size;
+
+  // Issue: wait for the sources, then take a slot in the current group or
+  // start the next one.
+  uint64_t Issue = Cycle;
+  for (uint8_t S : D.Uses)
+    Issue = std::max(Issue, Ready[S]);
+  if (Issue > Cycle || Slots >= SM.IssueWidth) {
+    Cycle = std::max(Issue, Cycle + 1);
+    Slots = 0;
+  }
+  ++Slots;
+  unsigned Latency = I.Kind == K_Load ? SM.LoadLatency
+                     : I.Kind == K_Div || I.Kind == K_DivU ? SM.HighLatency
+                     : 1;
+  for (unsigned i = 0, e = D.Defs.size(); i != e; ++i)
+    Ready[D.Defs[i]] = Cycle + (i < D.DataDefs ? Latency : 1);
+
+  bool Taken = false, Mispredicted = false, Context = false;
+  // A conditional branch is predicted taken if it goes backwards.
+  auto Branch = [&](bool Cond, int64_t Disp) {
+    if (Cond) {
+      NextPC = PC + Disp;
+      Taken = true;
+    }
+    Mispredicted = Cond != (Disp < 0);
+  };
+  auto Jump = [&](uint32_t Target, bool Indirect) {
+    NextPC = Target & ~1u;
+    Taken = true;
+    Mispredicted = Indirect;
+  };
+
+  if (I.Kind != K_Unknown && I.Kind <= K_LastALU) {
+    // The result is the first operand. ANDsc and ORsc only name their
+    // constant, D15 is both source and result.
+    unsigned Dst;
+    bool Pair;
+    uint32_t A, B = 0;
+    if (N == 1) {
+      Dst = SlotD15;
+      Pair = false;
+      A = R[SlotD15];
+      B = value(D, 0);
+    } else {
+      Dst = RegSlot[MI.getOperand(0).getReg()];
+      Pair = RegPair[MI.getOperand(0).getReg()];
+      A = value(D, 1);
+      if (N > 2)
+        B = value(D, 2);
+    }
+    uint64_t Result = alu(I, A, B);
+    R[Dst] = Result;
+    if (Pair)
+      R[Dst + 1] = Result >> 32;
+  } else {
+    switch (I.Kind) {
+    default:
+      llvm_unreachable("ALU operation not handled above!");
+    case K_Unknown:
+      fault(Twine("no semantics for ") + MII.getName(MI.getOpcode()) +
+            " at " + hex(PC));
+      return;
+
+    case K_AccCmp: {
+      uint32_t Acc = value(D, 1);
+      uint32_t Bit = test(I.Aux & 15, value(D, 2), value(D, 3));
+      uint32_t Result;
+      switch (I.Aux >> 4) {
+      case Acc_And: Result = (Acc & ~1u) | (Acc & Bit); break;
+      case Acc_Or:  Result = Acc | Bit; break;
+      case Acc_Xor: Result = Acc ^ Bit; break;
+      default:      Result = (Acc << 1) | Bit; break;
+      }
+      setReg(MI.getOperand(0), Result);
+      break;
+    }
+    case K_MAddQ:
+      setReg(MI.getOperand(0),
+             mulQ(value(D, 1), value(D, 2), value(D, 3), I.Aux));
+      break;
+    case K_Extr: {
+      uint32_t Pos = value(D, 2) & 31, Width = value(D, 3) & 31;
+      uint64_t Field = (uint64_t(reg(MI.getOperand(1))) >> Pos) &
+                       lowBits(Width);
+      if (I.Aux && Width)
+        Field = SignExtend32(Field, Width);
+      setReg(MI.getOperand(0), Width ? uint32_t(Field) : 0);
+      break;
+    }
+    case K_Dextr: {
+      uint64_t Both = uint64_t(reg(MI.getOperand(1))) << 32 |
+                      reg(MI.getOperand(2));
+      setReg(MI.getOperand(0), (Both << (value(D, 3) & 31)) >> 32);
+      break;
+    }
+    case K_Imask: {
+      uint32_t Pos = value(D, 2) & 31, Width = value(D, 3) & 31;
+      uint64_t Value = uint32_t((value(D, 1) & 15) << Pos);
+      uint64_t Mask = uint32_t(lowBits(Width) << Pos);
+      setReg64(MI.getOperand(0), Mask << 32 | Value);
+      break;
+    }
+    case K_BitOp: {
+      uint32_t S1 = reg(MI.getOperand(1)), P1 = value(D, 2) & 31;
+      uint32_t Bit = (reg(MI.getOperand(3)) >> (value(D, 4) & 31)) & 1;
+      uint32_t Result;
+      switch (I.Aux) {
+      case Bit_And: Result = ((S1 >> P1) & 1) & Bit; break;
+      case Bit_Or:  Result = ((S1 >> P1) & 1) | Bit; break;
+      case Bit_Xor: Result = ((S1 >> P1) & 1) ^ Bit; break;
+      case Bit_Ins:
+        Result = (S1 & ~(1u << P1)) | (Bit << P1);
+        break;
+      default:
+        Result = (S1 & ~(1u << P1)) | ((Bit ^ 1) << P1);
+        break;
+      }
+      setReg(MI.getOperand(0), Result);
+      break;
+    }
+    case K_Mfcr:
+      setReg(MI.getOperand(0), readCSFR(value(D, 1)));
+      break;
+    case K_SubSP:
+      R[SlotA10] -= value(D, 0);
+      break;
+
+    // Memory. Loads are d, base, offset and stores d, base, offset; with
+    // post- or pre-increment the written back base comes second in a load and
+    // first in a store.
+    case K_Load:
+    case K_Store: {
+      unsigned Size = I.Aux & 15, Mode = I.Aux >> 5;
+      bool IsLoad = I.Kind == K_Load;
+      unsigned DataIdx = IsLoad || !Mode ? 0 : 1;
+      unsigned BaseIdx = Mode ? 2 : 1;
+      const MCOperand &Data = MI.getOperand(DataIdx);
+      uint32_t Base = reg(MI.getOperand(BaseIdx));
+      int32_t Offset = MI.getOperand(BaseIdx + 1).getImm();
+      uint32_t EA = Mode == M_Post ? Base : Base + Offset;
+      if (IsLoad) {
+        noteLoad(Size);
+        if (Size == 8) {
+          uint32_t Lo = read(EA, 4);
+          setReg64(Data, Lo | uint64_t(read(EA + 4, 4)) << 32);
+        } else {
+          uint32_t Value = read(EA, Size);
+          if (I.Aux & 16)
+            Value = SignExtend32(Value, Size * 8);
+          setReg(Data, Value);
+        }
+      } else {
+        noteStore(Size);
+        if (Size == 8) {
+          uint64_t Value = reg64(Data);
+          write(EA, 4, Value);
+          write(EA + 4, 4, Value >> 32);
+        } else {
+          write(EA, Size, reg(Data));
+        }
+      }
+      if (Mode)
+        setReg(MI.getOperand(IsLoad ? 1 : 0), Base + Offset);
+      break;
+    }
+    case K_StoreBit: {
+      // ST.T carries the absolute address itself.
+      uint32_t Addr = value(D, 0);
+      uint32_t Bit = value(D, 1) & 7;
+      uint32_t Byte = read(Addr, 1);
+      Byte = (Byte & ~(1u << Bit)) | ((value(D, 2) & 1) << Bit);
+      write(Addr, 1, Byte);
+      noteLoad(1);
+      noteStore(1);
+      break;
+    }
+    case K_Swap: {
+      uint32_t EA = reg(MI.getOperand(1)) + MI.getOperand(2).getImm();
+      uint32_t Old = read(EA, 4);
+      write(EA, 4, reg(MI.getOperand(3)));
+      setReg(MI.getOperand(0), Old);
+      noteLoad(4);
+      noteStore(4);
+      break;
+    }
+    case K_CmpSwap:
+    case K_SwapMsk: {
+      // The even register holds the new value, the odd one the value to
+      // compare with or the mask. The old word comes back in the even one.
+      uint32_t EA = reg(MI.getOperand(1)) + MI.getOperand(2).getImm();
+      uint64_t Src = reg64(MI.getOperand(3));
+      uint32_t New = Src, Other = Src >> 32;
+      uint32_t Old = read(EA, 4);
+      noteLoad(4);
+      if (I.Kind == K_SwapMsk) {
+        write(EA, 4, (Old & ~Other) | (New & Other));
+        noteStore(4);
+      } else if (Old == Other) {
+        write(EA, 4, New);
+        noteStore(4);
+      }
+      setReg64(MI.getOperand(0), uint64_t(Other) << 32 | Old);
+      break;
+    }
+    case K_Ldmst: {
+      uint32_t EA = reg(MI.getOperand(0)) + MI.getOperand(1).getImm();
+      uint64_t Src = reg64(MI.getOperand(2));
+      uint32_t New = Src, Mask = Src >> 32;
+      write(EA, 4, (read(EA, 4) & ~Mask) | (New & Mask));
+      noteLoad(4);
+      noteStore(4);
+      break;
+    }
+
+    // Control flow. Branch targets are byte offsets from the instruction.
+    case K_J:
+      Jump(PC + MI.getOperand(0).getImm(), false);
+      break;
+    case K_JZ: {
+      // disp, reg; the 16-bit SB form tests D15.
+      uint32_t Value = N > 1 ? reg(MI.getOperand(1)) : R[SlotD15];
+      Branch((Value == 0) != bool(I.Aux), MI.getOperand(0).getImm());
+      break;
+    }
+    case K_JZT: {
+      // disp, reg, bit; the 16-bit SBRN form tests a bit of D15.
+      uint32_t Value = N > 2 ? reg(MI.getOperand(1)) : R[SlotD15];
+      unsigned Bit = MI.getOperand(N - 1).getImm() & 31;
+      Branch((((Value >> Bit) & 1) == 0) != bool(I.Aux),
+             MI.getOperand(0).getImm());
+      break;
+    }
+    case K_JCmp:
+      Branch(test(I.Aux, value(D, 0), value(D, 1)), MI.getOperand(2).getImm());
+      break;
+    case K_JNED:
+    case K_JNEI: {
+      uint32_t Value = value(D, 1);
+      setReg(MI.getOperand(0), I.Kind == K_JNED ? Value - 1 : Value + 1);
+      Branch(Value != value(D, 2), MI.getOperand(3).getImm());
+      break;
+    }
+    case K_JI:
+      Jump(reg(MI.getOperand(0)), true);
+      break;
+    case K_JIRet:
+      Jump(R[SlotA11], false);
+      break;
+    case K_JL:
+    case K_JLI: {
+      uint32_t Target = I.Kind == K_JL ? PC + MI.getOperand(0).getImm()
+                                       : reg(MI.getOperand(0));
+      R[SlotA11] = NextPC;
+      Jump(Target, I.Kind == K_JLI);
+      countCall(NextPC);
+      break;
+    }
+    case K_Call:
+    case K_CallI: {
+      uint32_t Target = I.Kind == K_Call ? PC + MI.getOperand(0).getImm()
+                                         : reg(MI.getOperand(0));
+      if (!saveContext(true))
+        return;
+      R[SlotA11] = NextPC;
+      Jump(Target, I.Kind == K_CallI);
+      countCall(NextPC);
+      Context = true;
+      break;
+    }
+    case K_FCall:
+    case K_FCallI: {
+      // FCALL keeps the return address on the stack instead of a CSA.
+      uint32_t Target = I.Kind == K_FCall ? PC + MI.getOperand(0).getImm()
+                                          : reg(MI.getOperand(0));
+      R[SlotA10] -= 4;
+      write(R[SlotA10], 4, R[SlotA11]);
+      noteStore(4);
+      R[SlotA11] = NextPC;
+      Jump(Target, I.Kind == K_FCallI);
+      countCall(NextPC);
+      break;
+    }
+    case K_Ret:
+      Jump(R[SlotA11], false);
+      restoreContext(true);
+      Context = true;
+      break;
+    case K_FRet:
+      Jump(R[SlotA11], false);
+      R[SlotA11] = read(R[SlotA10], 4);
+      R[SlotA10] += 4;
+      noteLoad(4);
+      break;
+    case K_Svlcx:
+      saveContext(false);
+      Context = true;
+      break;
+    case K_Rslcx:
+      restoreContext(false);
+      Context = true;
+      break;
+    case K_Bisr:
+      // Save the lower context, then enable interrupts at the new priority.
+      if (!saveContext(false))
+        return;
+      ICR = (ICR & ~0xFFu) | (value(D, 0) & 0xFF) | (1u << 15);
+      Context = true;
+      break;
+    case K_Nop:
+      break;
+    }
+  }
+
+  if (Taken) {
+    ++TakenBranches;
+    Slots = SM.IssueWidth;
+  }
+  if (Mispredicted) {
+    ++Mispredicts;
+    Cycle += SM.MispredictPenalty;
+  }
+  if (Context) {
+    Cycle += ContextCycles;
+    Slots = SM.IssueWidth;
+  }
+}
+
+/// callHost - Carry out the library routine whose stub PC is at, then return
+/// to the caller as the RET at its end would.
+void Simulator::callHost() {
+  const Stub &S = Stubs[(PC - StubBase) / 4];
+  uint64_t Bytes = 0; // Moved by the routine, for its cycle charge.
+  uint32_t Result = 0;
+  uint64_t Result64 = 0;
+  bool Is64 = false;
+  uint64_t X = pair(SlotD0 + 4), Y = pair(SlotD0 + 6);
+
+  switch (S.Fn) {
+  case HF_Missing:
+    fault("call to '" + S.Name + "', which is neither defined nor provided");
+    return;
+  case HF_Malloc:
+  case HF_Calloc:
+  case HF_Realloc: {
+    uint32_t Size = S.Fn == HF_Malloc   ? R[SlotD0 + 4]
+                    : S.Fn == HF_Calloc ? R[SlotD0 + 4] * R[SlotD0 + 5]
+                                        : R[SlotD0 + 4];
+    // A bump allocator; the size is kept in front of the block for realloc.
+    uint32_t Block = RoundUpToAlignment(HeapTop + 4, 8);
+    if (uint64_t(Block) + Size > Heap.Base + Heap.Bytes.size()) {
+      Result = 0;
+      break;
+    }
+    HeapTop = Block + Size;
+    write(Block - 4, 4, Size);
+    if (S.Fn == HF_Realloc && R[SlotA4]) {
+      uint32_t Old = R[SlotA4];
+      uint32_t OldSize = std::min(read(Old - 4, 4), Size);
+      for (uint32_t i = 0; i != OldSize; ++i)
+        write(Block + i, 1, read(Old + i, 1));
+      Bytes += 2 * OldSize;
+    }
+    Result = Block;
+    break;
+  }
+  case HF_Free:
+    break;
+  case HF_Memcpy:
+  case HF_Memmove: {
+    uint32_t Dst = R[SlotA4], Src = R[SlotA4 + 1], Size = R[SlotD0 + 4];
+    std::vector<uint8_t> Tmp(Size);
+    for (uint32_t i = 0; i != Size && Fault.empty(); ++i)
+      Tmp[i] = read(Src + i, 1);
+    for (uint32_t i = 0; i != Size && Fault.empty(); ++i)
+      write(Dst + i, 1, Tmp[i]);
+    Cur->LoadBytes += Size;
+    Cur->StoreBytes += Size;
+    LoadBytes += Size;
+    StoreBytes += Size;
+    Bytes += 2 * Size;
+    Result = Dst;
+    break;
+  }
+  case HF_Memset: {
+    uint32_t Dst = R[SlotA4], Size = R[SlotD0 + 5];
+    for (uint32_t i = 0; i != Size && Fault.empty(); ++i)
+      write(Dst + i, 1, R[SlotD0 + 4]);
+    Cur->StoreBytes += Size;
+    StoreBytes += Size;
+    Bytes += Size;
+    Result = Dst;
+    break;
+  }
+  case HF_Strlen:
+    Result = readString(R[SlotA4]).size();
+    Bytes += Result + 1;
+    break;
+  case HF_Putchar:
+    outs() << char(R[SlotD0 + 4]);
+    Result = R[SlotD0 + 4] & 0xFF;
+    break;
+  case HF_Puts:
+    outs() << readString(R[SlotA4]) << "\n";
+    break;
+  case HF_Printf: {
+    // The format is the pointer argument, the values follow it on the stack.
+    std::string Format = readString(R[SlotA4]);
+    uint32_t Arg = R[SlotA10];
+    std::string Out;
+    for (size_t i = 0; i < Format.size(); ++i) {
+      if (Format[i] != '%') {
+        Out += Format[i];
+        continue;
+      }
+      size_t Start = i++;
+      while (i < Format.size() && strchr("-+ #0123456789.", Format[i]))
+        ++i;
+      unsigned Longs = 0;
+      while (i < Format.size() && (Format[i] == 'l' || Format[i] == 'h'))
+        Longs += Format[i++] == 'l';
+      if (i == Format.size())
+        break;
+      char Conv = Format[i];
+      std::string Spec = Format.substr(Start, i - Start);
+      Spec.erase(std::remove_if(Spec.begin(), Spec.end(),
+                                [](char C) { return C == 'l' || C == 'h'; }),
+                 Spec.end());
+      char Buf[128];
+      switch (Conv) {
+      case '%':
+        Out += '%';
+        continue;
+      case 's':
+        Out += readString(read(Arg, 4));
+        Arg += 4;
+        continue;
+      case 'c':
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+      case 'p': {
+        uint64_t Value = read(Arg, 4);
+        Arg += 4;
+        if (Longs > 1) {
+          Value |= uint64_t(read(Arg, 4)) << 32;
+          Arg += 4;
+        } else if (Conv == 'd' || Conv == 'i') {
+          Value = int64_t(int32_t(Value));
+        }
+        Spec += Conv == 'c' ? "c" : Conv == 'p' ? "llx" : "ll";
+        if (Conv != 'c' && Conv != 'p')
+          Spec += Conv;
+        snprintf(Buf, sizeof(Buf), Spec.c_str(), Value);
+        Out += Buf;
+        continue;
+      }
+      default:
+        Out += Format.substr(Start, i - Start + 1);
+        continue;
+      }
+    }
+    outs() << Out;
+    Result = Out.size();
+    break;
+  }
+  case HF_Abort:
+    fault("abort() called");
+    return;
+  case HF_Exit:
+    ExitValue = R[SlotD0 + 4];
+    Done = true;
+    return;
+  case HF_DivSI:
+  case HF_ModSI: {
+    int32_t A = R[SlotD0 + 4], B = R[SlotD0 + 5];
+    if (!B || (A == INT32_MIN && B == -1))
+      Result = 0;
+    else
+      Result = S.Fn == HF_DivSI ? A / B : A % B;
+    break;
+  }
+  case HF_UDivSI:
+  case HF_UModSI: {
+    uint32_t A = R[SlotD0 + 4], B = R[SlotD0 + 5];
+    Result = !B ? 0 : S.Fn == HF_UDivSI ? A / B : A % B;
+    break;
+  }
+  case HF_DivDI:
+  case HF_ModDI: {
+    int64_t A = X, B = Y;
+    Is64 = true;
+    if (!B || (A == INT64_MIN && B == -1))
+      Result64 = 0;
+    else
+      Result64 = S.Fn == HF_DivDI ? A / B : A % B;
+    break;
+  }
+  case HF_UDivDI:
+  case HF_UModDI:
+    Is64 = true;
+    Result64 = !Y ? 0 : S.Fn == HF_UDivDI ? X / Y : X % Y;
+    break;
+  case HF_MulDI:
+    Is64 = true;
+    Result64 = X * Y;
+    break;
+  case HF_AshlDI:
+  case HF_LshrDI:
+  case HF_AshrDI: {
+    // The 64-bit value is in E4, the count in the next free D register.
+    unsigned Count = R[SlotD0 + 6] & 63;
+    Is64 = true;
+    Result64 = S.Fn == HF_AshlDI   ? X << Count
+               : S.Fn == HF_LshrDI ? X >> Count
+                                   : uint64_t(int64_t(X) >> Count);
+    break;
+  }
+  }
+
+  if (Is64) {
+    setPair(SlotD0 + 2, Result64);
+  } else {
+    // Pointers come back in A2 and everything else in D2; set both.
+    R[SlotD0 + 2] = Result;
+    R[SlotA2] = Result;
+  }
+
+  uint64_t Charge = 1 + Bytes / 4 + ContextCycles;
+  Cycle += Charge;
+  Cur->Cycles += Charge;
+  Slots = SM.IssueWidth;
+  NextPC = R[SlotA11] & ~1u;
+  restoreContext(true);
+  PC = NextPC;
+}
+
+/// run - Call Entry with Args in D4-D7 and execute until it returns.
+bool Simulator::run(uint32_t Entry, ArrayRef<int> Args) {
+  if (Args.size() > 4)
+    return error("at most four arguments can be passed in registers");
+
+  Heap.Base = HeapBase;
+  Heap.Bytes.assign(HeapSize, 0);
+  HeapTop = HeapBase;
+
+  // The CSAs at the bottom of the scratch-pad, linked into the free list, and
+  // the stack above them.
+  if (!CSAFrames)
+    return error("-csa-frames must be at least 1");
+  DSPR.Base = DSPRBase;
+  DSPR.Bytes.assign(CSAFrames * 64 + RoundUpToAlignment(StackSize, 8) + 64, 0);
+  for (unsigned i = 0; i != CSAFrames; ++i)
+    write(DSPRBase + 64 * i, 4,
+          i + 1 != CSAFrames ? linkWord(DSPRBase + 64 * (i + 1)) : 0);
+  FCX = linkWord(DSPRBase);
+  LCX = linkWord(DSPRBase + 64 * (CSAFrames - 1));
+  PCXI = 0;
+
+  R[SlotPSW] = 0x00000B80;
+  // Leave a zeroed frame above the entry function, as startup code would,
+  // where stack arguments and reads past the outermost locals land.
+  R[SlotA10] = DSPRBase + DSPR.Bytes.size() - 64;
+  R[SlotA0] = SmallDataBase;
+  for (unsigned i = 0; i != Args.size(); ++i)
+    R[SlotD0 + 4 + i] = Args[i];
+
+  // Enter as if called, so that the RET at the end of the entry function
+  // comes back to ExitAddr.
+  PC = Entry;
+  Cur = functionAt(Entry);
+  if (!saveContext(true))
+    return false;
+  R[SlotA11] = ExitAddr;
+  countCall(Entry);
+  Depth = MaxDepth = 0;
+
+  while (Fault.empty() && !Done) {
+    if (PC - StubBase < ExitAddr + 4 - StubBase) {
+      if (PC == ExitAddr) {
+        ExitValue = R[SlotD0 + 2];
+        Done = true;
+        break;
+      }
+      functionAt(PC);
+      callHost();
+      continue;
+    }
+
+    if (Insts == MaxInsts) {
+      fault("gave up after " + Twine(Insts) + " instructions");
+      break;
+    }
+    const Decoded *D = decode(PC);
+    if (!D)
+      break;
+    Function *F = functionAt(PC);
+    uint64_t Before = Cycle;
+    if (Trace) {
+      outs() << format("%10llu  %08x ", (unsigned long long)Cycle, PC);
+      IP.printInst(&D->Inst, outs(), "", STI);
+      outs() << "\n";
+    }
+    execute(*D);
+    ++Insts;
+    ++OpcodeCount[D->Inst.getOpcode()];
+    ++F->Insts;
+    F->Cycles += Cycle - Before;
+    PC = NextPC;
+  }
+  outs().flush();
+  return Fault.empty();
+}
+
+void Simulator::report(raw_ostream &OS, StringRef CPU) const {
+  auto Line = [&](const char *What, uint64_t Value) {
+    OS << format("%-20s %12llu", What, (unsigned long long)Value);
+  };
+
+  OS << "\n";
+  OS << format("cpu                  %12s\n", CPU.str().c_str());
+  OS << format("exit value           %12d\n", int32_t(ExitValue));
+  Line("instructions", Insts);
+  OS << "\n";
+  Line("cycles", Cycle);
+  if (Cycle)
+    OS << format("   (%.2f IPC)", double(Insts) / Cycle);
+  OS << "\n";
+  Line("loads", Loads);
+  OS << format("   (%llu bytes)\n", (unsigned long long)LoadBytes);
+  Line("stores", Stores);
+  OS << format("   (%llu bytes)\n", (unsigned long long)StoreBytes);
+  Line("context saves", ContextSaves);
+  OS << format("   (%llu bytes)\n", (unsigned long long)ContextSaves * 64);
+  Line("context restores", ContextRestores);
+  OS << format("   (%llu bytes)\n", (unsigned long long)ContextRestores * 64);
+  Line("max CSA depth", MaxDepth);
+  OS << format("   (of %u)\n", unsigned(CSAFrames));
+  Line("taken branches", TakenBranches);
+  OS << "\n";
+  Line("mispredictions", Mispredicts);
+  OS << "\n";
+
+  std::vector<const Function *> Used;
+  for (const Function &F : Functions)
+    if (F.Calls || F.Insts)
+      Used.push_back(&F);
+  if (Unknown.Insts)
+    Used.push_back(&Unknown);
+  std::stable_sort(Used.begin(), Used.end(),
+                   [](const Function *A, const Function *B) {
+                     return A->Cycles > B->Cycles;
+                   });
+
+  OS << "\nfunction                    calls        insts       cycles       %"
+        "     loaded     stored\n";
+  for (const Function *F : Used) {
+    std::string Name = F->Name + (F->Host ? " (host)" : "");
+    OS << format("%-24s %8llu %12llu %12llu %6.1f%% %10llu %10llu\n",
+                 Name.c_str(), (unsigned long long)F->Calls,
+                 (unsigned long long)F->Insts, (unsigned long long)F->Cycles,
+                 Cycle ? 100.0 * F->Cycles / Cycle : 0.0,
+                 (unsigned long long)F->LoadBytes,
+                 (unsigned long long)F->StoreBytes);
+  }
+
+  if (!OpcodeCounts)
+    return;
+  std::vector<std::pair<uint64_t, unsigned>> Counts;
+  for (unsigned Opc = 0, E = OpcodeCount.size(); Opc != E; ++Opc)
+    if (OpcodeCount[Opc])
+      Counts.push_back(std::make_pair(OpcodeCount[Opc], Opc));
+  std::sort(Counts.begin(), Counts.end(),
+            [](const std::pair<uint64_t, unsigned> &A,
+               const std::pair<uint64_t, unsigned> &B) {
+              return A.first > B.first;
+            });
+  OS << "\nopcode                          count\n";
+  for (const auto &C : Counts)
+    OS << format("%-24s %12llu\n", MII.getName(C.second),
+                 (unsigned long long)C.first);
+}
+
+int main(int argc, char **argv) {
+  // Print a stack trace if we signal out.
+  sys::PrintStackTraceOnErrorSignal();
+  PrettyStackTraceProgram X(argc, argv);
+  llvm_shutdown_obj Y; // Call llvm_shutdown() on exit.
+
+  LLVMInitializeTriCoreTargetInfo();
+  LLVMInitializeTriCoreTargetMC();
+  LLVMInitializeTriCoreDisassembler();
+
+  cl::ParseCommandLineOptions(argc, argv, "TriCore instruction set simulator\n");
+  ToolName = argv[0];
+
+  Triple TheTriple("tricore");
+  std::string Error;
+  const Target *TheTarget =
+      TargetRegistry::lookupTarget(TheTriple.getTriple(), Error);
+  if (!TheTarget) {
+    error(Error);
+    return 1;
+  }
+
+  std::unique_ptr<MCRegisterInfo> MRI(
+      TheTarget->createMCRegInfo(TheTriple.getTriple()));
+  std::unique_ptr<MCAsmInfo> MAI(
+      TheTarget->createMCAsmInfo(*MRI, TheTriple.getTriple()));
+  std::unique_ptr<MCSubtargetInfo> STI(
+      TheTarget->createMCSubtargetInfo(TheTriple.getTriple(), MCPU, ""));
+  std::unique_ptr<MCInstrInfo> MII(TheTarget->createMCInstrInfo());
+  MCObjectFileInfo MOFI;
+  MCContext Ctx(MAI.get(), MRI.get(), &MOFI);
+  std::unique_ptr<MCDisassembler> Dis(
+      TheTarget->createMCDisassembler(*STI, Ctx));
+  std::unique_ptr<MCInstPrinter> IP(
+      TheTarget->createMCInstPrinter(TheTriple, 0, *MAI, *MII, *MRI));
+  std::unique_ptr<MCAsmBackend> MAB(
+      TheTarget->createMCAsmBackend(*MRI, TheTriple.getTriple(), MCPU));
+  if (!Dis || !IP || !MAB) {
+    error("the TriCore target lacks a disassembler, printer or backend");
+    return 1;
+  }
+
+  std::vector<OwningBinary<ObjectFile>> Binaries;
+  std::vector<const ObjectFile *> Objs;
+  for (const std::string &File : InputFilenames) {
+    ErrorOr<OwningBinary<ObjectFile>> ObjOrErr =
+        ObjectFile::createObjectFile(File);
+    if (std::error_code EC = ObjOrErr.getError()) {
+      error(File + ": " + EC.message());
+      return 1;
+    }
+    const ObjectFile *Obj = ObjOrErr->getBinary();
+    if (!isa<ELFObjectFileBase>(Obj) || Obj->getArch() != Triple::tricore) {
+      error(File + ": not a TriCore ELF object");
+      return 1;
+    }
+    Objs.push_back(Obj);
+    Binaries.push_back(std::move(*ObjOrErr));
+  }
+
+  Simulator Sim(*MRI, *MII, *STI, *Dis, *IP);
+  if (!Sim.link(Objs, *MAB))
+    return 1;
+  uint32_t Entry;
+  if (!Sim.lookup(EntryName, Entry)) {
+    error("no function '" + EntryName + "' to run");
+    return 1;
+  }
+
+  bool Ok = Sim.run(Entry, EntryArgs);
+  if (!Sim.getFault().empty())
+    error(Sim.getFault());
+  Sim.report(outs(), MCPU.empty() ? StringRef("generic") : StringRef(MCPU));
+  return Ok ? 0 : 1;
+}